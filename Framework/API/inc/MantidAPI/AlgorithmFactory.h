@@ -13,6 +13,7 @@
 #include "MantidKernel/DynamicFactory.h"
 #include "MantidKernel/SingletonHolder.h"
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <sstream>
 #include <unordered_map>
@@ -77,6 +78,7 @@ public:
     const int version = extractAlgVersion(tempAlg);
     const std::string className = extractAlgName(tempAlg);
     const std::string alias = extractAlgAlias(tempAlg);
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
     typename VersionMap::const_iterator it = m_vmap.find(className);
     if (!className.empty()) {
       const std::string key = createName(className, version);
@@ -142,6 +144,19 @@ private:
 
   /// Create an algorithm object with the specified name
   std::shared_ptr<Algorithm> createAlgorithm(const std::string &name, const int version) const;
+  /// Open the deferred plugin library providing the named algorithm
+  void openDeferredLibraryFor(const std::string &algorithmName) const;
+
+  /// What listing the algorithms needs to know about one algorithm version
+  struct ListedAlgorithm {
+    std::string key;                     ///< Mangled name and version
+    std::string name;                    ///< Algorithm Name
+    int version;                         ///< version
+    std::vector<std::string> categories; ///< categories
+    std::string alias;                   ///< alias
+  };
+  /// List the registered algorithms and those of deferred plugin libraries
+  std::vector<ListedAlgorithm> listAlgorithms() const;
 
   /// Private Constructor for singleton class
   AlgorithmFactoryImpl();
@@ -160,6 +175,9 @@ private:
   using AliasMap = std::unordered_map<std::string, std::pair<std::string, int>>;
   /// The map holding the alias names of registered algorithms
   AliasMap m_amap;
+  /// Guards the registrations. Plugin libraries opened on first use register
+  /// their algorithms from whichever thread first asked for one of them.
+  mutable std::recursive_mutex m_mutex;
 };
 
 using AlgorithmFactory = Mantid::Kernel::SingletonHolder<AlgorithmFactoryImpl>;
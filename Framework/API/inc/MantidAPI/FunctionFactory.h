@@ -62,12 +62,19 @@ public:
   template <typename FunctionType> std::vector<std::string> getFunctionNames() const;
   /// Get function names that can be used by generic fitting GUIs
   std::vector<std::string> getFunctionNamesGUI() const;
-  // Unhide the base class version (to satisfy the intel compiler)
-  using Kernel::DynamicFactory<IFunction>::subscribe;
+  /// Register a function class under the given name. Hides the base class
+  /// version so that DECLARE_FUNCTION registers through the locked overload.
+  template <class C> void subscribe(const std::string &className) {
+    subscribe(className, std::make_unique<Kernel::Instantiator<C, IFunction>>());
+  }
   void subscribe(const std::string &className, std::unique_ptr<AbstractFactory> pAbstractFactory,
                  Kernel::DynamicFactory<IFunction>::SubscribeAction replace = ErrorIfExists);
 
   void unsubscribe(const std::string &className);
+  /// Returns true if a function is registered under the given name
+  bool exists(const std::string &className) const;
+  /// Returns the names of all registered functions
+  const std::vector<std::string> getKeys() const override;
 
 private:
   friend struct Mantid::Kernel::CreateUsingNew<FunctionFactoryImpl>;
@@ -77,8 +84,8 @@ private:
   /// Private Destructor
   ~FunctionFactoryImpl() override = default;
   /// These methods shouldn't be used to create functions
-  using Kernel::DynamicFactory<IFunction>::create;
-  using Kernel::DynamicFactory<IFunction>::createUnwrapped;
+  std::shared_ptr<IFunction> create(const std::string &className) const override;
+  IFunction *createUnwrapped(const std::string &className) const override;
 
   /// Create a simple function
   std::shared_ptr<IFunction> createSimple(const Expression &expr,
@@ -103,7 +110,13 @@ private:
   void addTie(const std::shared_ptr<IFunction> &fun, const Expression &expr) const;
 
   mutable std::map<std::string, std::vector<std::string>> m_cachedFunctionNames;
-  mutable std::mutex m_mutex;
+  /// The number of subscriptions and unsubscriptions, so that a list of names
+  /// built while a function was being registered is not cached
+  size_t m_registrations{0};
+  /// Guards the registrations and the cache. Plugin libraries opened on first
+  /// use register their functions from whichever thread first asked for one of
+  /// them, so the lock is never held while a library is opened.
+  mutable std::recursive_mutex m_mutex;
 };
 
 /**
@@ -112,20 +125,30 @@ private:
  * @returns A vector of the names of the functions matching the template type
  */
 template <typename FunctionType> std::vector<std::string> FunctionFactoryImpl::getFunctionNames() const {
-  std::lock_guard<std::mutex> _lock(m_mutex);
-
   const std::string soughtType(typeid(FunctionType).name());
-  if (m_cachedFunctionNames.find(soughtType) != m_cachedFunctionNames.end()) {
-    return m_cachedFunctionNames[soughtType];
+  size_t registrations(0);
+  {
+    std::lock_guard<std::recursive_mutex> _lock(m_mutex);
+    const auto cached = m_cachedFunctionNames.find(soughtType);
+    if (cached != m_cachedFunctionNames.end()) {
+      return cached->second;
+    }
+    registrations = m_registrations;
   }
 
-  // Create the entry in the cache and work with it directly
-  std::vector<std::string> &typeNames = m_cachedFunctionNames[soughtType];
+  // The lock is released while the names are gathered as getKeys opens any
+  // deferred plugin libraries, which subscribe their functions
   const std::vector<std::string> names = this->getKeys();
+  std::vector<std::string> typeNames;
   std::copy_if(names.cbegin(), names.cend(), std::back_inserter(typeNames), [this](const std::string &name) {
     std::shared_ptr<IFunction> func = this->createFunction(name);
     return std::dynamic_pointer_cast<FunctionType>(func);
   });
+
+  std::lock_guard<std::recursive_mutex> _lock(m_mutex);
+  if (registrations == m_registrations) {
+    m_cachedFunctionNames[soughtType] = typeNames;
+  }
   return typeNames;
 }
 
@@ -12,6 +12,11 @@
 #include "MantidAPI/DllConfig.h"
 #include "MantidGeometry/muParser_Silent.h"
 
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
 namespace Mantid {
 namespace API {
 namespace MuParserUtils {
@@ -31,6 +36,31 @@ extern const MANTID_API_DLL std::map<std::string, oneVarFun> MUPARSER_ONEVAR_FUN
 
 void MANTID_API_DLL extraOneVarFunctions(mu::Parser &parser);
 
+/** Evaluates the expression of a parser for arrays of variable values in a
+    single call using muParser's bulk mode, which runs in parallel when
+    muParser is built with OpenMP.
+
+    Bulk mode reads every variable from an array, so the evaluator keeps its
+    own copy of the parser with each variable bound to an internal buffer.
+    The copy is refreshed whenever the expression or variables of the source
+    parser change.
+*/
+class MANTID_API_DLL BulkEvaluator {
+public:
+  void evaluate(const mu::Parser &parser, const std::vector<std::string> &arrayVariables, const double *values,
+                double *results, size_t nValues);
+
+private:
+  /// The copy of the parser evaluated in bulk mode
+  std::unique_ptr<mu::Parser> m_parser;
+  /// The expression m_parser was copied with
+  std::string m_expression;
+  /// The variables of the source parser m_parser was copied with
+  std::map<std::string, double *> m_sources;
+  /// The arrays bound to the variables of m_parser
+  std::map<std::string, std::vector<double>> m_buffers;
+};
+
 } // namespace MuParserUtils
 } // namespace API
 } // namespace Mantid
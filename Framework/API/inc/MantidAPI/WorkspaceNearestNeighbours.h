@@ -9,14 +9,9 @@
 #include "MantidAPI/DllConfig.h"
 #include "MantidGeometry/IDTypes.h"
 #include "MantidKernel/V3D.h"
+#include <map>
 #include <memory>
-// Boost graphing
-#ifndef Q_MOC_RUN
-#define BOOST_ALLOW_DEPRECATED_HEADERS
-#include <boost/graph/adjacency_list.hpp>
-#undef BOOST_ALLOW_DEPRECATED_HEADERS
-#include <unordered_map>
-#endif
+#include <vector>
 
 namespace Mantid {
 namespace Geometry {
@@ -39,13 +34,9 @@ class SpectrumInfo;
  * ANN is available from <http://www.cs.umd.edu/~mount/ANN/> and is released
  * under the GNU LGPL.
  *
- * Known potential issue: boost's graph has an issue that may cause compilation
- * errors in some circumstances in the current version of boost used by
- * Mantid (1.43) based on tr1::tie. This issue is fixed in later versions
- * of boost, but should in theory be guarded against by this file only being
- * included in ParameterMap.
- *
- *
+ * The neighbour tables are cached process wide, keyed by the number of
+ * neighbours, the spectrum numbers and the detector positions, so that
+ * repeated algorithm runs over the same instrument do not rebuild the tree.
  */
 class MANTID_API_DLL WorkspaceNearestNeighbours {
 public:
@@ -60,6 +51,8 @@ public:
 
 protected:
   std::vector<size_t> getSpectraDetectors();
+  /// Returns true if both objects use the same neighbour table
+  bool sharesTableWith(const WorkspaceNearestNeighbours &other) const { return m_table == other.m_table; }
 
 private:
   /// A reference to the SpectrumInfo
@@ -67,33 +60,24 @@ private:
   /// Vector of spectrum numbers
   const std::vector<specnum_t> m_spectrumNumbers;
 
-  /// typedef for Graph object used to hold the calculated information
-  using Graph =
-      boost::adjacency_list<boost::vecS, boost::vecS, boost::directedS, boost::property<boost::vertex_name_t, int64_t>,
-                            boost::property<boost::edge_name_t, Mantid::Kernel::V3D>>;
-  /// Vertex descriptor object for Graph
-  using Vertex = boost::graph_traits<Graph>::vertex_descriptor;
-  /// map object of int to Graph Vertex descriptor
-  using MapIV = std::unordered_map<specnum_t, Vertex>;
+  /// The neighbours of each spectrum found by one all-points k-NN search
+  struct NeighbourTable;
 
-  /// Construct the graph based on the given number of neighbours and the
+  /// Construct the table based on the given number of neighbours and the
   /// current instument and spectra-detector mapping
   void build(const int noNeighbours);
-  /// Query the graph for the default number of nearest neighbours to specified
+  /// Query the table for the default number of nearest neighbours to specified
   /// detector
   std::map<specnum_t, Mantid::Kernel::V3D> defaultNeighbours(const specnum_t spectrum) const;
+  /// Process wide cache of recently built tables
+  class NeighbourTableCache;
+  static NeighbourTableCache &tableCache();
   /// The current number of nearest neighbours
   int m_noNeighbours;
   /// The largest value of the distance to a nearest neighbour
   double m_cutoff;
-  /// map between the DetectorID and the Graph node descriptor
-  MapIV m_specToVertex;
-  /// boost::graph object
-  Graph m_graph;
-  /// property map holding the node's related DetectorID's
-  boost::property_map<Graph, boost::vertex_name_t>::type m_vertexID;
-  /// property map holding the edge's related Distance value.
-  boost::property_map<Graph, boost::edge_name_t>::type m_edgeLength;
+  /// The nearest neighbours of each spectrum
+  std::shared_ptr<const NeighbourTable> m_table;
   /// V3D for scaling
   Kernel::V3D m_scale;
   /// Cached radius value. used to avoid uncessary recalculations.
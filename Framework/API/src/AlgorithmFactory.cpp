@@ -15,6 +15,7 @@
 #include <boost/algorithm/string.hpp>
 #include <memory>
 #include <sstream>
+#include <tuple>
 
 #include "MantidKernel/StringTokenizer.h"
 
@@ -22,6 +23,16 @@ namespace Mantid::API {
 namespace {
 /// static logger instance
 Kernel::Logger g_log("AlgorithmFactory");
+
+/// The plugin manifest kind listing one algorithm version per entry, named
+/// Name|version, with details "<alias or -> <categories separated by ;>"
+const std::string ALGORITHM_VERSION_KIND = "AlgorithmVersion";
+
+/// Returns true if all of the categories are hidden
+bool allHidden(const std::vector<std::string> &categories, const std::unordered_set<std::string> &hiddenCategories) {
+  return std::all_of(categories.cbegin(), categories.cend(),
+                     [&hiddenCategories](const auto &category) { return hiddenCategories.count(category) > 0; });
+}
 } // namespace
 
 AlgorithmFactoryImpl::AlgorithmFactoryImpl() : Kernel::DynamicFactory<Algorithm>(), m_vmap(), m_amap() {
@@ -40,6 +51,7 @@ AlgorithmFactoryImpl::~AlgorithmFactoryImpl() = default;
  * @returns a shared pointer to the created algorithm
  */
 std::shared_ptr<Algorithm> AlgorithmFactoryImpl::create(const std::string &name, const int &version) const {
+  openDeferredLibraryFor(name);
   int local_version = version;
   // Version not supplied
   if (version == -1) {
@@ -82,6 +94,7 @@ std::shared_ptr<Algorithm> AlgorithmFactoryImpl::create(const std::string &name,
  */
 void AlgorithmFactoryImpl::unsubscribe(const std::string &algorithmName, const int version) {
   std::string key = this->createName(algorithmName, version);
+  std::lock_guard<std::recursive_mutex> lock(m_mutex);
   try {
     Kernel::DynamicFactory<Algorithm>::unsubscribe(key);
     // Update version map accordingly
@@ -107,6 +120,8 @@ void AlgorithmFactoryImpl::unsubscribe(const std::string &algorithmName, const i
  * @returns True if a matching registration is found
  */
 bool AlgorithmFactoryImpl::exists(const std::string &algorithmName, const int version) {
+  openDeferredLibraryFor(algorithmName);
+  std::lock_guard<std::recursive_mutex> lock(m_mutex);
   if (version == -1) // Find anything
   {
     return (m_vmap.find(algorithmName) != m_vmap.end());
@@ -116,6 +131,71 @@ bool AlgorithmFactoryImpl::exists(const std::string &algorithmName, const int ve
   }
 }
 
+/**
+ * If plugin libraries are being opened on first use, make sure the library
+ * providing the named algorithm has been opened. The factory lock is released
+ * before opening the library: its registrations take the lock, possibly while
+ * another thread holds the LibraryManager lock.
+ * @param algorithmName :: The name, or alias, of the algorithm
+ */
+void AlgorithmFactoryImpl::openDeferredLibraryFor(const std::string &algorithmName) const {
+  {
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
+    if (m_vmap.find(algorithmName) != m_vmap.end() || m_amap.find(algorithmName) != m_amap.end())
+      return;
+  }
+  Kernel::LibraryManager::Instance().openDeferredLibrary("Algorithm", algorithmName);
+}
+
+/**
+ * List the registered algorithms together with those of the plugin libraries
+ * that are still waiting to be opened. The latter are read from the plugin
+ * manifest so that listing does not open the libraries; only libraries whose
+ * manifest entries do not describe their algorithm versions are opened.
+ * @returns The key, name, version, categories and alias of every algorithm
+ * version
+ */
+std::vector<AlgorithmFactoryImpl::ListedAlgorithm> AlgorithmFactoryImpl::listAlgorithms() const {
+  auto &libraries = Kernel::LibraryManager::Instance();
+  libraries.openDeferredLibraries("Algorithm", ALGORITHM_VERSION_KIND);
+
+  std::vector<ListedAlgorithm> algorithms;
+  std::unordered_set<std::string> keys;
+  for (const auto &entry : libraries.deferredEntries(ALGORITHM_VERSION_KIND)) {
+    ListedAlgorithm algorithm;
+    algorithm.key = entry.first;
+    std::tie(algorithm.name, algorithm.version) = decodeName(entry.first);
+    std::istringstream details(entry.second);
+    std::string categories;
+    details >> algorithm.alias;
+    std::getline(details, categories);
+    if (algorithm.alias == "-")
+      algorithm.alias.clear();
+    algorithm.categories = Mantid::Kernel::StringTokenizer(categories, ";",
+                                                           Mantid::Kernel::StringTokenizer::TOK_TRIM |
+                                                               Mantid::Kernel::StringTokenizer::TOK_IGNORE_EMPTY)
+                               .asVector();
+    keys.insert(algorithm.key);
+    algorithms.emplace_back(std::move(algorithm));
+  }
+
+  // A library may have been opened since its entries were read
+  std::vector<std::string> registered;
+  {
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
+    registered = Kernel::DynamicFactory<Algorithm>::getKeys();
+  }
+  for (const auto &key : registered) {
+    if (!keys.insert(key).second)
+      continue;
+    const auto nameAndVersion = decodeName(key);
+    const auto alg = create(nameAndVersion.first, nameAndVersion.second);
+    algorithms.emplace_back(ListedAlgorithm{key, nameAndVersion.first, nameAndVersion.second, alg->categories(),
+                                            alg->alias()});
+  }
+  return algorithms;
+}
+
 /** Creates a mangled name for interal storage
  * @param name :: the name of the Algrorithm
  * @param version :: the version of the algroithm
@@ -167,46 +247,18 @@ const std::vector<std::string> AlgorithmFactoryImpl::getKeys() const {
  * @returns The strings used to identify individual algorithms
  */
 const std::vector<std::string> AlgorithmFactoryImpl::getKeys(bool includeHidden) const {
-  // Start with those subscribed with the factory and add the cleanly
-  // constructed algorithm keys
-  std::vector<std::string> names = Kernel::DynamicFactory<Algorithm>::getKeys();
-
-  if (includeHidden) {
-    return names;
-  } else {
-    // hidden categories
-    std::unordered_set<std::string> hiddenCategories;
+  // hidden categories
+  std::unordered_set<std::string> hiddenCategories;
+  if (!includeHidden)
     fillHiddenCategories(&hiddenCategories);
 
-    // strip out any algorithms names where all of the categories are hidden
-    std::vector<std::string> validNames;
-    std::vector<std::string>::const_iterator itr_end = names.end();
-    for (std::vector<std::string>::const_iterator itr = names.begin(); itr != itr_end; ++itr) {
-      std::string name = *itr;
-      // check the categories
-      std::pair<std::string, int> namePair = decodeName(name);
-      std::shared_ptr<IAlgorithm> alg = create(namePair.first, namePair.second);
-      std::vector<std::string> categories = alg->categories();
-      bool toBeRemoved = true;
-
-      // for each category
-      std::vector<std::string>::const_iterator itCategoriesEnd = categories.end();
-      for (std::vector<std::string>::const_iterator itCategories = categories.begin(); itCategories != itCategoriesEnd;
-           ++itCategories) {
-        // if the entry is not in the set of hidden categories
-        if (hiddenCategories.find(*itCategories) == hiddenCategories.end()) {
-          toBeRemoved = false;
-        }
-      }
-
-      if (!toBeRemoved) {
-        // just mark them to be removed as we are iterating around the vector
-        // at the moment
-        validNames.emplace_back(name);
-      }
-    }
-    return validNames;
+  // strip out any algorithms names where all of the categories are hidden
+  std::vector<std::string> names;
+  for (const auto &algorithm : listAlgorithms()) {
+    if (includeHidden || !allHidden(algorithm.categories, hiddenCategories))
+      names.emplace_back(algorithm.key);
   }
+  return names;
 }
 
 /**
@@ -215,6 +267,7 @@ const std::vector<std::string> AlgorithmFactoryImpl::getKeys(bool includeHidden)
  */
 std::optional<std::pair<std::string, int>>
 AlgorithmFactoryImpl::getRealNameFromAlias(const std::string &alias) const noexcept {
+  std::lock_guard<std::recursive_mutex> lock(m_mutex);
   auto a_it = m_amap.find(alias);
   if (a_it == m_amap.end())
     return std::nullopt;
@@ -228,6 +281,8 @@ AlgorithmFactoryImpl::getRealNameFromAlias(const std::string &alias) const noexc
  * @throw std::invalid_argument if the algorithm cannot be found
  */
 int AlgorithmFactoryImpl::highestVersion(const std::string &algorithmName) const {
+  openDeferredLibraryFor(algorithmName);
+  std::lock_guard<std::recursive_mutex> lock(m_mutex);
   auto viter = m_vmap.find(algorithmName);
   if (viter != m_vmap.end())
     return viter->second;
@@ -256,19 +311,9 @@ const std::map<std::string, bool> AlgorithmFactoryImpl::getCategoriesWithState()
   std::unordered_set<std::string> hiddenCategories;
   fillHiddenCategories(&hiddenCategories);
 
-  // get all of the algorithm keys, including the hidden ones for speed
-  // purposes we will filter later if required
-  std::vector<std::string> names = getKeys(true);
-
-  std::vector<std::string>::const_iterator itr_end = names.end();
-  // for each algorithm
-  for (std::vector<std::string>::const_iterator itr = names.begin(); itr != itr_end; ++itr) {
-    std::string name = *itr;
-    // decode the name and create an instance
-    std::pair<std::string, int> namePair = decodeName(name);
-    std::shared_ptr<IAlgorithm> alg = create(namePair.first, namePair.second);
-    // extract out the categories
-    std::vector<std::string> categories = alg->categories();
+  // for each algorithm, including the hidden ones
+  for (const auto &algorithm : listAlgorithms()) {
+    const std::vector<std::string> &categories = algorithm.categories;
 
     // for each category of the algorithm
     std::vector<std::string>::const_iterator itCategoriesEnd = categories.end();
@@ -322,9 +367,6 @@ const std::unordered_set<std::string> AlgorithmFactoryImpl::getCategories(bool i
  * @returns A vector of descriptor objects
  */
 std::vector<AlgorithmDescriptor> AlgorithmFactoryImpl::getDescriptors(bool includeHidden, bool includeAliases) const {
-  // algorithm names
-  auto sv = getKeys(true);
-
   // hidden categories
   std::unordered_set<std::string> hiddenCategories;
   if (!includeHidden) {
@@ -334,24 +376,12 @@ std::vector<AlgorithmDescriptor> AlgorithmFactoryImpl::getDescriptors(bool inclu
   // results vector
   std::vector<AlgorithmDescriptor> res;
 
-  for (const auto &s : sv) {
-    if (s.empty())
-      continue;
+  for (const auto &algorithm : listAlgorithms()) {
     AlgorithmDescriptor desc;
-    size_t i = s.find('|');
-    if (i == std::string::npos) {
-      desc.name = s;
-      desc.version = 1;
-    } else if (i > 0) {
-      desc.name = s.substr(0, i);
-      std::string vers = s.substr(i + 1);
-      desc.version = vers.empty() ? 1 : std::stoi(vers);
-    } else
-      continue;
-
-    std::shared_ptr<IAlgorithm> alg = create(desc.name, desc.version);
-    auto categories = alg->categories();
-    desc.alias = alg->alias();
+    desc.name = algorithm.name;
+    desc.version = algorithm.version;
+    desc.alias = algorithm.alias;
+    const auto &categories = algorithm.categories;
 
     // For each category
     auto itCategoriesEnd = categories.end();
@@ -437,6 +467,7 @@ const std::string AlgorithmFactoryImpl::extractAlgAlias(const std::shared_ptr<IA
  * @returns A shared pointer to the algorithm object
  */
 std::shared_ptr<Algorithm> AlgorithmFactoryImpl::createAlgorithm(const std::string &name, const int version) const {
+  std::lock_guard<std::recursive_mutex> lock(m_mutex);
   return Kernel::DynamicFactory<Algorithm>::create(createName(name, version));
 }
 
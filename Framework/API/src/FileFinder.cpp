@@ -17,6 +17,7 @@
 #include "MantidKernel/FacilityInfo.h"
 #include "MantidKernel/Glob.h"
 #include "MantidKernel/InstrumentInfo.h"
+#include "MantidKernel/LibraryManager.h"
 #include "MantidKernel/Strings.h"
 
 #include "MantidKernel/StringTokenizer.h"
@@ -357,6 +358,8 @@ std::vector<IArchiveSearch_sptr> FileFinderImpl::getArchiveSearch(const Kernel::
   if (createArchiveSearch) {
     for (const auto &facilityname : facility.archiveSearch()) {
       g_log.debug() << "get archive search for the facility..." << facilityname << "\n";
+      if (!ArchiveSearchFactory::Instance().exists(facilityname))
+        Kernel::LibraryManager::Instance().openDeferredLibrary("ArchiveSearch", facilityname);
       archs.emplace_back(ArchiveSearchFactory::Instance().create(facilityname));
     }
   }
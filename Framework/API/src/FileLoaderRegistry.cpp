@@ -7,9 +7,12 @@
 #include "MantidAPI/FileLoaderRegistry.h"
 #include "MantidAPI/IFileLoader.h"
 #include "MantidAPI/NexusFileLoader.h"
+#include "MantidKernel/LibraryManager.h"
 
 #include <Poco/File.h>
 
+#include <algorithm>
+
 namespace Mantid::API {
 namespace {
 //----------------------------------------------------------------------------------------------
@@ -115,6 +118,8 @@ const std::shared_ptr<IAlgorithm> FileLoaderRegistryImpl::chooseLoader(const std
   using Kernel::NexusDescriptor;
   using Kernel::NexusHDF5Descriptor;
   m_log.debug() << "Trying to find loader for '" << filename << "'\n";
+  // Every loader must be registered to pick the best one
+  Kernel::LibraryManager::Instance().openDeferredLibraries("FileLoader");
 
   IAlgorithm_sptr bestLoader;
   if (NexusDescriptor::isReadable(filename)) {
@@ -158,6 +163,13 @@ bool FileLoaderRegistryImpl::canLoad(const std::string &algorithmName, const std
   using Kernel::NexusDescriptor;
   using Kernel::NexusHDF5Descriptor;
 
+  const auto isRegistered = [this, &algorithmName]() {
+    return std::any_of(m_names.cbegin(), m_names.cend(),
+                       [&algorithmName](const auto &names) { return names.find(algorithmName) != names.end(); });
+  };
+  if (!isRegistered())
+    Kernel::LibraryManager::Instance().openDeferredLibrary("FileLoader", algorithmName);
+
   // Check if it is in one of our lists
   const bool nexus = (m_names[Nexus].find(algorithmName) != m_names[Nexus].end());
   const bool nexusHDF5 = (m_names[NexusHDF5].find(algorithmName) != m_names[NexusHDF5].end());
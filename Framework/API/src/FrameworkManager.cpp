@@ -62,6 +62,10 @@ Kernel::Logger g_log("FrameworkManager");
 const char *PLUGINS_DIR_KEY = "framework.plugins.directory";
 /// Key to define the location of the plugins to exclude from loading
 const char *PLUGINS_EXCLUDE_KEY = "framework.plugins.exclude";
+/// Key to define the location of the manifest listing what each plugin provides
+const char *PLUGINS_MANIFEST_KEY = "framework.plugins.manifest";
+/// Key to switch on opening the plugins in the manifest on first use
+const char *PLUGINS_LAZYLOAD_KEY = "framework.plugins.lazyload";
 } // namespace
 
 /** This is a function called every time NeXuS raises an error.
@@ -317,6 +321,13 @@ void FrameworkManagerImpl::loadPluginsUsingKey(const std::string &locationKey, c
     std::vector<std::string> excludes;
     const auto excludeStr = cfgSvc.getString(excludeKey);
     boost::split(excludes, excludeStr, boost::is_any_of(";"));
+    if (ConfigService::Instance().getValue<bool>(PLUGINS_LAZYLOAD_KEY).value_or(false)) {
+      // Libraries listed in the manifest are opened when something they provide is first requested
+      // from a factory. Anything else in the directory is still opened immediately.
+      const auto deferred =
+          LibraryManager::Instance().deferLibraries(cfgSvc.getString(PLUGINS_MANIFEST_KEY), excludes);
+      excludes.insert(excludes.end(), deferred.cbegin(), deferred.cend());
+    }
     g_log.debug("Loading libraries from '" + pluginDir + "', excluding '" + excludeStr + "'");
     LibraryManager::Instance().openLibraries(pluginDir, LibraryManagerImpl::NonRecursive, excludes);
   } else {
@@ -31,6 +31,8 @@ FunctionFactoryImpl::FunctionFactoryImpl() : Kernel::DynamicFactory<IFunction>()
 }
 
 IFunction_sptr FunctionFactoryImpl::createFunction(const std::string &type) const {
+  if (!exists(type))
+    Kernel::LibraryManager::Instance().openDeferredLibrary("Function", type);
   IFunction_sptr fun = create(type);
   fun->initialize();
   return fun;
@@ -390,17 +392,52 @@ std::vector<std::string> FunctionFactoryImpl::getFunctionNamesGUI() const {
   return names;
 }
 
+/**
+ * Returns the names of all registered functions, opening any plugin libraries
+ * that were deferred at startup so the list is complete.
+ * @return A vector of function names
+ */
+const std::vector<std::string> FunctionFactoryImpl::getKeys() const {
+  Kernel::LibraryManager::Instance().openDeferredLibraries("Function");
+  std::lock_guard<std::recursive_mutex> lock(m_mutex);
+  return Kernel::DynamicFactory<IFunction>::getKeys();
+}
+
+/**
+ * Returns true if a function is registered under the given name. Deferred
+ * plugin libraries are not opened.
+ * @param className :: The name of the function
+ */
+bool FunctionFactoryImpl::exists(const std::string &className) const {
+  std::lock_guard<std::recursive_mutex> lock(m_mutex);
+  return Kernel::DynamicFactory<IFunction>::exists(className);
+}
+
 void FunctionFactoryImpl::subscribe(const std::string &className, std::unique_ptr<AbstractFactory> pAbstractFactory,
                                     Kernel::DynamicFactory<IFunction>::SubscribeAction replace) {
   // Clear the cache, then do all the work in the base class method
+  std::lock_guard<std::recursive_mutex> lock(m_mutex);
   m_cachedFunctionNames.clear();
+  ++m_registrations;
   Kernel::DynamicFactory<IFunction>::subscribe(className, std::move(pAbstractFactory), replace);
 }
 
 void FunctionFactoryImpl::unsubscribe(const std::string &className) {
   // Clear the cache, then do all the work in the base class method
+  std::lock_guard<std::recursive_mutex> lock(m_mutex);
   m_cachedFunctionNames.clear();
+  ++m_registrations;
   Kernel::DynamicFactory<IFunction>::unsubscribe(className);
 }
 
+std::shared_ptr<IFunction> FunctionFactoryImpl::create(const std::string &className) const {
+  std::lock_guard<std::recursive_mutex> lock(m_mutex);
+  return Kernel::DynamicFactory<IFunction>::create(className);
+}
+
+IFunction *FunctionFactoryImpl::createUnwrapped(const std::string &className) const {
+  std::lock_guard<std::recursive_mutex> lock(m_mutex);
+  return Kernel::DynamicFactory<IFunction>::createUnwrapped(className);
+}
+
 } // namespace Mantid::API
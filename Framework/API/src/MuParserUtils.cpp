@@ -10,6 +10,8 @@
 
 #include <gsl/gsl_sf.h>
 
+#include <algorithm>
+
 using namespace Mantid::PhysicalConstants;
 
 namespace Mantid::API::MuParserUtils {
@@ -54,4 +56,43 @@ void MANTID_API_DLL extraOneVarFunctions(mu::Parser &parser) {
   }
 }
 
+/** Evaluate the expression of a parser for each of an array of values.
+ *  @param parser The parser holding the expression and its variables.
+ *  @param arrayVariables The names of the variables that take the values.
+ *  Every other variable keeps the value it currently has in parser.
+ *  @param values The nValues values of the array variables.
+ *  @param results A buffer receiving the nValues results. It may be the same
+ *  as values.
+ *  @param nValues The number of values.
+ *  @throw mu::Parser::exception_type if the expression cannot be evaluated.
+ */
+void BulkEvaluator::evaluate(const mu::Parser &parser, const std::vector<std::string> &arrayVariables,
+                             const double *values, double *results, const size_t nValues) {
+  if (nValues == 0) {
+    return;
+  }
+  const auto &sources = parser.GetVar();
+  if (!m_parser || m_expression != parser.GetExpr() || m_sources != sources) {
+    m_parser = std::make_unique<mu::Parser>(parser);
+    m_parser->ClearVar();
+    m_expression = parser.GetExpr();
+    m_sources = sources;
+    m_buffers.clear();
+  }
+  for (const auto &[name, source] : m_sources) {
+    auto &buffer = m_buffers[name];
+    const auto *previousData = buffer.data();
+    buffer.resize(nValues);
+    if (buffer.data() != previousData) {
+      m_parser->DefineVar(name, buffer.data());
+    }
+    if (std::find(arrayVariables.cbegin(), arrayVariables.cend(), name) != arrayVariables.cend()) {
+      std::copy(values, values + nValues, buffer.begin());
+    } else {
+      std::fill(buffer.begin(), buffer.end(), *source);
+    }
+  }
+  m_parser->Eval(results, static_cast<int>(nValues));
+}
+
 } // namespace Mantid::API::MuParserUtils
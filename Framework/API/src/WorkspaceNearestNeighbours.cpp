@@ -14,12 +14,103 @@
 #include "MantidKernel/Exception.h"
 #include "MantidKernel/Timer.h"
 
+#include <algorithm>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
 namespace Mantid {
 using namespace Geometry;
 namespace API {
 using Kernel::V3D;
 using Mantid::detid_t;
 
+namespace {
+/// The number of neighbour tables kept by the cache
+constexpr size_t MAX_CACHED_TABLES = 2;
+} // namespace
+
+/**
+ * The neighbours of each point found by a k-nearest-neighbour search over the
+ * scaled detector positions. The key fields identify the search so that the
+ * table can be shared by every object searching the same points.
+ */
+struct WorkspaceNearestNeighbours::NeighbourTable {
+  // Key
+  /// The number of neighbours of each point
+  int nNeighbours{0};
+  /// The scaling applied to the positions
+  V3D scale;
+  /// The spectrum number of each point
+  std::vector<specnum_t> spectra;
+  /// The scaled position of each point, three coordinates per point
+  std::vector<double> points;
+
+  // Value
+  /// The point of each spectrum number
+  std::unordered_map<specnum_t, size_t> spectrumToPoint;
+  /// The nNeighbours nearest points of each point
+  std::vector<int> neighbours;
+  /// The largest distance to a nearest neighbour
+  double cutoff{std::numeric_limits<double>::lowest()};
+
+  /// True if the table is the result of the same search as key
+  bool matches(const NeighbourTable &key) const {
+    return nNeighbours == key.nNeighbours && scale.X() == key.scale.X() && scale.Y() == key.scale.Y() &&
+           scale.Z() == key.scale.Z() && spectra == key.spectra && points == key.points;
+  }
+  /// The real space position of a point
+  V3D position(const size_t point) const {
+    return V3D(points[3 * point], points[3 * point + 1], points[3 * point + 2]) * scale;
+  }
+};
+
+/**
+ * Keeps the most recently used neighbour tables so that searches over the
+ * same points are only run once.
+ */
+class WorkspaceNearestNeighbours::NeighbourTableCache {
+public:
+  /**
+   * Find a table built by an earlier search over the same points. The table
+   * becomes the most recently used.
+   * @param key :: A table holding the key fields of the search
+   * @return The cached table or nullptr if there is none
+   */
+  std::shared_ptr<const NeighbourTable> find(const NeighbourTable &key) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const auto found = std::find_if(m_tables.begin(), m_tables.end(),
+                                    [&key](const auto &table) { return table->matches(key); });
+    if (found == m_tables.end())
+      return nullptr;
+    m_tables.splice(m_tables.begin(), m_tables, found);
+    return m_tables.front();
+  }
+
+  /**
+   * Add a table, dropping the least recently used table if the cache is full
+   * @param table :: The table to add
+   */
+  void add(std::shared_ptr<const NeighbourTable> table) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_tables.emplace_front(std::move(table));
+    if (m_tables.size() > MAX_CACHED_TABLES) {
+      m_tables.pop_back();
+    }
+  }
+
+private:
+  std::mutex m_mutex;
+  /// Tables, most recently used first
+  std::list<std::shared_ptr<const NeighbourTable>> m_tables;
+};
+
+/// @return The process wide table cache
+WorkspaceNearestNeighbours::NeighbourTableCache &WorkspaceNearestNeighbours::tableCache() {
+  static NeighbourTableCache cache;
+  return cache;
+}
+
 /**
  * Constructor
  * @param nNeighbours :: Number of neighbours to use
@@ -104,9 +195,10 @@ std::map<specnum_t, V3D> WorkspaceNearestNeighbours::neighboursInRadius(const sp
 // Private member functions
 //--------------------------------------------------------------------------
 /**
- * Builds a map based on the given number of neighbours
+ * Builds the neighbour table for the given number of neighbours, or takes it
+ * from the cache if the same points have been searched before
  * @param noNeighbours :: The number of nearest neighbours to use to build
- * the graph
+ * the table
  */
 void WorkspaceNearestNeighbours::build(const int noNeighbours) {
   const auto indices = getSpectraDetectors();
@@ -118,9 +210,6 @@ void WorkspaceNearestNeighbours::build(const int noNeighbours) {
     throw std::invalid_argument("NearestNeighbours::build - Invalid number of neighbours");
   }
 
-  // Clear current
-  m_graph.clear();
-  m_specToVertex.clear();
   m_noNeighbours = noNeighbours;
 
   BoundingBox bbox;
@@ -129,60 +218,62 @@ void WorkspaceNearestNeighbours::build(const int noNeighbours) {
   const auto &firstDet = m_spectrumInfo.detector(indices.front());
   firstDet.getBoundingBox(bbox);
   m_scale = V3D(bbox.width());
-  ANNpointArray dataPoints = annAllocPts(nspectra, 3);
-  MapIV pointNoToVertex;
 
-  int pointNo = 0;
+  auto table = std::make_shared<NeighbourTable>();
+  table->nNeighbours = m_noNeighbours;
+  table->scale = m_scale;
+  table->spectra.reserve(indices.size());
+  table->points.reserve(3 * indices.size());
   for (const auto i : indices) {
-    const specnum_t spectrum = m_spectrumNumbers[i];
-    V3D pos = m_spectrumInfo.position(i) / m_scale;
-    dataPoints[pointNo][0] = pos.X();
-    dataPoints[pointNo][1] = pos.Y();
-    dataPoints[pointNo][2] = pos.Z();
-    Vertex vertex = boost::add_vertex(spectrum, m_graph);
-    pointNoToVertex[pointNo] = vertex;
-    m_specToVertex[spectrum] = vertex;
-    ++pointNo;
+    table->spectra.emplace_back(m_spectrumNumbers[i]);
+    const V3D pos = m_spectrumInfo.position(i) / m_scale;
+    table->points.emplace_back(pos.X());
+    table->points.emplace_back(pos.Y());
+    table->points.emplace_back(pos.Z());
+  }
+
+  if (auto cached = tableCache().find(*table)) {
+    m_table = std::move(cached);
+    m_cutoff = std::max(m_cutoff, m_table->cutoff);
+    return;
+  }
+
+  ANNpointArray dataPoints = annAllocPts(nspectra, 3);
+  for (int pointNo = 0; pointNo < nspectra; ++pointNo) {
+    std::copy_n(&table->points[3 * pointNo], 3, dataPoints[pointNo]);
+    table->spectrumToPoint[table->spectra[pointNo]] = static_cast<size_t>(pointNo);
   }
 
   auto annTree = std::make_unique<ANNkd_tree>(dataPoints, nspectra, 3);
-  pointNo = 0;
-  // Run the nearest neighbour search on each detector, reusing the arrays
-  // Set size initially to avoid array index error when testing in debug mode
-  std::vector<ANNidx> nnIndexList(m_noNeighbours);
+  // Run the nearest neighbour search on each detector, writing straight into
+  // the table
+  table->neighbours.resize(static_cast<size_t>(nspectra) * m_noNeighbours);
   std::vector<ANNdist> nnDistList(m_noNeighbours);
-
-  for (const auto idx : indices) {
-    ANNpoint scaledPos = dataPoints[pointNo];
-    annTree->annkSearch(scaledPos,          // Point to search nearest neighbours of
-                        m_noNeighbours,     // Number of neighbours to find (8)
-                        nnIndexList.data(), // Index list of results
-                        nnDistList.data(),  // List of distances to each of these
-                        0.0                 // Error bound (?) is this the radius to search in?
+  for (int pointNo = 0; pointNo < nspectra; ++pointNo) {
+    ANNidx *nnIndexList = &table->neighbours[static_cast<size_t>(pointNo) * m_noNeighbours];
+    annTree->annkSearch(dataPoints[pointNo], // Point to search nearest neighbours of
+                        m_noNeighbours,      // Number of neighbours to find (8)
+                        nnIndexList,         // Index list of results
+                        nnDistList.data(),   // List of distances to each of these
+                        0.0                  // Error bound (?) is this the radius to search in?
     );
     // The distances that are returned are in our scaled coordinate
     // system. We store the real space ones.
-    const V3D realPos = V3D(scaledPos[0], scaledPos[1], scaledPos[2]) * m_scale;
+    const V3D realPos = table->position(pointNo);
     for (int i = 0; i < m_noNeighbours; i++) {
-      ANNidx index = nnIndexList[i];
-      V3D neighbour = V3D(dataPoints[index][0], dataPoints[index][1], dataPoints[index][2]) * m_scale;
-      V3D distance = neighbour - realPos;
-      double separation = distance.norm();
-      boost::add_edge(m_specToVertex[m_spectrumNumbers[idx]], // from
-                      pointNoToVertex[index],                 // to
-                      distance, m_graph);
-      if (separation > m_cutoff) {
-        m_cutoff = separation;
+      const double separation = (table->position(nnIndexList[i]) - realPos).norm();
+      if (separation > table->cutoff) {
+        table->cutoff = separation;
       }
     }
-    pointNo++;
   }
+  annTree.reset();
   annDeallocPts(dataPoints);
   annClose();
-  pointNoToVertex.clear();
 
-  m_vertexID = get(boost::vertex_name, m_graph);
-  m_edgeLength = get(boost::edge_name, m_graph);
+  m_cutoff = std::max(m_cutoff, table->cutoff);
+  m_table = table;
+  tableCache().add(m_table);
 }
 
 /**
@@ -193,24 +284,20 @@ void WorkspaceNearestNeighbours::build(const int noNeighbours) {
  * @throw NotFoundError if detector ID is not recognised
  */
 std::map<specnum_t, V3D> WorkspaceNearestNeighbours::defaultNeighbours(const specnum_t spectrum) const {
-  auto vertex = m_specToVertex.find(spectrum);
-
-  if (vertex != m_specToVertex.end()) {
-    std::map<specnum_t, V3D> result;
-    std::pair<Graph::adjacency_iterator, Graph::adjacency_iterator> adjacent =
-        boost::adjacent_vertices(vertex->second, m_graph);
-    Graph::adjacency_iterator adjIt;
-    for (adjIt = adjacent.first; adjIt != adjacent.second; adjIt++) {
-      Vertex nearest = (*adjIt);
-      auto nrSpec = specnum_t(m_vertexID[nearest]);
-      std::pair<Graph::edge_descriptor, bool> nrEd = boost::edge(vertex->second, nearest, m_graph);
-      result[nrSpec] = m_edgeLength[nrEd.first];
-    }
-    return result;
-  } else {
+  const auto found = m_table->spectrumToPoint.find(spectrum);
+  if (found == m_table->spectrumToPoint.end()) {
     throw Mantid::Kernel::Exception::NotFoundError("NearestNeighbours: Unable to find spectrum in vertex map",
                                                    spectrum);
   }
+  const size_t point = found->second;
+  const V3D realPos = m_table->position(point);
+  const auto nNeighbours = static_cast<size_t>(m_table->nNeighbours);
+  std::map<specnum_t, V3D> result;
+  for (size_t i = point * nNeighbours; i < (point + 1) * nNeighbours; ++i) {
+    const auto neighbour = static_cast<size_t>(m_table->neighbours[i]);
+    result.emplace(m_table->spectra[neighbour], m_table->position(neighbour) - realPos);
+  }
+  return result;
 }
 
 /// Returns the list of valid spectrum indices
@@ -8,6 +8,8 @@
 
 #include "FakeAlgorithms.h"
 #include "MantidAPI/AlgorithmFactory.h"
+#include "MantidFrameworkTestHelpers/DeferredLibraryHelper.h"
+#include "MantidKernel/LibraryManager.h"
 #include "MantidKernel/Instantiator.h"
 #include <algorithm>
 #include <cxxtest/TestSuite.h>
@@ -340,4 +342,83 @@ public:
     TS_ASSERT_EQUALS(nameAndVersion->first, "CoolAlgorithm");
     TS_ASSERT_EQUALS(nameAndVersion->second, 1);
   }
+
+  void testExistsOpensOnlyTheDeferredLibraryProvidingTheAlgorithm() {
+    using DeferredLibraryHelper::libraryFilename;
+    DeferredLibraryHelper::ScopedManifest manifest(
+        "AlgorithmFactoryTest_deferred",
+        {libraryFilename("AlgorithmFactoryTestAlgorithms") + " Algorithm AlgorithmFactoryTestDeferred",
+         libraryFilename("AlgorithmFactoryTestFunctions") + " Function AlgorithmFactoryTestDeferred"},
+        {"AlgorithmFactoryTestAlgorithms", "AlgorithmFactoryTestFunctions"});
+    manifest.defer();
+    auto &libraries = Mantid::Kernel::LibraryManager::Instance();
+
+    // the placeholder library cannot register anything
+    TS_ASSERT(!AlgorithmFactory::Instance().exists("AlgorithmFactoryTestDeferred"));
+
+    TS_ASSERT(!libraries.isDeferred(libraryFilename("AlgorithmFactoryTestAlgorithms")));
+    TS_ASSERT(libraries.isDeferred(libraryFilename("AlgorithmFactoryTestFunctions")));
+  }
+
+  void testRegisteredAlgorithmDoesNotOpenDeferredLibraries() {
+    using DeferredLibraryHelper::libraryFilename;
+    auto &algFactory = AlgorithmFactory::Instance();
+    algFactory.subscribe<ToyAlgorithm>();
+    DeferredLibraryHelper::ScopedManifest manifest(
+        "AlgorithmFactoryTest_registered",
+        {libraryFilename("AlgorithmFactoryTestAlgorithms") + " Algorithm ToyAlgorithm"},
+        {"AlgorithmFactoryTestAlgorithms"});
+    manifest.defer();
+
+    TS_ASSERT(algFactory.exists("ToyAlgorithm"));
+    TS_ASSERT_THROWS_NOTHING(algFactory.create("ToyAlgorithm", 1));
+
+    TS_ASSERT(
+        Mantid::Kernel::LibraryManager::Instance().isDeferred(libraryFilename("AlgorithmFactoryTestAlgorithms")));
+    algFactory.unsubscribe("ToyAlgorithm", 1);
+  }
+
+  void testListingReadsDeferredAlgorithmsFromTheManifest() {
+    using DeferredLibraryHelper::libraryFilename;
+    const std::string library = libraryFilename("AlgorithmFactoryTestAlgorithms");
+    DeferredLibraryHelper::ScopedManifest manifest(
+        "AlgorithmFactoryTest_listing",
+        {library + " Algorithm AlgorithmFactoryTestDeferred",
+         library + " AlgorithmVersion AlgorithmFactoryTestDeferred|2 DeferredAlias DeferredCat;DeferredCat\\Sub"},
+        {"AlgorithmFactoryTestAlgorithms"});
+    manifest.defer();
+    auto &algFactory = AlgorithmFactory::Instance();
+
+    const auto keys = algFactory.getKeys();
+    const auto categories = algFactory.getCategoriesWithState();
+    const auto descriptors = algFactory.getDescriptors(false, true);
+
+    TS_ASSERT(std::find(keys.cbegin(), keys.cend(), "AlgorithmFactoryTestDeferred|2") != keys.cend());
+    TS_ASSERT_EQUALS(categories.count("DeferredCat"), 1);
+    TS_ASSERT_EQUALS(categories.count("DeferredCat\\Sub"), 1);
+    const auto deferred = std::count_if(descriptors.cbegin(), descriptors.cend(), [](const auto &descriptor) {
+      return descriptor.name == "AlgorithmFactoryTestDeferred" && descriptor.version == 2 &&
+             descriptor.alias == "DeferredAlias";
+    });
+    TS_ASSERT_EQUALS(deferred, 2);
+    TS_ASSERT(std::any_of(descriptors.cbegin(), descriptors.cend(),
+                          [](const auto &descriptor) { return descriptor.name == "DeferredAlias"; }));
+    TS_ASSERT(Mantid::Kernel::LibraryManager::Instance().isDeferred(library));
+  }
+
+  void testListingOpensDeferredLibrariesWithoutAlgorithmVersions() {
+    using DeferredLibraryHelper::libraryFilename;
+    DeferredLibraryHelper::ScopedManifest manifest(
+        "AlgorithmFactoryTest_scanned",
+        {libraryFilename("AlgorithmFactoryTestScanned") + " Algorithm AlgorithmFactoryTestScanned",
+         libraryFilename("AlgorithmFactoryTestFunctions") + " Function AlgorithmFactoryTestScanned"},
+        {"AlgorithmFactoryTestScanned", "AlgorithmFactoryTestFunctions"});
+    manifest.defer();
+    auto &libraries = Mantid::Kernel::LibraryManager::Instance();
+
+    AlgorithmFactory::Instance().getKeys();
+
+    TS_ASSERT(!libraries.isDeferred(libraryFilename("AlgorithmFactoryTestScanned")));
+    TS_ASSERT(libraries.isDeferred(libraryFilename("AlgorithmFactoryTestFunctions")));
+  }
 };
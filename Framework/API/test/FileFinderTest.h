@@ -7,9 +7,11 @@
 #pragma once
 
 #include "MantidAPI/FileFinder.h"
+#include "MantidFrameworkTestHelpers/DeferredLibraryHelper.h"
 #include "MantidKernel/ConfigService.h"
 #include "MantidKernel/Exception.h"
 #include "MantidKernel/FacilityInfo.h"
+#include "MantidKernel/LibraryManager.h"
 #include <cxxtest/TestSuite.h>
 
 #include <Poco/File.h>
@@ -261,6 +263,22 @@ public:
     TS_ASSERT(file.exists());
   }
 
+  void testGetArchiveSearchOpensTheDeferredLibraryProvidingIt() {
+    using DeferredLibraryHelper::libraryFilename;
+    DeferredLibraryHelper::ScopedManifest manifest(
+        "FileFinderTest_archive", {libraryFilename("FileFinderTestArchives") + " ArchiveSearch ISISDataSearch"},
+        {"FileFinderTestArchives"});
+    manifest.defer();
+    ConfigService::Instance().setString("datasearch.searcharchive", "all");
+
+    // the placeholder library cannot register anything
+    TS_ASSERT_THROWS(FileFinder::Instance().getArchiveSearch(ConfigService::Instance().getFacility("ISIS")),
+                     const Exception::NotFoundError &);
+
+    TS_ASSERT(!LibraryManager::Instance().isDeferred(libraryFilename("FileFinderTestArchives")));
+    ConfigService::Instance().setString("datasearch.searcharchive", "Off");
+  }
+
   void testFindRunForISIS() {
     // Set the facility
     ConfigService::Instance().setString("default.facility", "ISIS");
@@ -0,0 +1,62 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2024 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidAPI/FileLoaderRegistry.h"
+#include "MantidFrameworkTestHelpers/DeferredLibraryHelper.h"
+#include "MantidFrameworkTestHelpers/ScopedFileHelper.h"
+#include "MantidKernel/Exception.h"
+#include "MantidKernel/LibraryManager.h"
+
+using namespace Mantid::API;
+using DeferredLibraryHelper::libraryFilename;
+using DeferredLibraryHelper::ScopedManifest;
+using Mantid::Kernel::LibraryManager;
+
+class FileLoaderRegistryTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static FileLoaderRegistryTest *createSuite() { return new FileLoaderRegistryTest(); }
+  static void destroySuite(FileLoaderRegistryTest *suite) { delete suite; }
+
+  void test_chooseLoader_opens_only_deferred_file_loader_libraries() {
+    ScopedManifest manifest("FileLoaderRegistryTest_choose",
+                            {libraryFilename("FileLoaderRegistryTestLoaders") + " Algorithm LoadDeferred",
+                             libraryFilename("FileLoaderRegistryTestLoaders") + " FileLoader LoadDeferred",
+                             libraryFilename("FileLoaderRegistryTestAlgorithms") + " Algorithm RebinDeferred"},
+                            {"FileLoaderRegistryTestLoaders", "FileLoaderRegistryTestAlgorithms"});
+    manifest.defer();
+    ScopedFileHelper::ScopedFile data("1 2 3\n", "FileLoaderRegistryTest_data.txt");
+
+    // the placeholder library cannot register a loader
+    TS_ASSERT_THROWS(FileLoaderRegistry::Instance().chooseLoader(data.getFileName()),
+                     const Mantid::Kernel::Exception::NotFoundError &);
+
+    auto &libraries = LibraryManager::Instance();
+    TS_ASSERT(!libraries.isDeferred(libraryFilename("FileLoaderRegistryTestLoaders")));
+    TS_ASSERT(libraries.isDeferred(libraryFilename("FileLoaderRegistryTestAlgorithms")));
+  }
+
+  void test_canLoad_opens_the_deferred_library_providing_the_loader() {
+    ScopedManifest manifest("FileLoaderRegistryTest_canLoad",
+                            {libraryFilename("FileLoaderRegistryTestLoaders") + " FileLoader LoadDeferred",
+                             libraryFilename("FileLoaderRegistryTestOtherLoaders") + " FileLoader LoadOther"},
+                            {"FileLoaderRegistryTestLoaders", "FileLoaderRegistryTestOtherLoaders"});
+    manifest.defer();
+    ScopedFileHelper::ScopedFile data("1 2 3\n", "FileLoaderRegistryTest_data.txt");
+
+    TS_ASSERT_THROWS(FileLoaderRegistry::Instance().canLoad("LoadDeferred", data.getFileName()),
+                     const std::invalid_argument &);
+
+    auto &libraries = LibraryManager::Instance();
+    TS_ASSERT(!libraries.isDeferred(libraryFilename("FileLoaderRegistryTestLoaders")));
+    TS_ASSERT(libraries.isDeferred(libraryFilename("FileLoaderRegistryTestOtherLoaders")));
+  }
+};
@@ -18,9 +18,13 @@
 #include "MantidAPI/IPeakFunction.h"
 #include "MantidAPI/MultiDomainFunction.h"
 #include "MantidAPI/ParamFunction.h"
+#include "MantidFrameworkTestHelpers/DeferredLibraryHelper.h"
+#include "MantidKernel/Exception.h"
+#include "MantidKernel/LibraryManager.h"
 #include "MantidKernel/System.h"
 
 #include <sstream>
+#include <thread>
 
 using namespace Mantid;
 using namespace Mantid::API;
@@ -453,4 +457,61 @@ public:
                           [](const std::string &name) { return name.find("CrystalField") != std::string::npos; });
     TS_ASSERT(i == names.end());
   }
+
+  void test_createFunction_opens_only_the_deferred_library_providing_it() {
+    using DeferredLibraryHelper::libraryFilename;
+    DeferredLibraryHelper::ScopedManifest manifest(
+        "FunctionFactoryTest_create",
+        {libraryFilename("FunctionFactoryTestFunctions") + " Function FunctionFactoryTest_Deferred",
+         libraryFilename("FunctionFactoryTestOtherFunctions") + " Function FunctionFactoryTest_Other"},
+        {"FunctionFactoryTestFunctions", "FunctionFactoryTestOtherFunctions"});
+    manifest.defer();
+    auto &libraries = Kernel::LibraryManager::Instance();
+
+    // the placeholder library cannot register anything
+    TS_ASSERT_THROWS(FunctionFactory::Instance().createFunction("FunctionFactoryTest_Deferred"),
+                     const Kernel::Exception::NotFoundError &);
+
+    TS_ASSERT(!libraries.isDeferred(libraryFilename("FunctionFactoryTestFunctions")));
+    TS_ASSERT(libraries.isDeferred(libraryFilename("FunctionFactoryTestOtherFunctions")));
+  }
+
+  void test_getKeys_opens_all_deferred_function_libraries() {
+    using DeferredLibraryHelper::libraryFilename;
+    DeferredLibraryHelper::ScopedManifest manifest(
+        "FunctionFactoryTest_keys",
+        {libraryFilename("FunctionFactoryTestFunctions") + " Function FunctionFactoryTest_Deferred",
+         libraryFilename("FunctionFactoryTestAlgorithms") + " Algorithm FunctionFactoryTest_Deferred"},
+        {"FunctionFactoryTestFunctions", "FunctionFactoryTestAlgorithms"});
+    manifest.defer();
+    auto &libraries = Kernel::LibraryManager::Instance();
+
+    FunctionFactory::Instance().getKeys();
+
+    TS_ASSERT(!libraries.isDeferred(libraryFilename("FunctionFactoryTestFunctions")));
+    TS_ASSERT(libraries.isDeferred(libraryFilename("FunctionFactoryTestAlgorithms")));
+  }
+
+  void test_functions_can_be_created_while_others_are_registered() {
+    // as a plugin library opened on first use does from whichever thread asked for it
+    auto &factory = FunctionFactory::Instance();
+    std::thread registering([&factory]() {
+      for (int i = 0; i < 200; ++i) {
+        const std::string name = "FunctionFactoryTest_Registered" + std::to_string(i);
+        factory.subscribe<FunctionFactoryTest_FunctB>(name);
+        factory.unsubscribe(name);
+      }
+    });
+    for (int i = 0; i < 200; ++i) {
+      TS_ASSERT(factory.createFunction("FunctionFactoryTest_FunctA"));
+      TS_ASSERT(factory.exists("FunctionFactoryTest_FunctB"));
+    }
+    registering.join();
+
+    const auto names = factory.getFunctionNames<IFunction1D>();
+    TS_ASSERT(std::find(names.cbegin(), names.cend(), "FunctionFactoryTest_FunctA") != names.cend());
+    TS_ASSERT(std::none_of(names.cbegin(), names.cend(), [](const auto &name) {
+      return name.find("FunctionFactoryTest_Registered") != std::string::npos;
+    }));
+  }
 };
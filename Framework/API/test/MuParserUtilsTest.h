@@ -25,6 +25,55 @@ public:
     TS_ASSERT(noVariablesDefined(parser));
   }
 
+  void test_BulkEvaluator_matches_Eval() {
+    double x(0.), a(1.5);
+    mu::Parser parser;
+    MuParserUtils::extraOneVarFunctions(parser);
+    parser.DefineVar("x", &x);
+    parser.DefineVar("a", &a);
+    parser.SetExpr("a*x^2 + erf(x)");
+
+    const std::vector<double> values{-1.0, -0.25, 0.0, 0.5, 2.0};
+    std::vector<double> results(values.size());
+    MuParserUtils::BulkEvaluator evaluator;
+    evaluator.evaluate(parser, {"x"}, values.data(), results.data(), values.size());
+    for (size_t i = 0; i < values.size(); ++i) {
+      x = values[i];
+      TS_ASSERT_DELTA(results[i], parser.Eval(), 1e-14);
+    }
+    // The variables of the source parser are untouched
+    TS_ASSERT_EQUALS(values.back(), x);
+    TS_ASSERT_EQUALS(1.5, a);
+  }
+
+  void test_BulkEvaluator_follows_changes_to_the_source_parser() {
+    double x(0.), a(2.);
+    mu::Parser parser;
+    parser.DefineVar("x", &x);
+    parser.DefineVar("a", &a);
+    parser.SetExpr("a*x");
+
+    std::vector<double> values{1.0, 2.0, 3.0};
+    MuParserUtils::BulkEvaluator evaluator;
+    std::vector<double> results(values.size());
+    evaluator.evaluate(parser, {"x"}, values.data(), results.data(), values.size());
+    TS_ASSERT_EQUALS(results, std::vector<double>({2.0, 4.0, 6.0}));
+
+    a = -1.;
+    evaluator.evaluate(parser, {"x"}, values.data(), results.data(), values.size());
+    TS_ASSERT_EQUALS(results, std::vector<double>({-1.0, -2.0, -3.0}));
+
+    parser.SetExpr("a+x");
+    values.emplace_back(4.0);
+    results.resize(values.size());
+    evaluator.evaluate(parser, {"x"}, values.data(), results.data(), values.size());
+    TS_ASSERT_EQUALS(results, std::vector<double>({0.0, 1.0, 2.0, 3.0}));
+
+    // results may overwrite the values
+    evaluator.evaluate(parser, {"x", "a"}, values.data(), values.data(), values.size());
+    TS_ASSERT_EQUALS(values, std::vector<double>({2.0, 4.0, 6.0, 8.0}));
+  }
+
 private:
   static bool extraOneVarFunctionsDefined(const mu::Parser &parser) {
     const auto functionMap = parser.GetFunDef();
@@ -13,6 +13,7 @@
 #include "MantidGeometry/IDetector.h"
 #include "MantidGeometry/Instrument.h"
 #include "MantidGeometry/Instrument/Detector.h"
+#include "MantidGeometry/Instrument/DetectorInfo.h"
 #include "MantidGeometry/Instrument/ParameterMap.h"
 #include "MantidGeometry/Instrument/RectangularDetector.h"
 #include "MantidGeometry/Objects/BoundingBox.h"
@@ -62,6 +63,11 @@ private:
 
     // Direct access to intermdiate spectra detectors
     std::vector<size_t> getSpectraDetectors() { return WorkspaceNearestNeighbours::getSpectraDetectors(); }
+
+    // Whether the neighbour table is the one built for another object
+    bool sharesTableWith(const ExposedNearestNeighbours &other) const {
+      return WorkspaceNearestNeighbours::sharesTableWith(other);
+    }
   };
 
 public:
@@ -180,6 +186,42 @@ public:
     TSM_ASSERT_EQUALS("Without masked should get 16 spectra back", 16, sizeWithoutMasked);
     TSM_ASSERT("Must have less detectors available after applying masking", sizeWithoutMasked < sizeWithMasked);
   }
+
+  void testSearchOverSamePointsIsShared() {
+    const auto ws = makeWorkspace(1, 18);
+    ws->setInstrument(ComponentCreationHelper::createTestInstrumentCylindrical(2));
+    const auto spectrumNumbers = getSpectrumNumbers(*ws);
+
+    ExposedNearestNeighbours first(ws->spectrumInfo(), spectrumNumbers);
+    ExposedNearestNeighbours second(ws->spectrumInfo(), spectrumNumbers);
+
+    TS_ASSERT(second.sharesTableWith(first));
+    for (specnum_t spectrum = 1; spectrum <= 18; ++spectrum) {
+      TS_ASSERT_EQUALS(first.neighbours(spectrum), second.neighbours(spectrum));
+    }
+  }
+
+  void testMovedDetectorIsNotServedFromCache() {
+    const auto ws = makeWorkspace(1, 18);
+    ws->setInstrument(ComponentCreationHelper::createTestInstrumentCylindrical(2));
+    const auto spectrumNumbers = getSpectrumNumbers(*ws);
+
+    ExposedNearestNeighbours original(ws->spectrumInfo(), spectrumNumbers);
+    const auto originalDistances = original.neighbours(5);
+
+    auto &detectorInfo = ws->mutableDetectorInfo();
+    detectorInfo.setPosition(4, detectorInfo.position(4) + V3D(0.0, 0.0, 0.01));
+    const auto &spectrumInfo = ws->spectrumInfo();
+    ExposedNearestNeighbours moved(spectrumInfo, spectrumNumbers);
+    const auto movedDistances = moved.neighbours(5);
+
+    TS_ASSERT(!moved.sharesTableWith(original));
+    TS_ASSERT_DIFFERS(originalDistances, movedDistances);
+    for (const auto &[spectrum, distance] : movedDistances) {
+      const V3D delta = spectrumInfo.position(spectrum - 1) - spectrumInfo.position(4);
+      TS_ASSERT_DELTA(distance.norm(), delta.norm(), 1e-12);
+    }
+  }
 };
 
 //=====================================================================================
@@ -211,4 +253,20 @@ public:
       nn.neighbours(1);
     }
   }
+
+  void testRepeatedConstructionOnLargeInstrument() {
+    // 4 banks of 100x100 pixels
+    const auto ws = makeWorkspace(1, 40000);
+    ws->setInstrument(ComponentCreationHelper::createTestInstrumentRectangular(4, 100));
+    // Spectra 1-40000 map to the detector IDs of the banks, starting at 100*100
+    for (size_t i = 0; i < ws->getNumberHistograms(); ++i) {
+      ws->getSpectrum(i).setDetectorID(static_cast<detid_t>(i + 100 * 100));
+    }
+    const auto &spectrumInfo = ws->spectrumInfo();
+    const auto spectrumNumbers = getSpectrumNumbers(*ws);
+    for (size_t i = 0; i < 20; i++) {
+      WorkspaceNearestNeighbours nn(8, spectrumInfo, spectrumNumbers);
+      nn.neighbours(1);
+    }
+  }
 };
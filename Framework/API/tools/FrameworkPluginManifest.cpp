@@ -0,0 +1,201 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2024 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+/*
+  Build-time tool writing the manifest used by LibraryManagerImpl::deferLibraries
+  to open plugin libraries on first use. The entries are the names the
+  libraries register with the factories, i.e. the names returned by name() and
+  alias(), rather than class names. Each algorithm version also has an
+  AlgorithmVersion entry, "Name|version <alias or -> <categories>", so that the
+  AlgorithmFactory can list the algorithms without opening the libraries.
+
+    FrameworkPluginManifest list <library> <output>
+      Writes what opening the library registers. Run in a fresh process per
+      library.
+    FrameworkPluginManifest merge <manifest> <list files...>
+      Writes the manifest. A plugin linking another plugin also lists what the
+      other one registers, so each name is given to the library with the
+      fewest registrations that lists it.
+    FrameworkPluginManifest check <manifest> <libraries...>
+      Opens all of the libraries and fails if anything registered is missing
+      from the manifest.
+*/
+#include "MantidAPI/AlgorithmFactory.h"
+#include "MantidAPI/ArchiveSearchFactory.h"
+#include "MantidAPI/FunctionFactory.h"
+#include "MantidAPI/IFileLoader.h"
+#include "MantidKernel/DllOpen.h"
+#include "MantidKernel/FileDescriptor.h"
+#include "MantidKernel/NexusDescriptor.h"
+#include "MantidKernel/NexusHDF5Descriptor.h"
+
+#include <Poco/Path.h>
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace Mantid::API;
+using Mantid::Kernel::DllOpen;
+
+namespace {
+/// An object registered with a factory: its kind (Algorithm, Function, ...) and name
+using Entry = std::pair<std::string, std::string>;
+/// Entries with their details, the rest of their manifest line
+using Entries = std::map<Entry, std::string>;
+
+bool isFileLoader(const IAlgorithm &alg) {
+  return dynamic_cast<const IFileLoader<Mantid::Kernel::FileDescriptor> *>(&alg) ||
+         dynamic_cast<const IFileLoader<Mantid::Kernel::NexusDescriptor> *>(&alg) ||
+         dynamic_cast<const IFileLoader<Mantid::Kernel::NexusHDF5Descriptor> *>(&alg);
+}
+
+/// What the AlgorithmFactory lists for an algorithm version: its alias, or -, and its categories
+std::string algorithmDetails(const IAlgorithm &alg) {
+  std::ostringstream details;
+  details << (alg.alias().empty() ? "-" : alg.alias()) << " ";
+  const auto categories = alg.categories();
+  std::copy(categories.cbegin(), categories.cend(), std::ostream_iterator<std::string>(details, ";"));
+  return details.str();
+}
+
+/// Everything currently registered with the factories that plugins register with
+Entries registeredEntries() {
+  Entries entries;
+  auto &algorithms = AlgorithmFactory::Instance();
+  for (const auto &key : algorithms.getKeys(true)) {
+    const auto nameAndVersion = algorithms.decodeName(key);
+    entries.emplace(Entry("Algorithm", nameAndVersion.first), "");
+    const auto alg = algorithms.create(nameAndVersion.first, nameAndVersion.second);
+    entries.emplace(Entry("AlgorithmVersion", key), algorithmDetails(*alg));
+    if (!alg->alias().empty())
+      entries.emplace(Entry("Algorithm", alg->alias()), "");
+    if (isFileLoader(*alg))
+      entries.emplace(Entry("FileLoader", nameAndVersion.first), "");
+  }
+  for (const auto &name : FunctionFactory::Instance().getKeys())
+    entries.emplace(Entry("Function", name), "");
+  for (const auto &name : ArchiveSearchFactory::Instance().getKeys())
+    entries.emplace(Entry("ArchiveSearch", name), "");
+  return entries;
+}
+
+Entries newEntries(const Entries &before, const Entries &after) {
+  Entries added;
+  std::copy_if(after.cbegin(), after.cend(), std::inserter(added, added.end()),
+               [&before](const auto &entry) { return before.count(entry.first) == 0; });
+  return added;
+}
+
+bool openLibrary(const std::string &path) {
+  // The library is never closed as the factories keep objects created by it
+  if (DllOpen::openDll(path))
+    return true;
+  std::cerr << "Unable to open " << path << "\n";
+  return false;
+}
+
+int list(const std::string &libraryPath, const std::string &outputPath) {
+  const auto before = registeredEntries();
+  if (!openLibrary(libraryPath))
+    return 1;
+  std::ofstream output(outputPath);
+  output << "# " << Poco::Path(libraryPath).getFileName() << "\n";
+  for (const auto &entry : newEntries(before, registeredEntries())) {
+    output << entry.first.first << " " << entry.first.second;
+    if (!entry.second.empty())
+      output << " " << entry.second;
+    output << "\n";
+  }
+  return output ? 0 : 1;
+}
+
+int merge(const std::string &manifestPath, const std::vector<std::string> &listPaths) {
+  // library filename and number of registrations for every library listing an entry
+  std::map<Entry, std::vector<std::pair<size_t, std::string>>> listedBy;
+  Entries details;
+  for (const auto &listPath : listPaths) {
+    std::ifstream input(listPath);
+    std::string line, library;
+    std::vector<Entry> entries;
+    while (std::getline(input, line)) {
+      std::istringstream fields(line);
+      std::string kind, name, rest;
+      if (!(fields >> kind >> name))
+        continue;
+      if (kind == "#") {
+        library = name;
+        continue;
+      }
+      std::getline(fields, rest);
+      entries.emplace_back(kind, name);
+      details[entries.back()] = rest;
+    }
+    if (library.empty()) {
+      std::cerr << "No library named in " << listPath << "\n";
+      return 1;
+    }
+    for (const auto &entry : entries)
+      listedBy[entry].emplace_back(entries.size(), library);
+  }
+
+  std::ofstream manifest(manifestPath);
+  manifest << "# Generated by FrameworkPluginManifest. Each line is <library filename> <kind> <name> [details]\n";
+  for (const auto &entry : listedBy) {
+    const auto provider = std::min_element(entry.second.cbegin(), entry.second.cend());
+    manifest << provider->second << " " << entry.first.first << " " << entry.first.second << details[entry.first]
+             << "\n";
+  }
+  return manifest ? 0 : 1;
+}
+
+int check(const std::string &manifestPath, const std::vector<std::string> &libraryPaths) {
+  std::set<Entry> listed;
+  std::ifstream manifest(manifestPath);
+  std::string line;
+  while (std::getline(manifest, line)) {
+    std::istringstream fields(line);
+    std::string library, kind, name;
+    if (fields >> library >> kind >> name && library.front() != '#')
+      listed.emplace(kind, name);
+  }
+
+  const auto before = registeredEntries();
+  for (const auto &path : libraryPaths) {
+    if (!openLibrary(path))
+      return 1;
+  }
+  int missing(0);
+  for (const auto &entry : newEntries(before, registeredEntries())) {
+    if (listed.count(entry.first) == 0) {
+      std::cerr << entry.first.first << " " << entry.first.second << " is registered but missing from "
+                << manifestPath << "\n";
+      ++missing;
+    }
+  }
+  return missing == 0 ? 0 : 1;
+}
+} // namespace
+
+int main(int argc, char *argv[]) {
+  const std::vector<std::string> args(argv + 1, argv + argc);
+  if (args.size() == 3 && args[0] == "list")
+    return list(args[1], args[2]);
+  if (args.size() >= 2 && args[0] == "merge")
+    return merge(args[1], std::vector<std::string>(args.cbegin() + 2, args.cend()));
+  if (args.size() >= 2 && args[0] == "check")
+    return check(args[1], std::vector<std::string>(args.cbegin() + 2, args.cend()));
+  std::cerr << "Usage: FrameworkPluginManifest list <library> <output>\n"
+            << "       FrameworkPluginManifest merge <manifest> <list files...>\n"
+            << "       FrameworkPluginManifest check <manifest> <libraries...>\n";
+  return 2;
+}
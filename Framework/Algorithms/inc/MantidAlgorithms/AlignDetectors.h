@@ -20,9 +20,7 @@ class EventWorkspace;
 
 namespace Algorithms {
 
-namespace {
 class ConversionFactors;
-}
 
 /** Performs a unit change from TOF to dSpacing, correcting the X values to
    account for small
@@ -64,11 +62,17 @@ private:
 
   void align(const ConversionFactors &converter, API::Progress &progress, API::MatrixWorkspace_sptr &outputWS);
 
+  std::shared_ptr<const ConversionFactors> getConversionFactors(const API::MatrixWorkspace_sptr &inputWS);
   void loadCalFile(const API::MatrixWorkspace_sptr &inputWS, const std::string &filename);
   void getCalibrationWS(const API::MatrixWorkspace_sptr &inputWS);
 
   Mantid::API::ITableWorkspace_sptr m_calibrationWS;
 
+  /// The calibration file and instrument the kept conversion factors were read for
+  std::string m_calFileKey;
+  /// Conversion factors read from the calibration file, kept between executions
+  std::shared_ptr<const ConversionFactors> m_calFileConverter;
+
   /// number of spectra in input workspace
   int64_t m_numberOfSpectra;
 };
@@ -19,7 +19,10 @@ namespace Mantid {
 
 namespace API {
 class SpectrumInfo;
+namespace MuParserUtils {
+class BulkEvaluator;
 }
+} // namespace API
 
 namespace Algorithms {
 /** ConvertAxisByFormula : Performs a unit conversion based on a supplied
@@ -57,11 +60,10 @@ private:
   };
   using Variable_ptr = std::shared_ptr<Variable>;
 
-  void setAxisValue(const double value, const std::vector<Variable_ptr> &variables);
-  void calculateValues(mu::Parser &p, std::vector<double> &vec, std::vector<Variable_ptr> variables);
+  void calculateValues(const mu::Parser &p, API::MuParserUtils::BulkEvaluator &evaluator, std::vector<double> &vec,
+                       const std::vector<Variable_ptr> &variables);
   void setGeometryValues(const API::SpectrumInfo &specInfo, const size_t index,
                          const std::vector<Variable_ptr> &variables);
-  double evaluateResult(mu::Parser &p);
 };
 
 } // namespace Algorithms
@@ -125,6 +125,15 @@ private:
   std::vector<std::vector<std::size_t>> m_wsIndices;
   /// List of valid group numbers
   std::vector<Indexing::SpectrumNumber> m_validGroups;
+
+  /// The grouping file and instrument the kept grouping was read for
+  std::string m_groupingFileKey;
+  /// Grouping read from the grouping file, kept between executions
+  Mantid::DataObjects::GroupingWorkspace_sptr m_fileGroupWS;
+  /// Map from detector ID to group of the kept grouping
+  std::vector<int> m_fileUdet2group;
+  /// Number of groups of the kept grouping
+  int64_t m_fileNGroups = 0;
 };
 
 } // namespace Algorithms
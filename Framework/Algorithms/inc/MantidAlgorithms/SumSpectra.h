@@ -69,6 +69,8 @@ private:
   void exec() override;
   void execEvent(const API::MatrixWorkspace_sptr &outputWorkspace, API::Progress &progress, size_t &numSpectra,
                  size_t &numMasked, size_t &numZeros);
+  void execEventHistogram(const API::MatrixWorkspace_sptr &outputWorkspace, API::Progress &progress,
+                          size_t &numSpectra, size_t &numMasked, size_t &numZeros);
   specnum_t getOutputSpecNo(const API::MatrixWorkspace_const_sptr &localworkspace);
 
   API::MatrixWorkspace_sptr replaceSpecialValues();
@@ -402,13 +402,17 @@ void AbsorptionCorrection::calculateDistances(const IDetector &detector, std::ve
                           detector.getPhi() * 180.0 / M_PI);
   }
 
+  // Create tracks for distance in cylinder between scattering points and
+  // detector and intercept them together
+  std::vector<Track> outgoing;
+  outgoing.reserve(m_numVolumeElements);
   for (size_t i = 0; i < m_numVolumeElements; ++i) {
-    // Create track for distance in cylinder between scattering point and
-    // detector
     const V3D direction = normalize(detectorPos - m_elementPositions[i]);
-    Track outgoing(m_elementPositions[i], direction);
-    m_sampleObject->interceptSurface(outgoing);
-    L2s[i] = outgoing.totalDistInsideObject();
+    outgoing.emplace_back(m_elementPositions[i], direction);
+  }
+  m_sampleObject->interceptSurfaces(outgoing);
+  for (size_t i = 0; i < m_numVolumeElements; ++i) {
+    L2s[i] = outgoing[i].totalDistInsideObject();
   }
 }
 
@@ -36,8 +36,7 @@ namespace Mantid::Algorithms {
 // Register the algorithm into the algorithm factory
 DECLARE_ALGORITHM(AlignDetectors)
 
-namespace { // anonymous namespace
-
+/// The diffractometer constants of the detectors in a calibration table
 class ConversionFactors {
 public:
   explicit ConversionFactors(const ITableWorkspace_const_sptr &table)
@@ -98,7 +97,6 @@ private:
   Column_const_sptr m_difaCol;
   Column_const_sptr m_tzeroCol;
 };
-} // anonymous namespace
 
 const std::string AlignDetectors::name() const { return "AlignDetectors"; }
 
@@ -215,14 +213,34 @@ void AlignDetectors::getCalibrationWS(const MatrixWorkspace_sptr &inputWS) {
     return;
   }
 
+  throw std::runtime_error("Failed to determine calibration information");
+}
+
+/**
+ * Get the conversion factors of the calibration. Those read from a calibration
+ * file are kept, so that an instance executed again, e.g. on each chunk of live
+ * data, reads the file only once for each instrument.
+ *
+ * @param inputWS :: The workspace to align
+ * @return The conversion factors
+ */
+std::shared_ptr<const ConversionFactors> AlignDetectors::getConversionFactors(const MatrixWorkspace_sptr &inputWS) {
   const std::string calFileName = getPropertyValue("CalibrationFile");
-  if (!calFileName.empty()) {
+  if (calFileName.empty()) {
+    this->getCalibrationWS(inputWS);
+    return std::make_shared<const ConversionFactors>(m_calibrationWS);
+  }
+
+  const std::string key = calFileName + '\n' + inputWS->getInstrument()->getName();
+  if (!m_calFileConverter || key != m_calFileKey) {
     progress(0.0, "Reading calibration file");
     loadCalFile(inputWS, calFileName);
-    return;
+    m_calFileConverter = std::make_shared<const ConversionFactors>(m_calibrationWS);
+    m_calFileKey = key;
+  } else {
+    g_log.debug() << "Using the calibration read from " << calFileName << " by the previous execution\n";
   }
-
-  throw std::runtime_error("Failed to determine calibration information");
+  return m_calFileConverter;
 }
 
 void setXAxisUnits(const API::MatrixWorkspace_sptr &outputWS) {
@@ -239,7 +257,7 @@ void AlignDetectors::exec() {
   // Get the input workspace
   MatrixWorkspace_sptr inputWS = getProperty("InputWorkspace");
 
-  this->getCalibrationWS(inputWS);
+  const auto converter = this->getConversionFactors(inputWS);
 
   // Initialise the progress reporting object
   m_numberOfSpectra = static_cast<int64_t>(inputWS->getNumberHistograms());
@@ -255,11 +273,9 @@ void AlignDetectors::exec() {
   // Set the final unit that our output workspace will have
   setXAxisUnits(outputWS);
 
-  ConversionFactors converter = ConversionFactors(m_calibrationWS);
-
   Progress progress(this, 0.0, 1.0, m_numberOfSpectra);
 
-  align(converter, progress, outputWS);
+  align(*converter, progress, outputWS);
 }
 
 void AlignDetectors::align(const ConversionFactors &converter, Progress &progress, MatrixWorkspace_sptr &outputWS) {
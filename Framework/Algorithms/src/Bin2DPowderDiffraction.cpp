@@ -24,6 +24,7 @@
 #include <algorithm>
 #include <fstream>
 #include <stdexcept>
+#include <utility>
 
 namespace Mantid::Algorithms {
 
@@ -227,7 +228,7 @@ MatrixWorkspace_sptr Bin2DPowderDiffraction::createOutputWorkspace() {
       if (evList.getEventType() == TOF)
         evList.switchTo(WEIGHTED);
 
-      std::vector<WeightedEvent> events = evList.getWeightedEvents();
+      const std::vector<WeightedEvent> &events = std::as_const(evList).getWeightedEvents();
 
       for (const auto &ev : events) {
         auto d = calcD(ev.tof(), sin_theta);
@@ -110,6 +110,11 @@ int compareEventLists(Kernel::Logger &logger, const EventList &el1, const EventL
   // Anything that gets this far is equal within tolerances
   return returnint;
 }
+/// True if two data arrays hold exactly the same values, in which case they
+/// are equal within any non-negative tolerance. Shared arrays are not scanned.
+template <typename T> bool exactlyEqual(const T &lhs, const T &rhs) {
+  return &lhs == &rhs || lhs.rawData() == rhs.rawData();
+}
 } // namespace
 
 /** Initialize the algorithm's properties.
@@ -467,15 +472,41 @@ bool CompareWorkspaces::compareEventWorkspaces(const DataObjects::EventWorkspace
     return false;
   }
 
+  if (!m_progress) {
+    throw std::runtime_error("The progress pointer was found to be null!");
+  }
+
+  // Event lists holding exactly the same events in the same order match
+  // within any tolerance, so only the others need to be sorted and compared
+  // in detail
+  const auto numHists = static_cast<int>(ews1.getNumberHistograms());
+  const double tolerance = getProperty("Tolerance");
+  std::vector<char> identical(numHists, 0);
+  if (tolerance >= 0.) {
+    PARALLEL_FOR_IF(m_parallelComparison && ews1.threadSafe() && ews2.threadSafe())
+    for (int i = 0; i < numHists; ++i) {
+      identical[i] = ews1.getSpectrum(i) == ews2.getSpectrum(i);
+      m_progress->report("EventLists");
+    }
+  } else {
+    m_progress->reportIncrement(numHists, "EventLists");
+  }
+  std::vector<int> differing;
+  for (int i = 0; i < numHists; ++i) {
+    if (!identical[i])
+      differing.emplace_back(i);
+  }
+  const auto numDiffering = static_cast<int>(differing.size());
+
   // why the hell are you called after progress initialisation......... that's
   // why it segfaults
   // Both will end up sorted anyway
-  ews1.sortAll(PULSETIMETOF_SORT, m_progress.get());
-  ews2.sortAll(PULSETIMETOF_SORT, m_progress.get());
-
-  if (!m_progress) {
-    throw std::runtime_error("The progress pointer was found to be null!");
+  PARALLEL_FOR_IF(m_parallelComparison && ews1.threadSafe() && ews2.threadSafe())
+  for (int i = 0; i < numDiffering; ++i) {
+    ews1.getSpectrum(differing[i]).sort(PULSETIMETOF_SORT);
+    ews2.getSpectrum(differing[i]).sort(PULSETIMETOF_SORT);
   }
+  m_progress->reportIncrement(numHists, "Sorting");
 
   // Determine the tolerance for "tof" attribute and "weight" of events
   double toleranceWeight = Tolerance; // Standard tolerance
@@ -502,9 +533,9 @@ bool CompareWorkspaces::compareEventWorkspaces(const DataObjects::EventWorkspace
 
   std::vector<int> vec_mismatchedwsindex;
   PARALLEL_FOR_IF(m_parallelComparison && ews1.threadSafe() && ews2.threadSafe())
-  for (int i = 0; i < static_cast<int>(ews1.getNumberHistograms()); ++i) {
+  for (int k = 0; k < numDiffering; ++k) {
     PARALLEL_START_INTERRUPT_REGION
-    m_progress->report("EventLists");
+    const int i = differing[k];
     if (!mismatchedEvent || checkallspectra) // This guard will avoid checking unnecessarily
     {
       const EventList &el1 = ews1.getSpectrum(i);
@@ -555,6 +586,7 @@ bool CompareWorkspaces::compareEventWorkspaces(const DataObjects::EventWorkspace
     PARALLEL_END_INTERRUPT_REGION
   }
   PARALLEL_CHECK_INTERRUPT_REGION
+  m_progress->reportIncrement(numHists, "EventLists");
 
   bool wsmatch;
   if (mismatchedEvent) {
@@ -631,6 +663,9 @@ bool CompareWorkspaces::checkData(const API::MatrixWorkspace_const_sptr &ws1,
 
   bool resultBool = true;
   bool logDebug = g_log.is(Logger::Priority::PRIO_DEBUG);
+  // Spectra with exactly the same values match within any tolerance and need
+  // no element by element comparison
+  const bool exactMatchSuffices = static_cast<double>(getProperty("Tolerance")) >= 0.;
 
   // Now check the data itself
   PARALLEL_FOR_IF(m_parallelComparison && ws1->threadSafe() && ws2->threadSafe())
@@ -653,6 +688,9 @@ bool CompareWorkspaces::checkData(const API::MatrixWorkspace_const_sptr &ws1,
         recordMismatch("Mismatch in spectra length");
         PARALLEL_CRITICAL(resultBool)
         resultBool = false;
+      } else if (exactMatchSuffices && exactlyEqual(X1, X2) && exactlyEqual(Y1, Y2) &&
+                 (!checkError || exactlyEqual(E1, E2))) {
+        // Identical spectra
       } else {
 
         for (int j = 0; j < static_cast<int>(Y1.size()); ++j) {
@@ -672,6 +710,9 @@ bool CompareWorkspaces::checkData(const API::MatrixWorkspace_const_sptr &ws1,
             }
             PARALLEL_CRITICAL(resultBool)
             resultBool = false;
+            // Only the result is needed, there is nothing more to report
+            if (!checkAllData && !logDebug)
+              break;
           }
         }
 
@@ -5,6 +5,7 @@
 //   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
 // SPDX - License - Identifier: GPL - 3.0 +
 #include "MantidAlgorithms/ConvertAxisByFormula.h"
+#include "MantidAPI/MuParserUtils.h"
 #include "MantidAPI/RefAxis.h"
 #include "MantidAPI/SpectraAxis.h"
 #include "MantidAPI/SpectrumInfo.h"
@@ -153,6 +154,7 @@ void ConvertAxisByFormula::exec() {
        << ". Muparser error message is: " << e.GetMsg();
     throw std::invalid_argument(ss.str());
   }
+  MuParserUtils::BulkEvaluator evaluator;
   if (isRefAxis) {
     if ((isRaggedBins) || (isGeometryRequired)) {
       // ragged bins or geometry used - we have to calculate for every spectra
@@ -165,7 +167,7 @@ void ConvertAxisByFormula::exec() {
         try {
           MantidVec &vec = outputWs->dataX(i);
           setGeometryValues(spectrumInfo, i, variables);
-          calculateValues(p, vec, variables);
+          calculateValues(p, evaluator, vec, variables);
         } catch (std::runtime_error &)
         // two possible exceptions runtime error and NotFoundError
         // both handled the same way
@@ -186,7 +188,7 @@ void ConvertAxisByFormula::exec() {
 
       // Calculate the new (common) X values
       MantidVec &vec = outputWs->dataX(0);
-      calculateValues(p, vec, variables);
+      calculateValues(p, evaluator, vec, variables);
 
       // copy xVals to every spectra
       auto numberOfSpectra_i = static_cast<int64_t>(outputWs->getNumberHistograms()); // cast to make openmp happy
@@ -203,9 +205,13 @@ void ConvertAxisByFormula::exec() {
     }
   } else {
     size_t axisLength = axisPtr->length();
+    std::vector<double> axisValues(axisLength);
     for (size_t i = 0; i < axisLength; ++i) {
-      setAxisValue(axisPtr->getValue(i), variables);
-      axisPtr->setValue(i, evaluateResult(p));
+      axisValues[i] = axisPtr->getValue(i);
+    }
+    calculateValues(p, evaluator, axisValues, variables);
+    for (size_t i = 0; i < axisLength; ++i) {
+      axisPtr->setValue(i, axisValues[i]);
     }
   }
 
@@ -235,19 +241,28 @@ void ConvertAxisByFormula::exec() {
   }
 }
 
-void ConvertAxisByFormula::setAxisValue(const double value, const std::vector<Variable_ptr> &variables) {
+/** Replace each value with the result of the formula, evaluated for all
+ * values at once. The geometry variables keep their current values.
+ * @param p The parser holding the formula
+ * @param evaluator Evaluates the formula over the whole vector
+ * @param vec The axis values, overwritten with the results
+ * @param variables The variables used by the formula
+ */
+void ConvertAxisByFormula::calculateValues(const mu::Parser &p, MuParserUtils::BulkEvaluator &evaluator,
+                                           MantidVec &vec, const std::vector<Variable_ptr> &variables) {
+  std::vector<std::string> axisVariables;
   for (const auto &variable : variables) {
     if (!variable->isGeometric) {
-      variable->value = value;
+      axisVariables.emplace_back(variable->name);
     }
   }
-}
-
-void ConvertAxisByFormula::calculateValues(mu::Parser &p, MantidVec &vec, std::vector<Variable_ptr> variables) {
-  MantidVec::iterator iter;
-  for (iter = vec.begin(); iter != vec.end(); ++iter) {
-    setAxisValue(*iter, variables);
-    *iter = evaluateResult(p);
+  try {
+    evaluator.evaluate(p, axisVariables, vec.data(), vec.data(), vec.size());
+  } catch (mu::Parser::exception_type &e) {
+    std::stringstream ss;
+    ss << "Failed while processing axis values"
+       << ". Muparser error message is: " << e.GetMsg();
+    throw std::invalid_argument(ss.str());
   }
 }
 
@@ -268,17 +283,4 @@ void ConvertAxisByFormula::setGeometryValues(const API::SpectrumInfo &specInfo,
   }
 }
 
-double ConvertAxisByFormula::evaluateResult(mu::Parser &p) {
-  double result;
-  try {
-    result = p.Eval();
-  } catch (mu::Parser::exception_type &e) {
-    std::stringstream ss;
-    ss << "Failed while processing axis values"
-       << ". Muparser error message is: " << e.GetMsg();
-    throw std::invalid_argument(ss.str());
-  }
-  return result;
-}
-
 } // namespace Mantid::Algorithms
@@ -11,6 +11,7 @@
 #include "MantidAPI/SpectrumInfo.h"
 #include "MantidAPI/WorkspaceUnitValidator.h"
 #include "MantidDataObjects/EventWorkspace.h"
+#include "MantidDataObjects/SpectrumUnitConverter.h"
 #include "MantidDataObjects/Workspace2D.h"
 #include "MantidDataObjects/WorkspaceCreation.h"
 #include "MantidGeometry/Instrument.h"
@@ -295,9 +296,7 @@ API::MatrixWorkspace_sptr ConvertUnits::setupOutputWorkspace(const API::MatrixWo
  *  @param outputWS The workspace
  */
 void ConvertUnits::storeEModeOnWorkspace(API::MatrixWorkspace_sptr outputWS) {
-  // Store the emode
-  const bool overwrite(true);
-  outputWS->mutableRun().addProperty("deltaE-mode", getPropertyValue("EMode"), overwrite);
+  SpectrumUnitConverter::storeEMode(*outputWS, DeltaEMode::fromString(getPropertyValue("EMode")));
 }
 
 /** Convert the workspace units according to a simple output = a * (input^b)
@@ -381,8 +380,6 @@ MatrixWorkspace_sptr ConvertUnits::convertViaTOF(Kernel::Unit_const_sptr fromUni
   double l1 = spectrumInfo.l1();
   g_log.debug() << "Source-sample distance: " << l1 << '\n';
 
-  int failedDetectorCount = 0;
-
   /// @todo No implementation for any of these in the geometry yet so using
   /// properties
   const std::string emodeStr = getProperty("EMode");
@@ -429,55 +426,19 @@ MatrixWorkspace_sptr ConvertUnits::convertViaTOF(Kernel::Unit_const_sptr fromUni
   EventWorkspace_sptr eventWS = std::dynamic_pointer_cast<EventWorkspace>(outputWS);
   assert(static_cast<bool>(eventWS) == m_inputEvents); // Sanity check
 
-  auto &outSpectrumInfo = outputWS->mutableSpectrumInfo();
+  SpectrumUnitConverter converter(*outputWS, *fromUnit, *outputUnit, emode, efixedProp);
   // Loop over the histograms (detector spectra)
   PARALLEL_FOR_IF(Kernel::threadSafe(*outputWS))
   for (int64_t i = 0; i < numberOfSpectra_i; ++i) {
     PARALLEL_START_INTERRUPT_REGION
-    double efixed = efixedProp;
-
-    // Now get the detector object for this histogram
-    /// @todo Don't yet consider hold-off (delta)
-    const double delta = 0.0;
-
-    auto localFromUnit = std::unique_ptr<Unit>(fromUnit->clone());
-    auto localOutputUnit = std::unique_ptr<Unit>(outputUnit->clone());
-
-    // TODO toTOF and fromTOF need to be reimplemented outside of kernel
-    UnitParametersMap pmap = {{UnitParams::delta, delta}};
-    if (efixedProp != EMPTY_DBL()) {
-      pmap[UnitParams::efixed] = efixed;
-    }
-    outSpectrumInfo.getDetectorValues(*fromUnit, *outputUnit, emode, signedTheta, i, pmap);
-    try {
-      localFromUnit->toTOF(outputWS->dataX(i), emptyVec, l1, emode, pmap);
-      // Convert from time-of-flight to the desired unit
-      localOutputUnit->fromTOF(outputWS->dataX(i), emptyVec, l1, emode, pmap);
-
-      // EventWorkspace part, modifying the EventLists.
-      if (m_inputEvents) {
-        eventWS->getSpectrum(i).convertUnitsViaTof(localFromUnit.get(), localOutputUnit.get());
-      }
-    } catch (std::runtime_error &) {
-      // Get to here if exception thrown in unit conversion eg when calculating
-      // distance to detector
-      failedDetectorCount++;
-      // Since you usually (always?) get to here when there's no attached
-      // detectors, this call is
-      // the same as just zeroing out the data (calling clearData on the
-      // spectrum)
-      outputWS->getSpectrum(i).clearData();
-      if (outSpectrumInfo.hasDetectors(i))
-        outSpectrumInfo.setMasked(i, true);
-    }
-
+    converter.convert(static_cast<size_t>(i));
     prog.report("Convert to " + m_outputUnit->unitID());
     PARALLEL_END_INTERRUPT_REGION
   } // loop over spectra
   PARALLEL_CHECK_INTERRUPT_REGION
 
-  if (failedDetectorCount != 0) {
-    g_log.warning() << "Unable to calculate sample-detector distance for " << failedDetectorCount
+  if (converter.numberOfFailedSpectra() != 0) {
+    g_log.warning() << "Unable to calculate sample-detector distance for " << converter.numberOfFailedSpectra()
                     << " spectra. Masking spectrum.\n";
   }
   if (m_inputEvents)
@@ -134,14 +134,21 @@ void DiffractionFocussing2::exec() {
   {                              // keep variables in relatively small scope
     std::vector<int> udet2group; // map from udet to group
     g_log.debug() << "(1) nGroups " << nGroups << "\n";
-    m_groupWS->makeDetectorIDToGroupVector(udet2group, nGroups);
+    // The map of a grouping file is kept with the grouping
+    const std::vector<int> *groups = &m_fileUdet2group;
+    if (m_groupWS == m_fileGroupWS) {
+      nGroups = m_fileNGroups;
+    } else {
+      m_groupWS->makeDetectorIDToGroupVector(udet2group, nGroups);
+      groups = &udet2group;
+    }
     if (nGroups <= 0)
       throw std::runtime_error("No groups were specified.");
     g_log.debug() << "(2) nGroups " << nGroups << "\n";
 
     // This finds the rebin parameters (used in both versions)
     // It also initializes the groupAtWorkspaceIndex[] array.
-    determineRebinParameters(udet2group);
+    determineRebinParameters(*groups);
   }
 
   size_t totalHistProcess = this->setupGroupToWSIndices();
@@ -634,7 +641,10 @@ void DiffractionFocussing2::determineRebinParameters(const std::vector<int> &ude
 }
 
 /**
- * Initialize the pointer to the grouping workspace based on input properties
+ * Initialize the pointer to the grouping workspace based on input properties.
+ * A grouping read from a file is kept, with its map from detector ID to group,
+ * so that an instance executed again, e.g. on each chunk of live data, reads
+ * the file only once for each instrument.
  */
 void DiffractionFocussing2::getGroupingWorkspace() {
   m_groupWS = getProperty("GroupingWorkspace");
@@ -642,12 +652,22 @@ void DiffractionFocussing2::getGroupingWorkspace() {
   // Do we need to read the grouping workspace from a file?
   if (!m_groupWS) {
     const std::string groupingFileName = getProperty("GroupingFileName");
+    const std::string key = groupingFileName + '\n' + m_matrixInputW->getInstrument()->getName();
+    if (m_fileGroupWS && key == m_groupingFileKey) {
+      g_log.debug() << "Using the grouping read from " << groupingFileName << " by the previous execution\n";
+      m_groupWS = m_fileGroupWS;
+      return;
+    }
     progress(0.01, "Reading grouping file");
     auto childAlg = createChildAlgorithm("CreateGroupingWorkspace");
     childAlg->setProperty("InputWorkspace", std::const_pointer_cast<MatrixWorkspace>(m_matrixInputW));
     childAlg->setProperty("OldCalFilename", groupingFileName);
     childAlg->executeAsChildAlg();
     m_groupWS = childAlg->getProperty("OutputWorkspace");
+
+    m_groupWS->makeDetectorIDToGroupVector(m_fileUdet2group, m_fileNGroups);
+    m_fileGroupWS = m_groupWS;
+    m_groupingFileKey = key;
   }
 }
 
@@ -23,6 +23,7 @@
 #include <algorithm>
 #include <fstream>
 #include <sstream>
+#include <utility>
 
 using namespace Mantid;
 using namespace Mantid::Kernel;
@@ -302,7 +303,7 @@ void ExportTimeSeriesLog::setupEventWorkspace(const size_t &start_index, const s
   outEventWS->sortAll(TOF_SORT, nullptr);
 
   // Now, create a default X-vector for histogramming, with just 2 bins.
-  std::vector<WeightedEventNoTime> &events = outEL.getWeightedEventsNoTime();
+  const std::vector<WeightedEventNoTime> &events = std::as_const(outEL).getWeightedEventsNoTime();
   outEventWS->setBinEdges(0, HistogramData::BinEdges{events.begin()->tof(), events.rbegin()->tof()});
 }
 
@@ -21,6 +21,7 @@
 #include "MantidIndexing/IndexInfo.h"
 #include "MantidKernel/ArrayProperty.h"
 #include "MantidKernel/ListValidator.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/PropertyWithValue.h"
 #include "MantidKernel/Unit.h"
 #include "MantidKernel/VectorHelper.h"
@@ -40,6 +41,52 @@ using namespace Geometry;
 using namespace DataObjects;
 using namespace RunCombinationOptions;
 
+namespace {
+/**
+ * Merge consecutive runs of events, each already sorted by time-of-flight, so
+ * that the whole vector is sorted. Neighbouring runs are merged pairwise, so
+ * k runs take log(k) passes over the events rather than a full sort.
+ * @param events :: the events to sort
+ * @param runEnds :: the offsets at which the runs start, followed by the end
+ * of the last run
+ */
+template <class T> void mergeSortedRuns(std::vector<T> &events, std::vector<size_t> runEnds) {
+  while (runEnds.size() > 2) {
+    std::vector<size_t> merged{runEnds.front()};
+    merged.reserve(runEnds.size() / 2 + 2);
+    for (size_t i = 0; i + 2 < runEnds.size(); i += 2) {
+      std::inplace_merge(events.begin() + runEnds[i], events.begin() + runEnds[i + 1], events.begin() + runEnds[i + 2]);
+      merged.emplace_back(runEnds[i + 2]);
+    }
+    // An odd run out is carried over to the next pass
+    if (runEnds.size() % 2 == 0)
+      merged.emplace_back(runEnds.back());
+    runEnds.swap(merged);
+  }
+}
+
+/**
+ * Sort an event list made of runs that are each sorted by time-of-flight.
+ * @param el :: the event list to sort
+ * @param runEnds :: the offsets at which the runs start, followed by the end
+ * of the last run
+ */
+void mergeSortedRuns(EventList &el, const std::vector<size_t> &runEnds) {
+  switch (el.getEventType()) {
+  case API::TOF:
+    mergeSortedRuns(el.getEvents(), runEnds);
+    break;
+  case API::WEIGHTED:
+    mergeSortedRuns(el.getWeightedEvents(), runEnds);
+    break;
+  case API::WEIGHTED_NOTIME:
+    mergeSortedRuns(el.getWeightedEventsNoTime(), runEnds);
+    break;
+  }
+  el.setSortOrder(TOF_SORT);
+}
+} // namespace
+
 /// Initialisation method
 void MergeRuns::init() {
   // declare arbitrary number of input workspaces as a list of strings at the
@@ -65,6 +112,10 @@ void MergeRuns::init() {
   declareProperty("FailBehaviour", SKIP_BEHAVIOUR, std::make_shared<StringListValidator>(failBehaviourOptions),
                   "Choose whether to skip the file and continue, or stop and "
                   "throw and error, when encountering a failure.");
+  declareProperty("SortEvents", false,
+                  "Only used for EventWorkspaces. If true, the merged event lists are sorted by "
+                  "time-of-flight. Lists that are already sorted in every input are merged "
+                  "without a full sort.");
 }
 
 // @return the name of the property used to supply in input workspace(s).
@@ -272,37 +323,79 @@ void MergeRuns::execEvent() {
   // Make the addition tables, or throw an error if there was a problem.
   this->buildAdditionTables();
 
-  // Create a new output event workspace, by copying the first WS in the list
+  // Invert the addition tables so that every output spectrum knows which
+  // input spectra are added into it, in the order of the inputs. The spectra
+  // that are not in the first workspace go at the end.
   EventWorkspace_sptr inputWS = m_inEventWS[0];
-  auto outWS = create<EventWorkspace>(*inputWS, m_outputSize, inputWS->binEdges(0));
   const auto inputSize = inputWS->getNumberHistograms();
+  std::vector<std::vector<std::pair<size_t, size_t>>> sources(m_outputSize);
   for (size_t i = 0; i < inputSize; ++i)
-    outWS->getSpectrum(i) = inputWS->getSpectrum(i);
-
-  int64_t n = m_inEventWS.size() - 1;
-  m_progress = std::make_unique<Progress>(this, 0.0, 1.0, n);
-
-  // Note that we start at 1, since we already have the 0th workspace
+    sources[i].emplace_back(0, i);
   auto current = inputSize;
   for (size_t workspaceNum = 1; workspaceNum < m_inEventWS.size(); workspaceNum++) {
-    const auto &addee = *m_inEventWS[workspaceNum];
-    const auto &table = m_tables[workspaceNum - 1];
-
-    // Add all the event lists together as the table says to do
-    for (auto &WI : table) {
-      int64_t inWI = WI.first;
-      int64_t outWI = WI.second;
-      if (outWI >= 0) {
-        outWS->getSpectrum(outWI) += addee.getSpectrum(inWI);
+    for (const auto &WI : m_tables[workspaceNum - 1]) {
+      if (WI.second >= 0) {
+        sources[WI.second].emplace_back(workspaceNum, WI.first);
       } else {
-        outWS->getSpectrum(current) = addee.getSpectrum(inWI);
+        sources[current].emplace_back(workspaceNum, WI.first);
         ++current;
       }
     }
+  }
+
+  // Create a new output event workspace, by copying the first WS in the list
+  auto outWS = create<EventWorkspace>(*inputWS, m_outputSize, inputWS->binEdges(0));
+  const bool sortEvents = getProperty("SortEvents");
+  m_progress = std::make_unique<Progress>(this, 0.0, 1.0, m_outputSize + m_inEventWS.size() - 1);
+
+  // Every output spectrum is built from its inputs in one go, which lets the
+  // spectra be merged independently and the events be reserved up front
+  PARALLEL_FOR_IF(Kernel::threadSafe(*outWS))
+  for (int64_t outWI = 0; outWI < static_cast<int64_t>(m_outputSize); ++outWI) {
+    PARALLEL_START_INTERRUPT_REGION
+    const auto &spectrumSources = sources[outWI];
+    auto &outEL = outWS->getSpectrum(outWI);
+    // Appending switches to the more general event type, so find the type
+    // that the output will end up as
+    auto eventType = API::TOF;
+    size_t numEvents = 0;
+    bool sourcesSorted = true;
+    for (const auto &source : spectrumSources) {
+      const auto &inEL = m_inEventWS[source.first]->getSpectrum(source.second);
+      eventType = std::max(eventType, inEL.getEventType());
+      numEvents += inEL.getNumberEvents();
+      sourcesSorted = sourcesSorted && inEL.getSortType() == TOF_SORT;
+    }
+
+    std::vector<size_t> runEnds{0};
+    runEnds.reserve(spectrumSources.size() + 1);
+    for (size_t i = 0; i < spectrumSources.size(); ++i) {
+      const auto &inEL = m_inEventWS[spectrumSources[i].first]->getSpectrum(spectrumSources[i].second);
+      if (i == 0) {
+        outEL = inEL;
+        outEL.switchTo(eventType);
+        outEL.reserve(numEvents);
+      } else {
+        outEL += inEL;
+      }
+      runEnds.emplace_back(outEL.getNumberEvents());
+    }
 
-    // Now we add up the runs
-    outWS->mutableRun() += addee.run();
+    if (sortEvents) {
+      if (sourcesSorted && spectrumSources.size() > 1) {
+        mergeSortedRuns(outEL, runEnds);
+      } else {
+        outEL.sortTof();
+      }
+    }
+    m_progress->report();
+    PARALLEL_END_INTERRUPT_REGION
+  }
+  PARALLEL_CHECK_INTERRUPT_REGION
 
+  // Now we add up the runs
+  for (size_t workspaceNum = 1; workspaceNum < m_inEventWS.size(); workspaceNum++) {
+    outWS->mutableRun() += m_inEventWS[workspaceNum]->run();
     m_progress->report();
   }
 
@@ -330,8 +330,10 @@ void Rebin::exec() {
       // Initialize progress reporting.
       Progress prog(this, 0.0, 1.0, histnumber);
 
-      bool useUnsortingHistogram = (rbParams.size() < 4) && !useReverseLog && power == 0.0;
-      g_log.information() << "Generating histogram without sorting=" << useUnsortingHistogram << "\n";
+      // Events are histogrammed without sorting them. A single linear or
+      // logarithmic step lets the bin be calculated from the step directly.
+      bool useStepHistogram = (rbParams.size() < 4) && !useReverseLog && power == 0.0;
+      g_log.information() << "Generating histogram from the bin step=" << useStepHistogram << "\n";
 
       // Go through all the histograms and set the data
       PARALLEL_FOR_IF(Kernel::threadSafe(*inputWS, *outputWS))
@@ -341,10 +343,10 @@ void Rebin::exec() {
         const EventList &el = eventInputWS->getSpectrum(i);
         MantidVec y_data, e_data;
         // The EventList takes care of histogramming.
-        if (useUnsortingHistogram)
+        if (useStepHistogram)
           el.generateHistogram(rbParams[1], XValues_new.rawData(), y_data, e_data);
         else
-          el.generateHistogram(XValues_new.rawData(), y_data, e_data);
+          el.generateHistogramWithoutSorting(XValues_new.rawData(), y_data, e_data);
 
         // Copy the data over.
         outputWS->mutableY(i) = y_data;
@@ -381,13 +383,27 @@ void Rebin::exec() {
 
     bool ignoreBinErrors = getProperty(PropertyNames::IGNR_BIN_ERR);
 
+    // When the spectra share their bin edges the overlaps with the new bins
+    // are computed once per thread and reused for every spectrum
+    const bool commonBins = inputWS->isCommonBins();
+    std::vector<std::unique_ptr<HistogramData::RebinWeights>> threadWeights(
+        static_cast<size_t>(PARALLEL_GET_MAX_THREADS));
+
     Progress prog(this, 0.0, 1.0, histnumber);
     PARALLEL_FOR_IF(Kernel::threadSafe(*inputWS, *outputWS))
     for (int hist = 0; hist < histnumber; ++hist) {
       PARALLEL_START_INTERRUPT_REGION
 
       try {
-        outputWS->setHistogram(hist, HistogramData::rebin(inputWS->histogram(hist), XValues_new));
+        const auto histogram = inputWS->histogram(hist);
+        if (commonBins) {
+          auto &weights = threadWeights[PARALLEL_THREAD_NUMBER];
+          if (!weights || !weights->appliesTo(histogram))
+            weights = std::make_unique<HistogramData::RebinWeights>(histogram.binEdges(), XValues_new);
+          outputWS->setHistogram(hist, weights->apply(histogram));
+        } else {
+          outputWS->setHistogram(hist, HistogramData::rebin(histogram, XValues_new));
+        }
       } catch (InvalidBinEdgesError &) {
         if (ignoreBinErrors)
           outputWS->setBinEdges(hist, XValues_new);
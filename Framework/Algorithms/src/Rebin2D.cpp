@@ -114,6 +114,9 @@ void Rebin2D::exec() {
   const auto nreports(static_cast<size_t>(numYBins));
   m_progress = std::make_unique<API::Progress>(this, 0.0, 1.0, nreports);
 
+  // Each thread accumulates into its own grid, summed into outputWS at the end
+  FractionalRebinning::PartialOutputs partialOutputs(*outputWS);
+
   PARALLEL_FOR_IF(Kernel::threadSafe(*inputWS, *outputWS))
   for (int64_t i = 0; i < static_cast<int64_t>(numYBins); ++i) {
     PARALLEL_START_INTERRUPT_REGION
@@ -129,15 +132,17 @@ void Rebin2D::exec() {
       const double x_jp1 = oldXEdges[j + 1];
       Quadrilateral inputQ(x_j, x_jp1, vlo, vhi);
       if (!useFractionalArea) {
-        FractionalRebinning::rebinToOutput(inputQ, inputWS, i, j, *outputWS, newYBins.rawData());
+        FractionalRebinning::rebinToOutput(inputQ, inputWS, i, j, partialOutputs, newYBins.rawData());
       } else {
-        FractionalRebinning::rebinToFractionalOutput(inputQ, inputWS, i, j, *outputRB, newYBins.rawData(), inputHasFA);
+        FractionalRebinning::rebinToFractionalOutput(inputQ, inputWS, i, j, partialOutputs, newYBins.rawData(),
+                                                     inputHasFA);
       }
     }
 
     PARALLEL_END_INTERRUPT_REGION
   }
   PARALLEL_CHECK_INTERRUPT_REGION
+  partialOutputs.addTo(*outputWS);
   if (useFractionalArea) {
     FractionalRebinning::finalizeFractionalRebin(*outputRB);
     outputRB->finalize(true);
@@ -353,6 +353,9 @@ void SofQWNormalisedPolygon::exec() {
   const auto &inputIndices = inputWS->indexInfo();
   const auto &spectrumInfo = inputWS->spectrumInfo();
 
+  // Each thread accumulates into its own grid, summed into outputWS at the end
+  FractionalRebinning::PartialOutputs partialOutputs(*outputWS);
+
   PARALLEL_FOR_IF(Kernel::threadSafe(*inputWS, *outputWS))
   for (int64_t i = 0; i < static_cast<int64_t>(nHistos); ++i) {
     PARALLEL_START_INTERRUPT_REGION
@@ -367,6 +370,7 @@ void SofQWNormalisedPolygon::exec() {
 
     const auto specNo = static_cast<specnum_t>(inputIndices.spectrumNumber(i));
     std::stringstream logStream;
+    std::vector<size_t> qIndices;
     for (size_t j = 0; j < nEnergyBins; ++j) {
       m_progress->report("Computing polygon intersections");
       // For each input polygon test where it intersects with
@@ -387,17 +391,23 @@ void SofQWNormalisedPolygon::exec() {
       }
 
       using FractionalRebinning::rebinToFractionalOutput;
-      rebinToFractionalOutput(Quadrilateral(ll, lr, ur, ul), inputWS, i, j, *outputWS, m_Qout);
+      rebinToFractionalOutput(Quadrilateral(ll, lr, ur, ul), inputWS, i, j, partialOutputs, m_Qout);
 
       // Find which q bin this point lies in
       const MantidVec::difference_type qIndex = std::upper_bound(m_Qout.begin(), m_Qout.end(), lrQ) - m_Qout.begin();
       if (qIndex != 0 && qIndex < static_cast<int>(m_Qout.size())) {
-        // Add this spectra-detector pair to the mapping
-        PARALLEL_CRITICAL(SofQWNormalisedPolygon_spectramap) {
-          // Could do a more complete merge of spectrum definitions here, but
-          // historically only the ID of the first detector in the spectrum is
-          // used, so I am keeping that for now.
-          detIDMapping[qIndex - 1].add(spectrumInfo.spectrumDefinition(i)[0].first);
+        qIndices.emplace_back(qIndex - 1);
+      }
+    }
+    if (!qIndices.empty()) {
+      // Add the spectra-detector pairs to the mapping
+      PARALLEL_CRITICAL(SofQWNormalisedPolygon_spectramap) {
+        // Could do a more complete merge of spectrum definitions here, but
+        // historically only the ID of the first detector in the spectrum is
+        // used, so I am keeping that for now.
+        const auto detectorIndex = spectrumInfo.spectrumDefinition(i)[0].first;
+        for (const auto qIndex : qIndices) {
+          detIDMapping[qIndex].add(detectorIndex);
         }
       }
     }
@@ -409,6 +419,7 @@ void SofQWNormalisedPolygon::exec() {
   }
   PARALLEL_CHECK_INTERRUPT_REGION
 
+  partialOutputs.addTo(*outputWS);
   FractionalRebinning::finalizeFractionalRebin(*outputWS);
   outputWS->finalize();
   FractionalRebinning::normaliseOutput(outputWS, inputWS, m_progress.get());
@@ -59,6 +59,9 @@ void SofQWPolygon::exec() {
   // Holds the spectrum-detector mapping
   std::vector<SpectrumDefinition> detIDMapping(outputWS->getNumberHistograms());
 
+  // Each thread accumulates into its own grid, summed into outputWS at the end
+  DataObjects::FractionalRebinning::PartialOutputs partialOutputs(*outputWS);
+
   PARALLEL_FOR_IF(Kernel::threadSafe(*inputWS, *outputWS))
   for (int64_t i = 0; i < static_cast<int64_t>(nTheta); ++i) // signed for openmp
   {
@@ -76,6 +79,7 @@ void SofQWPolygon::exec() {
     const double thetaLower = theta - halfWidth;
     const double thetaUpper = theta + halfWidth;
 
+    std::vector<size_t> qIndices;
     for (size_t j = 0; j < nenergyBins; ++j) {
       m_progress->report("Computing polygon intersections");
       // For each input polygon test where it intersects with
@@ -91,17 +95,23 @@ void SofQWPolygon::exec() {
       const V2D ul(dE_j, m_EmodeProperties.q(dE_j, thetaUpper, det));
       Quadrilateral inputQ = Quadrilateral(ll, lr, ur, ul);
 
-      DataObjects::FractionalRebinning::rebinToOutput(inputQ, inputWS, i, j, *outputWS, m_Qout);
+      DataObjects::FractionalRebinning::rebinToOutput(inputQ, inputWS, i, j, partialOutputs, m_Qout);
 
       // Find which q bin this point lies in
       const MantidVec::difference_type qIndex = std::upper_bound(m_Qout.begin(), m_Qout.end(), lrQ) - m_Qout.begin();
       if (qIndex != 0 && qIndex < static_cast<int>(m_Qout.size())) {
-        // Add this spectra-detector pair to the mapping
-        PARALLEL_CRITICAL(SofQWPolygon_spectramap) {
-          // Could do a more complete merge of spectrum definitions here, but
-          // historically only the ID of the first detector in the spectrum is
-          // used, so I am keeping that for now.
-          detIDMapping[qIndex - 1].add(spectrumInfo.spectrumDefinition(i)[0].first);
+        qIndices.emplace_back(qIndex - 1);
+      }
+    }
+    if (!qIndices.empty()) {
+      // Add the spectra-detector pairs to the mapping
+      PARALLEL_CRITICAL(SofQWPolygon_spectramap) {
+        // Could do a more complete merge of spectrum definitions here, but
+        // historically only the ID of the first detector in the spectrum is
+        // used, so I am keeping that for now.
+        const auto detectorIndex = spectrumInfo.spectrumDefinition(i)[0].first;
+        for (const auto qIndex : qIndices) {
+          detIDMapping[qIndex].add(detectorIndex);
         }
       }
     }
@@ -110,6 +120,7 @@ void SofQWPolygon::exec() {
   }
   PARALLEL_CHECK_INTERRUPT_REGION
 
+  partialOutputs.addTo(*outputWS);
   DataObjects::FractionalRebinning::normaliseOutput(outputWS, inputWS, m_progress.get());
 
   // Set the output spectrum-detector mapping
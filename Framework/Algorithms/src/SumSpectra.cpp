@@ -12,13 +12,16 @@
 #include "MantidAPI/WorkspaceGroup.h"
 #include "MantidDataObjects/EventWorkspace.h"
 #include "MantidDataObjects/RebinnedOutput.h"
+#include "MantidDataObjects/Workspace2D.h"
 #include "MantidDataObjects/WorkspaceCreation.h"
 #include "MantidGeometry/IDetector.h"
 #include "MantidKernel/ArrayProperty.h"
 #include "MantidKernel/BoundedValidator.h"
 #include "MantidKernel/EnabledWhenProperty.h"
+#include "MantidKernel/MultiThreaded.h"
 
 #include <functional>
+#include <numeric>
 
 namespace Mantid::Algorithms {
 
@@ -149,6 +152,11 @@ void SumSpectra::init() {
   declareProperty("UseFractionalArea", true,
                   "Normalize the output workspace to the fractional area for "
                   "RebinnedOutput workspaces.");
+
+  declareProperty("PreserveEvents", true,
+                  "Keep the output workspace as an EventWorkspace, if the input has events (default). "
+                  "If false, the events are histogrammed with the input binning while summing and the "
+                  "output is a Workspace2D.");
 }
 
 /*
@@ -217,9 +225,14 @@ void SumSpectra::exec() {
       g_log.warning("Ignoring request for WeightedSum");
       m_calculateWeightedSum = false;
     }
-    outputWorkspace = create<EventWorkspace>(*eventW, 1, eventW->binEdges(0));
-
-    execEvent(outputWorkspace, progress, numSpectra, numMasked, numZeros);
+    const bool preserveEvents = getProperty("PreserveEvents");
+    if (preserveEvents) {
+      outputWorkspace = create<EventWorkspace>(*eventW, 1, eventW->binEdges(0));
+      execEvent(outputWorkspace, progress, numSpectra, numMasked, numZeros);
+    } else {
+      outputWorkspace = create<Workspace2D>(*eventW, 1, eventW->binEdges(0));
+      execEventHistogram(outputWorkspace, progress, numSpectra, numMasked, numZeros);
+    }
   } else {
     //-------Workspace 2D mode -----
 
@@ -384,6 +397,64 @@ bool useSpectrum(const SpectrumInfo &spectrumInfo, const size_t wsIndex, const b
   }
   return true;
 }
+
+/// The workspace indices that pass useSpectrum, in increasing order
+std::vector<size_t> spectraToSum(const std::set<size_t> &indices, const SpectrumInfo &spectrumInfo,
+                                 const bool keepMonitors, size_t &numMasked) {
+  std::vector<size_t> result;
+  result.reserve(indices.size());
+  std::copy_if(indices.cbegin(), indices.cend(), std::back_inserter(result), [&](const size_t wsIndex) {
+    return useSpectrum(spectrumInfo, wsIndex, keepMonitors, numMasked);
+  });
+  return result;
+}
+
+/**
+ * Split the spectra to sum into contiguous blocks that are each summed by a single thread.
+ * The split does not depend on the number of threads, so the partial sums are always added
+ * up in the same order and the result does not change from run to run.
+ * @param numIndices The number of spectra to sum
+ * @return The [begin, end) positions of each block
+ */
+std::vector<std::pair<size_t, size_t>> splitIntoBlocks(const size_t numIndices) {
+  constexpr size_t MIN_BLOCK_SIZE{64};
+  constexpr size_t MAX_NUM_BLOCKS{64};
+  const size_t blockSize = std::max(MIN_BLOCK_SIZE, (numIndices + MAX_NUM_BLOCKS - 1) / MAX_NUM_BLOCKS);
+  std::vector<std::pair<size_t, size_t>> blocks;
+  for (size_t begin = 0; begin < numIndices; begin += blockSize)
+    blocks.emplace_back(begin, std::min(begin + blockSize, numIndices));
+  return blocks;
+}
+
+/// Thread-local accumulators for one block of spectra
+struct PartialSum {
+  PartialSum(const size_t length, const bool weighted, const bool fractional)
+      : y(length, 0.), e(length, 0.), weight(weighted ? length : 0, 0.), nZeros(weighted ? length : 0, 0),
+        frac(fractional ? length : 0, 0.) {}
+  std::vector<double> y;
+  std::vector<double> e;
+  std::vector<double> weight;
+  std::vector<size_t> nZeros;
+  std::vector<double> frac;
+};
+
+template <typename Container, typename Values> void addValues(Container &sum, const Values &values) {
+  std::transform(sum.begin(), sum.end(), values.begin(), sum.begin(), std::plus<>());
+}
+
+/// Add the partial sums, in block order, into the output arrays
+template <typename YContainer, typename EContainer>
+void mergePartialSums(const std::vector<PartialSum> &partialSums, YContainer &ySum, EContainer &eSum,
+                      std::vector<double> &weight, std::vector<size_t> &nZeros) {
+  for (const auto &partialSum : partialSums) {
+    addValues(ySum, partialSum.y);
+    addValues(eSum, partialSum.e);
+    if (!weight.empty()) {
+      addValues(weight, partialSum.weight);
+      addValues(nZeros, partialSum.nZeros);
+    }
+  }
+}
 } // anonymous namespace
 
 /**
@@ -401,6 +472,45 @@ void SumSpectra::doSimpleSum(const MatrixWorkspace_sptr &outputWorkspace, Progre
   // Clean workspace of any NANs or Inf values
   auto localworkspace = replaceSpecialValues();
 
+  const auto indices = spectraToSum(m_indices, localworkspace->spectrumInfo(), m_keepMonitors, numMasked);
+  numSpectra += indices.size();
+
+  // Sum blocks of spectra in parallel then add up the partial sums
+  const auto blocks = splitIntoBlocks(indices.size());
+  std::vector<PartialSum> partialSums(blocks.size(), PartialSum(m_yLength, m_calculateWeightedSum, false));
+  PARALLEL_FOR_IF(Kernel::threadSafe(*localworkspace))
+  for (int block = 0; block < static_cast<int>(blocks.size()); ++block) {
+    PARALLEL_START_INTERRUPT_REGION
+    auto &sum = partialSums[block];
+    for (size_t i = blocks[block].first; i < blocks[block].second; ++i) {
+      const auto &YValues = localworkspace->y(indices[i]);
+      const auto &YErrors = localworkspace->e(indices[i]);
+
+      if (m_calculateWeightedSum) {
+        // Retrieve the spectrum into a vector
+        for (size_t yIndex = 0; yIndex < m_yLength; ++yIndex) {
+          const double yErrorsVal = YErrors[yIndex];
+          if (std::isnormal(yErrorsVal)) { // is non-zero, nan, or infinity
+            const double errsq = yErrorsVal * yErrorsVal;
+            sum.e[yIndex] += errsq;
+            sum.weight[yIndex] += 1. / errsq;
+            sum.y[yIndex] += YValues[yIndex] / errsq;
+          } else {
+            sum.nZeros[yIndex]++;
+          }
+        }
+      } else {
+        addValues(sum.y, YValues);
+        std::transform(sum.e.begin(), sum.e.end(), YErrors.begin(), sum.e.begin(),
+                       [](const double accum, const double yerrorSpec) { return accum + yerrorSpec * yerrorSpec; });
+      }
+
+      progress.report();
+    }
+    PARALLEL_END_INTERRUPT_REGION
+  }
+  PARALLEL_CHECK_INTERRUPT_REGION
+
   // Get references to the output workspaces's data vectors
   auto &outSpec = outputWorkspace->getSpectrum(0);
   auto &YSum = outSpec.mutableY();
@@ -412,42 +522,12 @@ void SumSpectra::doSimpleSum(const MatrixWorkspace_sptr &outputWorkspace, Progre
     Weight.assign(YSum.size(), 0.);
     nZeros.assign(YSum.size(), 0);
   }
+  mergePartialSums(partialSums, YSum, YErrorSum, Weight, nZeros);
 
-  const auto &spectrumInfo = localworkspace->spectrumInfo();
-  // Loop over spectra
-  for (const auto wsIndex : m_indices) {
-    if (!useSpectrum(spectrumInfo, wsIndex, m_keepMonitors, numMasked))
-      continue;
-    numSpectra++;
-
-    const auto &YValues = localworkspace->y(wsIndex);
-    const auto &YErrors = localworkspace->e(wsIndex);
-
-    if (m_calculateWeightedSum) {
-      // Retrieve the spectrum into a vector
-      for (size_t yIndex = 0; yIndex < m_yLength; ++yIndex) {
-        const double yErrorsVal = YErrors[yIndex];
-        if (std::isnormal(yErrorsVal)) { // is non-zero, nan, or infinity
-          const double errsq = yErrorsVal * yErrorsVal;
-          YErrorSum[yIndex] += errsq;
-          Weight[yIndex] += 1. / errsq;
-          YSum[yIndex] += YValues[yIndex] / errsq;
-        } else {
-          nZeros[yIndex]++;
-        }
-      }
-    } else {
-      YSum += YValues;
-      std::transform(YErrorSum.begin(), YErrorSum.end(), YErrors.begin(), YErrorSum.begin(),
-                     [](const double accum, const double yerrorSpec) { return accum + yerrorSpec * yerrorSpec; });
-    }
-
-    // Map all the detectors onto the spectrum of the output
+  // Map all the detectors onto the spectrum of the output
+  for (const auto wsIndex : indices)
     outSpec.addDetectorIDs(localworkspace->getSpectrum(wsIndex).getDetectorIDs());
 
-    progress.report();
-  }
-
   if (m_calculateWeightedSum) {
     numZeros = applyWeight(numSpectra, YSum, Weight, nZeros, m_multiplyByNumSpec);
   } else {
@@ -480,6 +560,51 @@ void SumSpectra::doFractionalSum(const MatrixWorkspace_sptr &outputWorkspace, Pr
   // the output is unfinalized
   auto isFinalized = inWS->isFinalized();
 
+  const auto indices = spectraToSum(m_indices, localworkspace->spectrumInfo(), m_keepMonitors, numMasked);
+  numSpectra += indices.size();
+
+  // Sum blocks of spectra in parallel then add up the partial sums
+  const auto blocks = splitIntoBlocks(indices.size());
+  std::vector<PartialSum> partialSums(blocks.size(), PartialSum(m_yLength, m_calculateWeightedSum, true));
+  PARALLEL_FOR_IF(Kernel::threadSafe(*localworkspace))
+  for (int block = 0; block < static_cast<int>(blocks.size()); ++block) {
+    PARALLEL_START_INTERRUPT_REGION
+    auto &sum = partialSums[block];
+    for (size_t i = blocks[block].first; i < blocks[block].second; ++i) {
+      // Retrieve the spectrum into a vector
+      const auto &YValues = localworkspace->y(indices[i]);
+      const auto &YErrors = localworkspace->e(indices[i]);
+      const auto &FracArea = inWS->readF(indices[i]);
+
+      if (m_calculateWeightedSum) {
+        for (size_t yIndex = 0; yIndex < m_yLength; ++yIndex) {
+          const double yErrorsVal = YErrors[yIndex];
+          const double fracVal = (isFinalized ? FracArea[yIndex] : 1.0);
+          if (std::isnormal(yErrorsVal)) { // is non-zero, nan, or infinity
+            const double errsq = yErrorsVal * yErrorsVal * fracVal * fracVal;
+            sum.e[yIndex] += errsq;
+            sum.weight[yIndex] += 1. / errsq;
+            sum.y[yIndex] += YValues[yIndex] * fracVal / errsq;
+          } else {
+            sum.nZeros[yIndex]++;
+          }
+        }
+      } else {
+        for (size_t yIndex = 0; yIndex < m_yLength; ++yIndex) {
+          const double fracVal = (isFinalized ? FracArea[yIndex] : 1.0);
+          sum.y[yIndex] += YValues[yIndex] * fracVal;
+          sum.e[yIndex] += YErrors[yIndex] * YErrors[yIndex] * fracVal * fracVal;
+        }
+      }
+      // accumulation of fractional weight is the same
+      addValues(sum.frac, FracArea);
+
+      progress.report();
+    }
+    PARALLEL_END_INTERRUPT_REGION
+  }
+  PARALLEL_CHECK_INTERRUPT_REGION
+
   // Get references to the output workspaces's data vectors
   auto &outSpec = outputWorkspace->getSpectrum(0);
   auto &YSum = outSpec.mutableY();
@@ -492,48 +617,14 @@ void SumSpectra::doFractionalSum(const MatrixWorkspace_sptr &outputWorkspace, Pr
     Weight.assign(YSum.size(), 0);
     nZeros.assign(YSum.size(), 0);
   }
+  mergePartialSums(partialSums, YSum, YErrorSum, Weight, nZeros);
+  for (const auto &partialSum : partialSums)
+    addValues(FracSum, partialSum.frac);
 
-  const auto &spectrumInfo = localworkspace->spectrumInfo();
-  // Loop over spectra
-  for (const auto wsIndex : m_indices) {
-    if (!useSpectrum(spectrumInfo, wsIndex, m_keepMonitors, numMasked))
-      continue;
-    numSpectra++;
-
-    // Retrieve the spectrum into a vector
-    const auto &YValues = localworkspace->y(wsIndex);
-    const auto &YErrors = localworkspace->e(wsIndex);
-    const auto &FracArea = inWS->readF(wsIndex);
-
-    if (m_calculateWeightedSum) {
-      for (size_t yIndex = 0; yIndex < m_yLength; ++yIndex) {
-        const double yErrorsVal = YErrors[yIndex];
-        const double fracVal = (isFinalized ? FracArea[yIndex] : 1.0);
-        if (std::isnormal(yErrorsVal)) { // is non-zero, nan, or infinity
-          const double errsq = yErrorsVal * yErrorsVal * fracVal * fracVal;
-          YErrorSum[yIndex] += errsq;
-          Weight[yIndex] += 1. / errsq;
-          YSum[yIndex] += YValues[yIndex] * fracVal / errsq;
-        } else {
-          nZeros[yIndex]++;
-        }
-      }
-    } else {
-      for (size_t yIndex = 0; yIndex < m_yLength; ++yIndex) {
-        const double fracVal = (isFinalized ? FracArea[yIndex] : 1.0);
-        YSum[yIndex] += YValues[yIndex] * fracVal;
-        YErrorSum[yIndex] += YErrors[yIndex] * YErrors[yIndex] * fracVal * fracVal;
-      }
-    }
-    // accumulation of fractional weight is the same
-    std::transform(FracSum.begin(), FracSum.end(), FracArea.begin(), FracSum.begin(), std::plus<double>());
-
-    // Map all the detectors onto the spectrum of the output
+  // Map all the detectors onto the spectrum of the output
+  for (const auto wsIndex : indices)
     outSpec.addDetectorIDs(localworkspace->getSpectrum(wsIndex).getDetectorIDs());
 
-    progress.report();
-  }
-
   if (m_calculateWeightedSum) {
     numZeros = applyWeight(numSpectra, YSum, Weight, nZeros, m_multiplyByNumSpec);
   } else {
@@ -567,30 +658,121 @@ void SumSpectra::execEvent(const MatrixWorkspace_sptr &outputWorkspace, Progress
   outputEL.setSpectrumNo(m_outSpecNum);
   outputEL.clearDetectorIDs();
 
-  const auto &spectrumInfo = inputWorkspace->spectrumInfo();
-  // Loop over spectra
-  for (const auto i : m_indices) {
-    if (spectrumInfo.hasDetectors(i)) {
-      // Skip monitors, if the property is set to do so
-      if (!m_keepMonitors && spectrumInfo.isMonitor(i))
-        continue;
-      // Skip masked detectors
-      if (spectrumInfo.isMasked(i)) {
-        numMasked++;
-        continue;
-      }
+  const auto indices = spectraToSum(m_indices, inputWorkspace->spectrumInfo(), m_keepMonitors, numMasked);
+  numSpectra += indices.size();
+
+  // Append blocks of event lists in parallel, then append the blocks in order
+  // so the events end up in the same order as adding the lists one by one
+  const auto blocks = splitIntoBlocks(indices.size());
+  std::vector<EventList> partialLists(blocks.size());
+  std::vector<size_t> partialZeros(blocks.size(), 0);
+  PARALLEL_FOR_IF(Kernel::threadSafe(*inputWorkspace))
+  for (int block = 0; block < static_cast<int>(blocks.size()); ++block) {
+    PARALLEL_START_INTERRUPT_REGION
+    auto &partialList = partialLists[block];
+    // adding a list can only make the event type more general, so switch to the final type up front and reserve
+    auto eventType = partialList.getEventType();
+    size_t numEvents{0};
+    for (size_t i = blocks[block].first; i < blocks[block].second; ++i) {
+      const EventList &inputEL = inputWorkspace->getSpectrum(indices[i]);
+      if (!inputEL.empty())
+        eventType = std::max(eventType, inputEL.getEventType());
+      numEvents += inputEL.getNumberEvents();
     }
-    numSpectra++;
+    partialList.switchTo(eventType);
+    partialList.reserve(numEvents);
+
+    for (size_t i = blocks[block].first; i < blocks[block].second; ++i) {
+      // Add the event lists with the operator
+      const EventList &inputEL = inputWorkspace->getSpectrum(indices[i]);
+      if (inputEL.empty()) {
+        ++partialZeros[block];
+      }
+      partialList += inputEL;
 
-    // Add the event lists with the operator
-    const EventList &inputEL = inputWorkspace->getSpectrum(i);
-    if (inputEL.empty()) {
-      ++numZeros;
+      progress.report();
     }
-    outputEL += inputEL;
+    PARALLEL_END_INTERRUPT_REGION
+  }
+  PARALLEL_CHECK_INTERRUPT_REGION
+
+  auto eventType = outputEL.getEventType();
+  size_t numEvents{0};
+  for (const auto &partialList : partialLists) {
+    if (!partialList.empty())
+      eventType = std::max(eventType, partialList.getEventType());
+    numEvents += partialList.getNumberEvents();
+  }
+  outputEL.switchTo(eventType);
+  outputEL.reserve(numEvents);
+  for (auto &partialList : partialLists) {
+    outputEL += partialList;
+    partialList.clear();
+  }
+  numZeros += std::accumulate(partialZeros.cbegin(), partialZeros.cend(), size_t(0));
+}
+
+/** Sum the events directly into a histogram with the binning of the input.
+ * The combined event list is never created.
+ * @param outputWorkspace the workspace to hold the summed input
+ * @param progress the progress indicator
+ * @param numSpectra The number of spectra contributed to the sum.
+ * @param numMasked The spectra dropped from the summations because they are
+ * masked.
+ * @param numZeros The number of empty spectra.
+ */
+void SumSpectra::execEventHistogram(const MatrixWorkspace_sptr &outputWorkspace, Progress &progress,
+                                    size_t &numSpectra, size_t &numMasked, size_t &numZeros) {
+  MatrixWorkspace_const_sptr localworkspace = getProperty("InputWorkspace");
+  EventWorkspace_const_sptr inputWorkspace = std::dynamic_pointer_cast<const EventWorkspace>(localworkspace);
 
-    progress.report();
+  auto &outSpec = outputWorkspace->getSpectrum(0);
+  outSpec.setSpectrumNo(m_outSpecNum);
+  outSpec.clearDetectorIDs();
+
+  const auto indices = spectraToSum(m_indices, inputWorkspace->spectrumInfo(), m_keepMonitors, numMasked);
+  numSpectra += indices.size();
+
+  // Histogram blocks of event lists in parallel then add up the partial sums
+  const auto &binEdges = inputWorkspace->x(0).rawData();
+  const auto blocks = splitIntoBlocks(indices.size());
+  std::vector<PartialSum> partialSums(blocks.size(), PartialSum(m_yLength, false, false));
+  std::vector<size_t> partialZeros(blocks.size(), 0);
+  PARALLEL_FOR_IF(Kernel::threadSafe(*inputWorkspace))
+  for (int block = 0; block < static_cast<int>(blocks.size()); ++block) {
+    PARALLEL_START_INTERRUPT_REGION
+    auto &sum = partialSums[block];
+    MantidVec Ytemp;
+    MantidVec Etemp;
+    for (size_t i = blocks[block].first; i < blocks[block].second; ++i) {
+      const EventList &inputEL = inputWorkspace->getSpectrum(indices[i]);
+      if (inputEL.empty()) {
+        ++partialZeros[block];
+      } else {
+        inputEL.generateHistogram(binEdges, Ytemp, Etemp);
+        addValues(sum.y, Ytemp);
+        std::transform(sum.e.begin(), sum.e.end(), Etemp.begin(), sum.e.begin(),
+                       [](const double accum, const double error) { return accum + error * error; });
+      }
+
+      progress.report();
+    }
+    PARALLEL_END_INTERRUPT_REGION
   }
+  PARALLEL_CHECK_INTERRUPT_REGION
+
+  auto &YSum = outSpec.mutableY();
+  auto &YErrorSum = outSpec.mutableE();
+  std::vector<double> unusedWeight;
+  std::vector<size_t> unusedZeros;
+  mergePartialSums(partialSums, YSum, YErrorSum, unusedWeight, unusedZeros);
+  std::transform(YErrorSum.begin(), YErrorSum.end(), YErrorSum.begin(), (double (*)(double))std::sqrt);
+
+  // Map all the detectors onto the spectrum of the output
+  for (const auto wsIndex : indices)
+    outSpec.addDetectorIDs(inputWorkspace->getSpectrum(wsIndex).getDetectorIDs());
+
+  numZeros += std::accumulate(partialZeros.cbegin(), partialZeros.cend(), size_t(0));
 }
 
 } // namespace Mantid::Algorithms
@@ -162,6 +162,39 @@ public:
                       WS->getSpectrum(wkspIndex).getEvents()[0].tof());
   }
 
+  void test_executing_again_gives_the_same_result_as_a_new_instance() {
+    // e.g. a processing algorithm that is reused for each chunk of live data
+    AlignDetectors reused;
+    reused.initialize();
+    reused.setChild(true);
+    reused.setPropertyValue("CalibrationFile", "refl_fake.cal");
+    reused.setPropertyValue("OutputWorkspace", "unused_for_child");
+
+    for (int chunk = 0; chunk < 2; ++chunk) {
+      EventWorkspace_sptr chunkWS = WorkspaceCreationHelper::createEventWorkspaceWithFullInstrument(1, 10, false);
+      chunkWS->getAxis(0)->setUnit("TOF");
+      reused.setProperty("InputWorkspace", MatrixWorkspace_sptr(chunkWS->clone()));
+      TS_ASSERT_THROWS_NOTHING(reused.execute());
+      TS_ASSERT(reused.isExecuted());
+      MatrixWorkspace_sptr reusedOutput = reused.getProperty("OutputWorkspace");
+
+      AlignDetectors fresh;
+      fresh.initialize();
+      fresh.setChild(true);
+      fresh.setProperty<MatrixWorkspace_sptr>("InputWorkspace", chunkWS);
+      fresh.setPropertyValue("CalibrationFile", "refl_fake.cal");
+      fresh.setPropertyValue("OutputWorkspace", "unused_for_child");
+      TS_ASSERT_THROWS_NOTHING(fresh.execute());
+      MatrixWorkspace_sptr freshOutput = fresh.getProperty("OutputWorkspace");
+
+      auto reusedEvents = std::dynamic_pointer_cast<EventWorkspace>(reusedOutput);
+      auto freshEvents = std::dynamic_pointer_cast<EventWorkspace>(freshOutput);
+      TS_ASSERT_EQUALS(reusedEvents->getNumberHistograms(), freshEvents->getNumberHistograms());
+      for (size_t i = 0; i < freshEvents->getNumberHistograms(); ++i)
+        TS_ASSERT_EQUALS(reusedEvents->getSpectrum(i).getTofs(), freshEvents->getSpectrum(i).getTofs());
+    }
+  }
+
 private:
   AlignDetectors align;
   std::string inputWS;
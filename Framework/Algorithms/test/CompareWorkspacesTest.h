@@ -471,6 +471,39 @@ public:
     TS_ASSERT((!Mantid::API::equals(ews1, ews2)));
   }
 
+  void testEvent_sameEventsInDifferentOrder_matches() {
+    Mantid::Algorithms::CompareWorkspaces alg;
+    alg.initialize();
+    EventWorkspace_sptr ews1 = WorkspaceCreationHelper::createEventWorkspace(10, 20, 30);
+    EventWorkspace_sptr ews2 = WorkspaceCreationHelper::createEventWorkspace(10, 20, 30);
+    // Reverse the events of every other spectrum so only those need sorting
+    for (size_t i = 0; i < ews2->getNumberHistograms(); i += 2) {
+      auto &eventList = ews2->getSpectrum(i);
+      auto &events = eventList.getEvents();
+      std::reverse(events.begin(), events.end());
+      eventList.setSortOrder(UNSORTED);
+    }
+    alg.setProperty("Workspace1", std::dynamic_pointer_cast<MatrixWorkspace>(ews1));
+    alg.setProperty("Workspace2", std::dynamic_pointer_cast<MatrixWorkspace>(ews2));
+    TS_ASSERT(alg.execute());
+    TS_ASSERT_EQUALS(alg.getPropertyValue("Result"), PROPERTY_VALUE_TRUE);
+  }
+
+  void testEvent_differentEventTofsWithinTolerance_matches() {
+    Mantid::Algorithms::CompareWorkspaces alg;
+    alg.initialize();
+    EventWorkspace_sptr ews1 = WorkspaceCreationHelper::createEventWorkspace(10, 20, 30);
+    EventWorkspace_sptr ews2 = WorkspaceCreationHelper::createEventWorkspace(10, 20, 30);
+    // Shift the first event of the last spectrum by less than the TOF tolerance
+    auto &event = ews2->getSpectrum(9).getEvents().front();
+    event = Mantid::Types::Event::TofEvent(event.tof() + 0.01, event.pulseTime());
+    alg.setProperty("Workspace1", std::dynamic_pointer_cast<MatrixWorkspace>(ews1));
+    alg.setProperty("Workspace2", std::dynamic_pointer_cast<MatrixWorkspace>(ews2));
+    alg.setProperty("Tolerance", 0.1);
+    TS_ASSERT(alg.execute());
+    TS_ASSERT_EQUALS(alg.getPropertyValue("Result"), PROPERTY_VALUE_TRUE);
+  }
+
   void testMDEvents_matches() {
     if (!checker.isInitialized())
       checker.initialize();
@@ -664,6 +697,20 @@ public:
     checker.resetProperties();
   }
 
+  void testMatchesWithNaNs() {
+    Mantid::Algorithms::CompareWorkspaces alg;
+    alg.initialize();
+    auto ws = WorkspaceCreationHelper::create2DWorkspace123(2, 2);
+    ws->mutableY(1)[0] = std::numeric_limits<double>::quiet_NaN();
+    auto copy = ws->clone();
+    // Unshare the data so the values are compared
+    copy->mutableY(1)[1] = ws->y(1)[1];
+    alg.setProperty("Workspace1", ws);
+    alg.setProperty("Workspace2", MatrixWorkspace_sptr(std::move(copy)));
+    TS_ASSERT(alg.execute());
+    TS_ASSERT_EQUALS(alg.getPropertyValue("Result"), PROPERTY_VALUE_TRUE);
+  }
+
   void testDifferentSize() {
     if (!checker.isInitialized())
       checker.initialize();
@@ -1452,3 +1499,37 @@ private:
   Mantid::Algorithms::CompareWorkspaces checker;
   const Mantid::API::MatrixWorkspace_sptr ws1;
 };
+
+class CompareWorkspacesTestPerformance : public CxxTest::TestSuite {
+public:
+  static CompareWorkspacesTestPerformance *createSuite() { return new CompareWorkspacesTestPerformance(); }
+  static void destroySuite(CompareWorkspacesTestPerformance *suite) { delete suite; }
+
+  CompareWorkspacesTestPerformance()
+      : m_histo1(WorkspaceCreationHelper::create2DWorkspaceBinned(10000, 2000)),
+        m_histo2(WorkspaceCreationHelper::create2DWorkspaceBinned(10000, 2000)),
+        m_events1(WorkspaceCreationHelper::createEventWorkspace(2000, 100, 2000)),
+        m_events2(WorkspaceCreationHelper::createEventWorkspace(2000, 100, 2000)) {
+    FrameworkManager::Instance();
+  }
+
+  void test_matching_histogram_workspaces() { runComparison(m_histo1, m_histo2); }
+
+  void test_matching_event_workspaces() { runComparison(m_events1, m_events2); }
+
+private:
+  void runComparison(const MatrixWorkspace_sptr &lhs, const MatrixWorkspace_sptr &rhs) {
+    Mantid::Algorithms::CompareWorkspaces alg;
+    alg.initialize();
+    alg.setProperty("Workspace1", lhs);
+    alg.setProperty("Workspace2", rhs);
+    alg.setProperty("CheckInstrument", false);
+    TS_ASSERT(alg.execute());
+    TS_ASSERT_EQUALS(alg.getPropertyValue("Result"), PROPERTY_VALUE_TRUE);
+  }
+
+  MatrixWorkspace_sptr m_histo1;
+  MatrixWorkspace_sptr m_histo2;
+  MatrixWorkspace_sptr m_events1;
+  MatrixWorkspace_sptr m_events2;
+};
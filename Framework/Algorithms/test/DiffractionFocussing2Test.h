@@ -78,6 +78,51 @@ public:
     AnalysisDataService::Instance().remove("focusedWS");
   }
 
+  void test_executing_again_gives_the_same_result_as_a_new_instance() {
+    // e.g. a processing algorithm that is reused for each chunk of live data
+    Mantid::DataHandling::LoadNexus loader;
+    loader.initialize();
+    loader.setChild(true);
+    loader.setPropertyValue("Filename", "HRP38692a.nxs");
+    loader.setPropertyValue("OutputWorkspace", "unused_for_child");
+    loader.execute();
+    Workspace_sptr loaded = loader.getProperty("OutputWorkspace");
+
+    Mantid::Algorithms::AlignDetectors align;
+    align.initialize();
+    align.setChild(true);
+    align.setProperty("InputWorkspace", std::dynamic_pointer_cast<MatrixWorkspace>(loaded));
+    align.setPropertyValue("OutputWorkspace", "unused_for_child");
+    align.setPropertyValue("CalibrationFile", "hrpd_new_072_01.cal");
+    align.execute();
+    MatrixWorkspace_sptr aligned = align.getProperty("OutputWorkspace");
+
+    DiffractionFocussing2 reused;
+    reused.initialize();
+    reused.setChild(true);
+    reused.setPropertyValue("GroupingFileName", "hrpd_new_072_01.cal");
+    reused.setPropertyValue("OutputWorkspace", "unused_for_child");
+    for (int chunk = 0; chunk < 2; ++chunk) {
+      reused.setProperty("InputWorkspace", MatrixWorkspace_sptr(aligned->clone()));
+      TS_ASSERT_THROWS_NOTHING(reused.execute());
+      TS_ASSERT(reused.isExecuted());
+      MatrixWorkspace_sptr reusedOutput = reused.getProperty("OutputWorkspace");
+
+      DiffractionFocussing2 fresh;
+      fresh.initialize();
+      fresh.setChild(true);
+      fresh.setProperty("InputWorkspace", aligned);
+      fresh.setPropertyValue("GroupingFileName", "hrpd_new_072_01.cal");
+      fresh.setPropertyValue("OutputWorkspace", "unused_for_child");
+      TS_ASSERT_THROWS_NOTHING(fresh.execute());
+      MatrixWorkspace_sptr freshOutput = fresh.getProperty("OutputWorkspace");
+
+      TS_ASSERT_EQUALS(reusedOutput->getNumberHistograms(), freshOutput->getNumberHistograms());
+      TS_ASSERT_EQUALS(reusedOutput->x(0).rawData(), freshOutput->x(0).rawData());
+      TS_ASSERT_EQUALS(reusedOutput->y(0).rawData(), freshOutput->y(0).rawData());
+    }
+  }
+
   void test_preserve_compare() {
     // processed nexus file in event mode
     const std::string PG3_FILE("PG3_46577.nxs.h5");
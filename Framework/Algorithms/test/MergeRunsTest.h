@@ -23,6 +23,7 @@
 #include "MantidGeometry/Instrument/DetectorInfo.h"
 #include "MantidKernel/TimeSeriesProperty.h"
 #include "MantidTypes/SpectrumDefinition.h"
+#include <algorithm>
 #include <memory>
 #include <stdarg.h>
 
@@ -476,6 +477,50 @@ public:
     EventTeardown();
   }
 
+  //-----------------------------------------------------------------------------------------------
+  void testExec_Events_SortEvents() {
+    EventSetup();
+    MergeRuns unsortedMerge;
+    unsortedMerge.initialize();
+    unsortedMerge.setPropertyValue("InputWorkspaces", "ev1,ev2,ev3");
+    unsortedMerge.setPropertyValue("OutputWorkspace", "unsortedWS");
+    unsortedMerge.execute();
+    TS_ASSERT(unsortedMerge.isExecuted());
+    const auto unsorted = AnalysisDataService::Instance().retrieveWS<EventWorkspace>("unsortedWS");
+
+    // Sorted inputs are merged, unsorted ones fall back to a full sort
+    for (const bool sortInputs : {true, false}) {
+      if (sortInputs) {
+        for (const auto &name : {"ev1", "ev2", "ev3"}) {
+          AnalysisDataService::Instance().retrieveWS<EventWorkspace>(name)->sortAll(TOF_SORT, nullptr);
+        }
+      }
+      MergeRuns mrg;
+      mrg.initialize();
+      mrg.setPropertyValue("InputWorkspaces", "ev1,ev2,ev3");
+      mrg.setPropertyValue("OutputWorkspace", "outWS");
+      mrg.setProperty("SortEvents", true);
+      mrg.execute();
+      TS_ASSERT(mrg.isExecuted());
+      const auto output = AnalysisDataService::Instance().retrieveWS<EventWorkspace>("outWS");
+      TS_ASSERT(output);
+      TS_ASSERT_EQUALS(output->getNumberEvents(), 1500);
+      TS_ASSERT_EQUALS(output->getNumberHistograms(), unsorted->getNumberHistograms());
+      for (size_t i = 0; i < output->getNumberHistograms(); ++i) {
+        const auto &el = output->getSpectrum(i);
+        TS_ASSERT_EQUALS(el.getSortType(), TOF_SORT);
+        const auto &events = el.getEvents();
+        TS_ASSERT(std::is_sorted(events.cbegin(), events.cend()));
+        TS_ASSERT_EQUALS(el.getNumberEvents(), unsorted->getSpectrum(i).getNumberEvents());
+        TS_ASSERT_EQUALS(el.getSpectrumNo(), unsorted->getSpectrum(i).getSpectrumNo());
+        TS_ASSERT_EQUALS(output->y(i), unsorted->y(i));
+      }
+    }
+    AnalysisDataService::Instance().remove("unsortedWS");
+
+    EventTeardown();
+  }
+
   //-----------------------------------------------------------------------------------------------
   void testExec_Events_MismatchedUnits_fail() {
     EventSetup();
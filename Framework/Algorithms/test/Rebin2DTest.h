@@ -305,7 +305,40 @@ public:
     }
   }
 
+  void test_Output_Grid_Inside_Input_Bins() {
+    // Each output bin covers a quarter of four input bins, including those
+    // input bins which extend past the edges of the output grid
+    MatrixWorkspace_sptr inputWS = makeInputWS(false); // 10 histograms, 10 bins
+    MatrixWorkspace_sptr outputWS = runAlgorithm(inputWS, "5.5,1.,9.5", "0.,1.,4.");
+    checkInsideInputBins(*outputWS);
+  }
+
+  void test_Output_Grid_Inside_Input_Bins_FractionalArea() {
+    MatrixWorkspace_sptr inputWS = makeInputWS(false); // 10 histograms, 10 bins
+    MatrixWorkspace_sptr outputWS = runAlgorithm(inputWS, "5.5,1.,9.5", "0.,1.,4.", true);
+    checkInsideInputBins(*outputWS);
+    const auto &rebinned = *dynamic_cast<RebinnedOutput *>(outputWS.get());
+    for (size_t i = 0; i < rebinned.getNumberHistograms(); ++i) {
+      for (const auto fraction : rebinned.dataF(i)) {
+        TS_ASSERT_DELTA(fraction, 1., 1e-12)
+      }
+    }
+  }
+
 private:
+  void checkInsideInputBins(const MatrixWorkspace &outputWS) {
+    TS_ASSERT_EQUALS(outputWS.getNumberHistograms(), 4)
+    TS_ASSERT_EQUALS(outputWS.blocksize(), 4)
+    for (size_t i = 0; i < outputWS.getNumberHistograms(); ++i) {
+      const auto &y = outputWS.y(i);
+      const auto &e = outputWS.e(i);
+      for (size_t j = 0; j < y.size(); ++j) {
+        TS_ASSERT_DELTA(y[j], 2., 1e-12)
+        TS_ASSERT_DELTA(e[j], M_SQRT2, 1e-12)
+      }
+    }
+  }
+
   void checkData(const MatrixWorkspace_const_sptr &outputWS, const size_t nxvalues, const size_t nhist, const bool dist,
                  const bool onAxis1, const bool small_bins = false) {
     TS_ASSERT_EQUALS(outputWS->getNumberHistograms(), nhist);
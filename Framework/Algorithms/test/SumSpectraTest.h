@@ -247,6 +247,54 @@ public:
     TS_ASSERT_THROWS(dotestExecEvent("testEvent", "testEvent2", "5-10,-10"), const std::runtime_error &);
   }
 
+  void testExecEvent_many_spectra_histogram_output() {
+    // enough spectra to be summed in several blocks
+    constexpr int numPixels{1000};
+    EventWorkspace_sptr input = WorkspaceCreationHelper::createEventWorkspace(numPixels, 20, 20);
+
+    Mantid::Algorithms::SumSpectra sumEvents;
+    sumEvents.initialize();
+    sumEvents.setChild(true);
+    sumEvents.setProperty("InputWorkspace", input);
+    sumEvents.setPropertyValue("OutputWorkspace", "unused");
+    TS_ASSERT_THROWS_NOTHING(sumEvents.execute());
+    MatrixWorkspace_sptr eventOutput = sumEvents.getProperty("OutputWorkspace");
+    const auto eventSum = std::dynamic_pointer_cast<EventWorkspace>(eventOutput);
+    TS_ASSERT(eventSum);
+
+    // the events are in the same order as appending the lists one by one
+    std::vector<Mantid::Types::Event::TofEvent> expectedEvents;
+    for (size_t i = 0; i < input->getNumberHistograms(); ++i) {
+      const auto &events = input->getSpectrum(i).getEvents();
+      expectedEvents.insert(expectedEvents.end(), events.cbegin(), events.cend());
+    }
+    TS_ASSERT_EQUALS(eventSum->getSpectrum(0).getEvents(), expectedEvents);
+
+    Mantid::Algorithms::SumSpectra sumHistogram;
+    sumHistogram.initialize();
+    sumHistogram.setChild(true);
+    sumHistogram.setProperty("InputWorkspace", input);
+    sumHistogram.setPropertyValue("OutputWorkspace", "unused");
+    sumHistogram.setProperty("PreserveEvents", false);
+    TS_ASSERT_THROWS_NOTHING(sumHistogram.execute());
+    MatrixWorkspace_sptr histogramSum = sumHistogram.getProperty("OutputWorkspace");
+    TS_ASSERT_EQUALS(histogramSum->id(), "Workspace2D");
+
+    TS_ASSERT_EQUALS(histogramSum->getNumberHistograms(), 1);
+    TS_ASSERT_EQUALS(histogramSum->x(0).rawData(), input->x(0).rawData());
+    const auto &yEvents = eventSum->y(0);
+    const auto &eEvents = eventSum->e(0);
+    const auto &yHistogram = histogramSum->y(0);
+    const auto &eHistogram = histogramSum->e(0);
+    for (size_t i = 0; i < yEvents.size(); ++i) {
+      TS_ASSERT_DELTA(yHistogram[i], yEvents[i], 1e-10);
+      TS_ASSERT_DELTA(eHistogram[i], eEvents[i], 1e-10);
+    }
+    TS_ASSERT_EQUALS(histogramSum->getSpectrum(0).getSpectrumNo(), eventSum->getSpectrum(0).getSpectrumNo());
+    TS_ASSERT_EQUALS(histogramSum->getSpectrum(0).getDetectorIDs(), eventSum->getSpectrum(0).getDetectorIDs());
+    TS_ASSERT_EQUALS(histogramSum->run().getLogData("NumAllSpectra")->value(), std::to_string(numPixels));
+  }
+
   void dotestExecEvent(const std::string &inName, const std::string &outName, const std::string &indices_list) {
     int numPixels = 100;
     int numBins = 20;
@@ -671,6 +719,16 @@ public:
     alg.execute();
   }
 
+  void testExecEventToHistogram() {
+    Algorithms::SumSpectra alg;
+    alg.initialize();
+    alg.setProperty("InputWorkspace", inputEvent);
+    alg.setProperty("IncludeMonitors", false);
+    alg.setProperty("PreserveEvents", false);
+    alg.setPropertyValue("OutputWorkspace", "SumSpectraEventHistogramOut");
+    alg.execute();
+  }
+
 private:
   MatrixWorkspace_sptr input;
   EventWorkspace_sptr inputEvent;
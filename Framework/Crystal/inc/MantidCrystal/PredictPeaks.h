@@ -10,6 +10,7 @@
 #include "MantidAPI/DetectorSearcher.h"
 #include "MantidAPI/IPeaksWorkspace.h"
 #include "MantidCrystal/DllConfig.h"
+#include "MantidDataObjects/Peak.h"
 #include "MantidGeometry/Crystal/OrientedLattice.h"
 #include "MantidGeometry/Crystal/ReflectionCondition.h"
 #include "MantidGeometry/Crystal/StructureFactorCalculator.h"
@@ -20,6 +21,9 @@
 #include <tuple>
 
 namespace Mantid {
+namespace API {
+class Progress;
+}
 namespace Crystal {
 
 /** Using a known crystal lattice and UB matrix, predict where single crystal
@@ -70,6 +74,14 @@ private:
   void calculateQAndAddToOutput(const Kernel::V3D &hkl, const Kernel::DblMatrix &orientedUB,
                                 const Kernel::DblMatrix &goniometerMatrix);
 
+  std::unique_ptr<DataObjects::Peak> predictPeak(const Kernel::V3D &hkl, const Kernel::DblMatrix &orientedUB,
+                                                 const Kernel::DblMatrix &goniometerMatrix,
+                                                 API::DetectorSearcher &detectorSearcher) const;
+
+  void predictPeaksForGoniometers(const std::vector<Kernel::DblMatrix> &gonioVec, const Kernel::DblMatrix &ub,
+                                  const std::vector<Kernel::V3D> &possibleHKLs, double lambdaMin, double lambdaMax,
+                                  API::Progress &prog);
+
   void calculateQAndAddToOutputLeanElastic(const Kernel::V3D &hkl, const Kernel::DblMatrix &UB);
 
 private:
@@ -98,6 +110,8 @@ private:
   Mantid::API::IPeaksWorkspace_sptr m_pw;
   Geometry::StructureFactorCalculator_sptr m_sfCalculator;
   bool m_leanElasticPeak = false;
+  /// Whether peaks that miss the detectors are placed in extended detector space
+  bool m_useExtendedDetectorSpace = false;
 
   double m_qConventionFactor;
 };
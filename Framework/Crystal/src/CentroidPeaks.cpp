@@ -13,6 +13,7 @@
 #include "MantidKernel/Unit.h"
 #include "MantidKernel/VectorHelper.h"
 #include <boost/algorithm/clamp.hpp>
+#include <utility>
 
 using Mantid::DataObjects::PeaksWorkspace;
 
@@ -243,7 +244,7 @@ void CentroidPeaks::integrateEvent() {
         size_t workspaceIndex = (it1->second);
         EventList el = eventW->getSpectrum(workspaceIndex);
         el.switchTo(WEIGHTED_NOTIME);
-        std::vector<WeightedEventNoTime> events = el.getWeightedEventsNoTime();
+        const std::vector<WeightedEventNoTime> &events = std::as_const(el).getWeightedEventsNoTime();
 
         // Check for events in tof range
         for (const auto &event : events) {
@@ -26,8 +26,10 @@
 #include "MantidKernel/BoundedValidator.h"
 #include "MantidKernel/EnabledWhenProperty.h"
 #include "MantidKernel/ListValidator.h"
+#include "MantidKernel/MultiThreaded.h"
 
 #include <fstream>
+#include <numeric>
 using Mantid::Kernel::EnabledWhenProperty;
 
 namespace Mantid::Crystal {
@@ -169,6 +171,7 @@ void PredictPeaks::exec() {
   Workspace_sptr rawInputWorkspace = getProperty("InputWorkspace");
   m_edge = this->getProperty("EdgePixels");
   m_leanElasticPeak = (getPropertyValue("OutputType") == "LeanElasticPeak");
+  m_useExtendedDetectorSpace = getProperty("PredictPeaksOutsideDetectors");
   bool usingInstrument = !(m_leanElasticPeak && !getProperty("CalculateWavelength"));
 
   ExperimentInfo_sptr inputExperimentInfo = std::dynamic_pointer_cast<ExperimentInfo>(rawInputWorkspace);
@@ -341,32 +344,11 @@ void PredictPeaks::exec() {
     logNumberOfPeaksFound(allowedPeakCount);
 
   } else {
-    for (auto &goniometerMatrix : gonioVec) {
-      // Final transformation matrix (HKL to Q in lab frame)
-      DblMatrix orientedUB = goniometerMatrix * ub;
-
-      /* Because of the additional filtering step it's better to keep track of
-       * the allowed peaks with a counter. */
-      HKLFilterWavelength lambdaFilter(orientedUB, lambdaMin, lambdaMax);
-
-      size_t allowedPeakCount = 0;
-
-      bool useExtendedDetectorSpace = getProperty("PredictPeaksOutsideDetectors");
-      if (useExtendedDetectorSpace && !m_inst->getComponentByName("extended-detector-space")) {
-        g_log.warning() << "Attempting to find peaks outside of detectors but "
-                           "no extended detector space has been defined\n";
-      }
-
-      for (auto &possibleHKL : possibleHKLs) {
-        if (lambdaFilter.isAllowed(possibleHKL)) {
-          calculateQAndAddToOutput(possibleHKL, orientedUB, goniometerMatrix);
-          ++allowedPeakCount;
-        }
-        prog.report();
-      }
-
-      logNumberOfPeaksFound(allowedPeakCount);
+    if (m_useExtendedDetectorSpace && !m_inst->getComponentByName("extended-detector-space")) {
+      g_log.warning() << "Attempting to find peaks outside of detectors but "
+                         "no extended detector space has been defined\n";
     }
+    predictPeaksForGoniometers(gonioVec, ub, possibleHKLs, lambdaMin, lambdaMax, prog);
   }
 
   // Sort peaks by run number so that peaks with equal goniometer matrices are
@@ -383,6 +365,91 @@ void PredictPeaks::exec() {
   setProperty<IPeaksWorkspace_sptr>("OutputWorkspace", m_pw);
 }
 
+/**
+ * Predict the peaks for every combination of goniometer setting and HKL.
+ *
+ * The work is split into blocks of HKLs for each goniometer setting, which
+ * are processed in parallel with one DetectorSearcher per thread. Each block
+ * collects its peaks in its own buffer and the buffers are added to the output
+ * in block order, so the result is the same as a serial prediction.
+ *
+ * Constructing the peaks concurrently is safe as it only reads the instrument:
+ * parametrized components are created per call and the position and rotation
+ * caches of the ParameterMap are locked. The DetectorSearcher keeps ray
+ * tracing state between searches, hence one per thread.
+ *
+ * @param gonioVec :: the goniometer settings to predict peaks for
+ * @param ub :: the UB matrix of the sample
+ * @param possibleHKLs :: the candidate HKLs
+ * @param lambdaMin :: minimum wavelength of predicted peaks
+ * @param lambdaMax :: maximum wavelength of predicted peaks
+ * @param prog :: progress reporter, incremented once per HKL and goniometer
+ */
+void PredictPeaks::predictPeaksForGoniometers(const std::vector<DblMatrix> &gonioVec, const DblMatrix &ub,
+                                              const std::vector<V3D> &possibleHKLs, const double lambdaMin,
+                                              const double lambdaMax, Progress &prog) {
+  constexpr size_t blockSize = 4096;
+  const size_t blocksPerGoniometer = std::max<size_t>(1, (possibleHKLs.size() + blockSize - 1) / blockSize);
+  const size_t numberOfBlocks = gonioVec.size() * blocksPerGoniometer;
+
+  // Throws if the wavelength range is invalid, before any threads start
+  std::vector<HKLFilterWavelength> lambdaFilters;
+  lambdaFilters.reserve(gonioVec.size());
+  for (const auto &goniometerMatrix : gonioVec)
+    lambdaFilters.emplace_back(goniometerMatrix * ub, lambdaMin, lambdaMax);
+
+  std::vector<std::vector<Peak>> blockPeaks(numberOfBlocks);
+  std::vector<size_t> blockAllowedPeakCount(numberOfBlocks, 0);
+  // The searcher keeps state between searches so each thread needs its own
+  std::vector<std::unique_ptr<DetectorSearcher>> detectorSearchers(static_cast<size_t>(PARALLEL_GET_MAX_THREADS));
+
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int64_t i = 0; i < static_cast<int64_t>(numberOfBlocks); ++i) {
+    PARALLEL_START_INTERRUPT_REGION
+    const auto block = static_cast<size_t>(i);
+    auto &detectorSearcher = detectorSearchers[static_cast<size_t>(PARALLEL_THREAD_NUMBER)];
+    if (!detectorSearcher)
+      detectorSearcher = std::make_unique<DetectorSearcher>(m_inst, m_pw->detectorInfo());
+
+    const auto goniometerIndex = block / blocksPerGoniometer;
+    const auto &goniometerMatrix = gonioVec[goniometerIndex];
+    const auto &lambdaFilter = lambdaFilters[goniometerIndex];
+    const DblMatrix orientedUB = goniometerMatrix * ub;
+    const size_t first = (block % blocksPerGoniometer) * blockSize;
+    const size_t last = std::min(first + blockSize, possibleHKLs.size());
+
+    auto &peaks = blockPeaks[block];
+    for (size_t hklIndex = first; hklIndex < last; ++hklIndex) {
+      const auto &hkl = possibleHKLs[hklIndex];
+      if (!lambdaFilter.isAllowed(hkl))
+        continue;
+      ++blockAllowedPeakCount[block];
+      if (auto peak = predictPeak(hkl, orientedUB, goniometerMatrix, *detectorSearcher))
+        peaks.emplace_back(std::move(*peak));
+    }
+    prog.reportIncrement(last - first);
+    PARALLEL_END_INTERRUPT_REGION
+  }
+  PARALLEL_CHECK_INTERRUPT_REGION
+
+  auto peaksWorkspace = std::dynamic_pointer_cast<PeaksWorkspace>(m_pw);
+  for (size_t goniometerIndex = 0; goniometerIndex < gonioVec.size(); ++goniometerIndex) {
+    size_t allowedPeakCount = 0;
+    for (size_t block = goniometerIndex * blocksPerGoniometer; block < (goniometerIndex + 1) * blocksPerGoniometer;
+         ++block) {
+      allowedPeakCount += blockAllowedPeakCount[block];
+      for (auto &peak : blockPeaks[block]) {
+        if (peaksWorkspace)
+          peaksWorkspace->addPeak(std::move(peak));
+        else
+          m_pw->addPeak(peak);
+      }
+      std::vector<Peak>().swap(blockPeaks[block]);
+    }
+    logNumberOfPeaksFound(allowedPeakCount);
+  }
+}
+
 /**
  * Log the number of peaks found to fall on and off detectors
  *
@@ -481,9 +548,23 @@ void PredictPeaks::fillPossibleHKLsUsingGenerator(const OrientedLattice &oriente
     throw std::invalid_argument("More than 10 billion HKLs to search. Is "
                                 "your d_min value too small?");
 
+  // The generator runs over l fastest and h slowest, so filter each plane of
+  // constant h in parallel and join the planes in order of h.
+  const auto hMax = static_cast<int>(hklMin.X() * -1.0);
+  const auto hMin = static_cast<int>(hklMin.X());
+  std::vector<std::vector<V3D>> planes(static_cast<size_t>(hMax - hMin + 1));
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int h = hMin; h <= hMax; ++h) {
+    const HKLGenerator plane(V3D(h, hklMin.Y(), hklMin.Z()), V3D(h, -hklMin.Y(), -hklMin.Z()));
+    auto &allowed = planes[static_cast<size_t>(h - hMin)];
+    std::copy_if(plane.begin(), plane.end(), std::back_inserter(allowed), filter->fn());
+  }
+
   possibleHKLs.clear();
-  possibleHKLs.reserve(gen.size());
-  std::remove_copy_if(gen.begin(), gen.end(), std::back_inserter(possibleHKLs), (~filter)->fn());
+  possibleHKLs.reserve(std::accumulate(planes.cbegin(), planes.cend(), size_t(0),
+                                       [](size_t total, const auto &plane) { return total + plane.size(); }));
+  for (const auto &plane : planes)
+    possibleHKLs.insert(possibleHKLs.end(), plane.cbegin(), plane.cend());
 }
 
 /// Fills possibleHKLs with all HKLs from the supplied PeaksWorkspace.
@@ -553,6 +634,23 @@ void PredictPeaks::setStructureFactorCalculatorFromSample(const Sample &sample)
  */
 void PredictPeaks::calculateQAndAddToOutput(const V3D &hkl, const DblMatrix &orientedUB,
                                             const DblMatrix &goniometerMatrix) {
+  if (auto peak = predictPeak(hkl, orientedUB, goniometerMatrix, *m_detectorCacheSearch))
+    m_pw->addPeak(*peak);
+}
+
+/**
+ * @brief Calculates Q from HKL and creates the corresponding peak
+ *
+ * @param hkl :: the HKL of the peak
+ * @param orientedUB :: the UB matrix multiplied by the goniometer matrix
+ * @param goniometerMatrix :: the goniometer matrix of the peak
+ * @param detectorSearcher :: the searcher used to find the detector hit
+ * @return the peak, or nullptr if it does not hit a detector or is
+ * too close to the edge of a bank
+ */
+std::unique_ptr<Peak> PredictPeaks::predictPeak(const V3D &hkl, const DblMatrix &orientedUB,
+                                                const DblMatrix &goniometerMatrix,
+                                                DetectorSearcher &detectorSearcher) const {
   // The q-vector direction of the peak is = goniometer * ub * hkl_vector
   // This is in inelastic convention: momentum transfer of the LATTICE!
   // Also, q does have a 2pi factor = it is equal to 2pi/wavelength.
@@ -561,13 +659,12 @@ void PredictPeaks::calculateQAndAddToOutput(const V3D &hkl, const DblMatrix &ori
   const auto detectorDir = std::get<0>(params);
   const auto wl = std::get<1>(params);
 
-  const bool useExtendedDetectorSpace = getProperty("PredictPeaksOutsideDetectors");
-  const auto result = m_detectorCacheSearch->findDetectorIndex(q);
+  const auto result = detectorSearcher.findDetectorIndex(q);
   const auto hitDetector = std::get<0>(result);
   const auto index = std::get<1>(result);
 
-  if (!hitDetector && !useExtendedDetectorSpace) {
-    return;
+  if (!hitDetector && !m_useExtendedDetectorSpace) {
+    return nullptr;
   }
 
   const auto &detInfo = m_pw->detectorInfo();
@@ -578,9 +675,9 @@ void PredictPeaks::calculateQAndAddToOutput(const V3D &hkl, const DblMatrix &ori
     // peak hit a detector to add it to the list
     peak = std::make_unique<Peak>(m_inst, det.getID(), wl);
     if (!peak->getDetector()) {
-      return;
+      return nullptr;
     }
-  } else if (useExtendedDetectorSpace) {
+  } else if (m_useExtendedDetectorSpace) {
     // use extended detector space to try and guess peak position
     const auto returnedComponent = m_inst->getComponentByName("extended-detector-space");
     // Check that the component is valid
@@ -593,7 +690,7 @@ void PredictPeaks::calculateQAndAddToOutput(const V3D &hkl, const DblMatrix &ori
     // find where this Q vector should intersect with "extended" space
     Geometry::Track track(detInfo.samplePosition(), detectorDir);
     if (!component->interceptSurface(track))
-      return;
+      return nullptr;
 
     // The exit point is the vector to the place that we hit a detector
     const auto magnitude = track.back().exitPoint.norm();
@@ -601,7 +698,7 @@ void PredictPeaks::calculateQAndAddToOutput(const V3D &hkl, const DblMatrix &ori
   }
 
   if (m_edge > 0 && edgePixel(m_inst, peak->getBankName(), peak->getCol(), peak->getRow(), m_edge))
-    return;
+    return nullptr;
 
   // Only add peaks that hit the detector
   peak->setGoniometerMatrix(goniometerMatrix);
@@ -614,8 +711,7 @@ void PredictPeaks::calculateQAndAddToOutput(const V3D &hkl, const DblMatrix &ori
     peak->setIntensity(m_sfCalculator->getFSquared(hkl));
   }
 
-  // Add it to the workspace
-  m_pw->addPeak(*peak);
+  return peak;
 }
 
 /**
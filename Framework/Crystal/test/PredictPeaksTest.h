@@ -114,6 +114,50 @@ public:
 
   void test_exec() { do_test_exec("Primitive", 10, std::vector<V3D>()); }
 
+  void test_exec_gives_the_same_peaks_as_a_serial_run() {
+    MatrixWorkspace_sptr inWS = WorkspaceCreationHelper::create2DWorkspace(10000, 1);
+    inWS->setInstrument(ComponentCreationHelper::createTestInstrumentRectangular2(1, 100));
+    WorkspaceCreationHelper::setOrientedLattice(inWS, 12.0, 12.0, 12.0);
+    WorkspaceCreationHelper::setGoniometer(inWS, 0., 0., 0.);
+    for (const double omega : {10., 20., 30.}) {
+      Goniometer goniometer;
+      goniometer.pushAxis("omega", 0., 1., 0., omega);
+      inWS->mutableRun().addGoniometer(goniometer);
+    }
+
+    auto predict = [&inWS]() {
+      PredictPeaks alg;
+      alg.initialize();
+      alg.setChild(true);
+      alg.setProperty("InputWorkspace", std::dynamic_pointer_cast<Workspace>(inWS));
+      alg.setPropertyValue("OutputWorkspace", "unused");
+      alg.setPropertyValue("WavelengthMin", ".5");
+      alg.setPropertyValue("WavelengthMax", "15.0");
+      alg.setPropertyValue("MinDSpacing", ".5");
+      alg.execute();
+      IPeaksWorkspace_sptr peaks = alg.getProperty("OutputWorkspace");
+      return std::dynamic_pointer_cast<PeaksWorkspace>(peaks);
+    };
+
+    FrameworkManager::Instance().setNumOMPThreads(1);
+    const auto serial = predict();
+    FrameworkManager::Instance().setNumOMPThreadsToConfigValue();
+    const auto parallel = predict();
+
+    TS_ASSERT(serial->getNumberPeaks() > 0);
+    TS_ASSERT_EQUALS(parallel->getNumberPeaks(), serial->getNumberPeaks());
+    for (int i = 0; i < std::min(serial->getNumberPeaks(), parallel->getNumberPeaks()); ++i) {
+      const auto &expected = serial->getPeak(i);
+      const auto &peak = parallel->getPeak(i);
+      TS_ASSERT_EQUALS(peak.getHKL(), expected.getHKL());
+      TS_ASSERT_EQUALS(peak.getDetectorID(), expected.getDetectorID());
+      TS_ASSERT_EQUALS(peak.getWavelength(), expected.getWavelength());
+      TS_ASSERT_EQUALS(peak.getQLabFrame(), expected.getQLabFrame());
+      TS_ASSERT_EQUALS(peak.getGoniometerMatrix(), expected.getGoniometerMatrix());
+      TS_ASSERT_EQUALS(peak.getPeakNumber(), expected.getPeakNumber());
+    }
+  }
+
   /** Fewer HKLs if they are not allowed */
   void test_exec_withReflectionCondition() { do_test_exec("C-face centred", 6, std::vector<V3D>()); }
 
@@ -10,6 +10,7 @@
 // Includes
 //----------------------------------------------------------------------
 #include "MantidAPI/IFunction1D.h"
+#include "MantidAPI/MuParserUtils.h"
 #include "MantidAPI/ParamFunction.h"
 #include "MantidCurveFitting/DllConfig.h"
 #include <memory>
@@ -66,6 +67,8 @@ private:
   mutable double m_x;
   /// True indicates that input formula contains 'x' variable
   bool m_x_set;
+  /// Evaluates m_parser over all the x values at once
+  mutable API::MuParserUtils::BulkEvaluator m_bulkEvaluator;
   /// Temporary data storage used in functionDeriv
   mutable std::vector<double> m_tmp;
   /// Temporary data storage used in functionDeriv
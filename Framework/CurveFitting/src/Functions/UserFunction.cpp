@@ -111,6 +111,14 @@ void UserFunction::function1D(double *out, const double *xValues, const size_t n
   if (m_formula.empty()) {
     throw std::invalid_argument("Empty formula supplied for user function");
   }
+  if (nData > 1) {
+    try {
+      m_bulkEvaluator.evaluate(*m_parser, {"x"}, xValues, out, nData);
+      return;
+    } catch (mu::Parser::exception_type &) {
+      // Evaluate point by point below to report the failing x value
+    }
+  }
   for (size_t i = 0; i < nData; i++) {
     m_x = xValues[i];
     try {
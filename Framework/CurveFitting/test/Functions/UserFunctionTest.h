@@ -98,4 +98,78 @@ public:
     // Check that the 'a' parameter has not been reset
     TS_ASSERT_EQUALS(1.1, fun.getParameter("a"));
   }
+
+  void test_function1D_follows_parameter_and_formula_changes() {
+    UserFunction fun;
+    fun.setAttribute("Formula", UserFunction::Attribute("a*x+b"));
+    fun.setParameter("a", 2.0);
+    fun.setParameter("b", 1.0);
+
+    const std::vector<double> x{0.0, 0.5, 1.0, 1.5, 2.0};
+    std::vector<double> y(x.size());
+    fun.function1D(y.data(), x.data(), x.size());
+    for (size_t i = 0; i < x.size(); ++i) {
+      TS_ASSERT_DELTA(y[i], 2.0 * x[i] + 1.0, 1e-12);
+    }
+
+    fun.setParameter("b", -3.0);
+    fun.function1D(y.data(), x.data(), x.size());
+    for (size_t i = 0; i < x.size(); ++i) {
+      TS_ASSERT_DELTA(y[i], 2.0 * x[i] - 3.0, 1e-12);
+    }
+
+    fun.setAttribute("Formula", UserFunction::Attribute("c*x*x"));
+    fun.setParameter("c", 0.5);
+    fun.function1D(y.data(), x.data(), x.size());
+    for (size_t i = 0; i < x.size(); ++i) {
+      TS_ASSERT_DELTA(y[i], 0.5 * x[i] * x[i], 1e-12);
+    }
+  }
+
+  void test_function1D_single_point_matches_many_points() {
+    UserFunction fun;
+    fun.setAttribute("Formula", UserFunction::Attribute("h*exp(-x/t)"));
+    fun.setParameter("h", 3.0);
+    fun.setParameter("t", 0.7);
+
+    std::vector<double> x(50), y(x.size());
+    for (size_t i = 0; i < x.size(); ++i) {
+      x[i] = 0.1 * static_cast<double>(i);
+    }
+    fun.function1D(y.data(), x.data(), x.size());
+    for (size_t i = 0; i < x.size(); ++i) {
+      double single(0.);
+      fun.function1D(&single, &x[i], 1);
+      TS_ASSERT_EQUALS(y[i], single);
+    }
+  }
+};
+
+class UserFunctionTestPerformance : public CxxTest::TestSuite {
+public:
+  static UserFunctionTestPerformance *createSuite() { return new UserFunctionTestPerformance(); }
+  static void destroySuite(UserFunctionTestPerformance *suite) { delete suite; }
+
+  UserFunctionTestPerformance() : m_x(1000000), m_y(m_x.size()) {
+    for (size_t i = 0; i < m_x.size(); ++i) {
+      m_x[i] = 1e-5 * static_cast<double>(i);
+    }
+    m_fun.setAttribute("Formula", UserFunction::Attribute("h*sin(a*x-c)+b*exp(-x/t)"));
+    m_fun.setParameter("h", 2.2);
+    m_fun.setParameter("a", 2.0);
+    m_fun.setParameter("c", 1.2);
+    m_fun.setParameter("b", 0.5);
+    m_fun.setParameter("t", 3.0);
+  }
+
+  void test_function1D_large_domain() {
+    for (int i = 0; i < 10; ++i) {
+      m_fun.function1D(m_y.data(), m_x.data(), m_x.size());
+    }
+  }
+
+private:
+  UserFunction m_fun;
+  std::vector<double> m_x;
+  std::vector<double> m_y;
 };
@@ -188,6 +188,10 @@ private:
   size_t formGroupsEvent(const DataObjects::EventWorkspace_const_sptr &inputWS,
                          const DataObjects::EventWorkspace_sptr &outputWS, const double prog4Copy);
 
+  /// Advance the progress by a block of grouped spectra, safe to call from the
+  /// grouping threads
+  void reportGroupingProgress(const double prog4Copy);
+
   /// Copy the ungrouped spectra from the input workspace to the output
   template <class TIn, class TOut>
   void moveOthers(const std::set<int64_t> &unGroupedSet, const TIn &inputWS, TOut &outputWS, size_t outIndex);
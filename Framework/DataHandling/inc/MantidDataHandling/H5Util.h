@@ -73,6 +73,21 @@ void writeScalarDataSetWithStrAttributes(H5::Group &group, const std::string &na
 
 template <typename NumT> void writeArray1D(H5::Group &group, const std::string &name, const std::vector<NumT> &values);
 
+/**
+ * Write a deflate compressed 1D array. The chunks are compressed in parallel
+ * and written directly to the file, bypassing the serial filter pipeline of
+ * HDF5. The result is an ordinary chunked, deflated dataset.
+ * @param group :: the group to create the dataset in
+ * @param name :: the name of the dataset
+ * @param values :: the start of the array
+ * @param length :: the number of values in the array
+ * @param chunkLength :: the number of values in each chunk
+ * @param deflateLevel :: the zlib compression level
+ */
+template <typename NumT>
+void writeArray1DCompressed(H5::Group &group, const std::string &name, const NumT *values, const std::size_t length,
+                            const std::size_t chunkLength = 1 << 20, const int deflateLevel = 6);
+
 MANTID_DATAHANDLING_DLL std::string readString(H5::H5File &file, const std::string &path);
 
 MANTID_DATAHANDLING_DLL std::string readString(H5::Group &group, const std::string &name);
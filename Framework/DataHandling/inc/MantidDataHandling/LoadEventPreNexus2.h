@@ -125,6 +125,8 @@ private:
 
   /// Handles loading from the event file
   std::unique_ptr<Mantid::Kernel::BinaryFile<DasEvent>> eventfile;
+  /// Name of the event file, used to map it into memory for processing
+  std::string m_eventFilename;
   std::size_t num_events; ///< The number of events in the file
   std::size_t num_pulses; ///< the number of pulses
   uint32_t numpixel;      ///< the number of pixels
@@ -190,7 +192,7 @@ private:
   void procEvents(DataObjects::EventWorkspace_sptr &workspace);
 
   void procEventsLinear(DataObjects::EventWorkspace_sptr &workspace,
-                        std::vector<Types::Event::TofEvent> **arrayOfVectors, DasEvent *event_buffer,
+                        std::vector<Types::Event::TofEvent> **arrayOfVectors, const DasEvent *event_buffer,
                         size_t current_event_buffer_size, size_t fileOffset, bool dbprint);
 
   void setProtonCharge(DataObjects::EventWorkspace_sptr &workspace);
@@ -73,6 +73,12 @@ private:
   void separateMonitors(FILE *file, const int64_t &period, const std::vector<specnum_t> &monitorList,
                         const DataObjects::Workspace2D_sptr &ws_sptr, const DataObjects::Workspace2D_sptr &mws_sptr);
 
+  /// reads a spectrum, leaving it to be set in the workspace later
+  void readSpectrum(FILE *file, int64_t histToRead, const DataObjects::Workspace2D_sptr &ws, int64_t wsIndex,
+                    specnum_t spectrumNumber);
+  /// sets the spectra read by readSpectrum in their workspaces
+  void setPendingSpectra();
+
   /// skip all spectra in a period
   void skipPeriod(FILE *file, const int64_t &period);
   /// return true if loading a selection of periods
@@ -107,6 +113,20 @@ private:
 
   /// Read in the time bin boundaries
   int64_t m_lengthIn;
+
+  /// A spectrum read from the file that is yet to be set in its workspace
+  struct PendingSpectrum {
+    DataObjects::Workspace2D *workspace{nullptr};
+    int64_t wsIndex{0};
+    specnum_t spectrumNumber{0};
+    std::vector<char> compressed;
+  };
+  /// Spectra read by readSpectrum, the buffers are reused between batches
+  std::vector<PendingSpectrum> m_pendingSpectra;
+  /// The number of entries of m_pendingSpectra in use
+  size_t m_numPendingSpectra{0};
+  /// The compressed size of the pending spectra
+  size_t m_pendingBytes{0};
   /// time channels vector
   std::vector<std::shared_ptr<HistogramData::HistogramX>> m_timeChannelsVec;
   /// total number of specs
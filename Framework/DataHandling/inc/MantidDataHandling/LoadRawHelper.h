@@ -146,6 +146,10 @@ protected:
   void setWorkspaceData(const DataObjects::Workspace2D_sptr &newWorkspace,
                         const std::vector<std::shared_ptr<HistogramData::HistogramX>> &timeChannelsVec, int64_t wsIndex,
                         specnum_t nspecNum, int64_t noTimeRegimes, int64_t lengthIn, int64_t binStart);
+  void setWorkspaceData(DataObjects::Workspace2D &newWorkspace,
+                        const std::vector<std::shared_ptr<HistogramData::HistogramX>> &timeChannelsVec, int64_t wsIndex,
+                        specnum_t nspecNum, int64_t noTimeRegimes, int64_t lengthIn, int64_t binStart,
+                        const uint32_t *counts) const;
 
   /// get proton charge from raw file
   float getProtonCharge() const;
@@ -80,6 +80,8 @@ private:
 
   void execEvent(const Mantid::NeXus::NexusFileIO *nexusFile, const bool uniformSpectra, const bool raggedSpectra,
                  const std::vector<int> &spec);
+  /// Write the event arrays held back for parallel compression
+  void writeCompressedEventData(const std::string &filename);
   /// sets non workspace properties for the algorithm
   void setOtherProperties(IAlgorithm *alg, const std::string &propertyName, const std::string &propertyValue,
                           int perioidNum) override;
@@ -94,6 +96,18 @@ private:
   double m_timeProgInit{0.0};
   /// Progress bar
   std::unique_ptr<API::Progress> m_progress;
+
+  /// The combined event arrays of an event_workspace group
+  struct CompressedEventData {
+    std::string groupPath;
+    std::size_t numberOfEvents;
+    std::unique_ptr<double[]> tofs;
+    std::unique_ptr<float[]> weights;
+    std::unique_ptr<float[]> errorSquareds;
+    std::unique_ptr<int64_t[]> pulsetimes;
+  };
+  /// Event arrays to compress once the NeXus file has been closed
+  std::vector<CompressedEventData> m_compressedEventData;
 };
 
 } // namespace DataHandling
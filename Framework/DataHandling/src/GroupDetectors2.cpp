@@ -20,6 +20,7 @@
 #include "MantidKernel/ArrayProperty.h"
 #include "MantidKernel/Exception.h"
 #include "MantidKernel/ListValidator.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/StringTokenizer.h"
 #include "MantidKernel/Strings.h"
 #include "MantidTypes/SpectrumDefinition.h"
@@ -87,6 +88,43 @@ void forceSpectraAxis(MatrixWorkspace &ws) {
   ws.replaceAxis(1, std::make_unique<SpectraAxis>(&ws));
 }
 
+/**
+ * The groups laid out contiguously so that the workspace indices of a group
+ * can be looked up from its output index without walking the map. Group
+ * outIndex holds indices[offsets[outIndex]] to indices[offsets[outIndex + 1]].
+ */
+struct FlatGroups {
+  std::vector<specnum_t> spectrumNumbers;
+  std::vector<size_t> offsets;
+  std::vector<size_t> indices;
+
+  size_t size() const { return spectrumNumbers.size(); }
+  auto begin(const size_t outIndex) const { return indices.cbegin() + offsets[outIndex]; }
+  auto end(const size_t outIndex) const { return indices.cbegin() + offsets[outIndex + 1]; }
+};
+
+/**
+ * Flatten the groups, keeping them in the order of the map (i.e. the order
+ * they appear in the output workspace).
+ * @param groups : the workspace indices to group, keyed by spectrum number
+ * @return the flattened groups
+ */
+FlatGroups flattenGroups(const std::map<specnum_t, std::vector<size_t>> &groups) {
+  FlatGroups flat;
+  flat.spectrumNumbers.reserve(groups.size());
+  flat.offsets.reserve(groups.size() + 1);
+  flat.offsets.emplace_back(0);
+  for (const auto &group : groups) {
+    flat.spectrumNumbers.emplace_back(group.first);
+    flat.offsets.emplace_back(flat.offsets.back() + group.second.size());
+  }
+  flat.indices.reserve(flat.offsets.back());
+  for (const auto &group : groups) {
+    flat.indices.insert(flat.indices.end(), group.second.cbegin(), group.second.cend());
+  }
+  return flat;
+}
+
 } // anonymous namespace
 
 // progress estimates
@@ -846,6 +884,23 @@ double GroupDetectors2::fileReadProg(DataHandling::GroupDetectors2::storage_map:
   return progEstim;
 }
 
+/**
+ *  Advance the progress by INTERVAL groups. This may be called from the
+ * threads combining the groups.
+ *  @param prog4Copy :: the amount of algorithm progress to attribute to moving
+ * a single spectra
+ */
+void GroupDetectors2::reportGroupingProgress(const double prog4Copy) {
+  double fracCompl;
+  PARALLEL_CRITICAL(GroupDetectors2_progress) {
+    m_FracCompl += INTERVAL * prog4Copy;
+    if (m_FracCompl > 1.0)
+      m_FracCompl = 1.0;
+    fracCompl = m_FracCompl;
+  }
+  progress(fracCompl);
+}
+
 /**
  *  Move the user selected spectra in the input workspace into groups in the
  * output workspace
@@ -865,20 +920,30 @@ size_t GroupDetectors2::formGroups(const API::MatrixWorkspace_const_sptr &inputW
                                    Indexing::IndexInfo &indexInfo) {
   const std::string behaviourChoice = getProperty("Behaviour");
   const auto behaviour = behaviourChoice == "Sum" ? Behaviour::SUM : Behaviour::AVERAGE;
-  size_t outIndex = 0;
   const auto &spectrumInfo = inputWS->spectrumInfo();
-  const auto nFinalHistograms = m_GroupWsInds.size() + (keepAll ? unGroupedSet.size() : 0);
+  const auto groups = flattenGroups(m_GroupWsInds);
+  const auto nFinalHistograms = groups.size() + (keepAll ? unGroupedSet.size() : 0);
   auto spectrumGroups = std::vector<std::vector<size_t>>();
   spectrumGroups.reserve(nFinalHistograms);
   auto spectrumNumbers = std::vector<Indexing::SpectrumNumber>();
   spectrumNumbers.reserve(nFinalHistograms);
+  // The spectrum number of each group is the key, the members are kept to
+  // work out which detectors need masking
+  for (size_t outIndex = 0; outIndex < groups.size(); ++outIndex) {
+    spectrumNumbers.emplace_back(groups.spectrumNumbers[outIndex]);
+    spectrumGroups.emplace_back(groups.begin(outIndex), groups.end(outIndex));
+  }
 
-  for (const auto &group : m_GroupWsInds) {
+  // Each group is the only writer of its output spectrum so the groups can be
+  // combined independently. The group sizes can vary a lot, hence the dynamic
+  // schedule.
+  const auto numGroups = static_cast<int64_t>(groups.size());
+  PRAGMA_OMP(parallel for schedule(dynamic, 1) if (Kernel::threadSafe(*inputWS, *outputWS)))
+  for (int64_t i = 0; i < numGroups; ++i) {
+    PARALLEL_START_INTERRUPT_REGION
+    const auto outIndex = static_cast<size_t>(i);
     // This is the grouped spectrum
     auto &outSpec = outputWS->getSpectrum(outIndex);
-
-    // The spectrum number of the group is the key
-    spectrumNumbers.emplace_back(group.first);
     // Start fresh with no detector IDs
     outSpec.clearDetectorIDs();
 
@@ -886,19 +951,15 @@ size_t GroupDetectors2::formGroups(const API::MatrixWorkspace_const_sptr &inputW
     // are assumed to be the same here
     outSpec.setSharedX(inputWS->sharedX(0));
 
-    // Keep track of number of detectors required for masking
-    std::vector<size_t> spectrumGroup;
-    spectrumGroup.reserve(group.second.size());
-
     auto &Ys = outSpec.mutableY();
     auto &Es = outSpec.mutableE();
     std::vector<double> sum(Ys.size(), 0.);
     std::vector<double> errorSum(Ys.size(), 0.);
     std::vector<int> count(Ys.size(), 0);
-    for (auto originalWI : group.second) {
+    for (auto member = groups.begin(outIndex); member != groups.end(outIndex); ++member) {
+      const auto originalWI = *member;
       const auto &inSpec = inputWS->getSpectrum(originalWI);
       outSpec.addDetectorIDs(inSpec.getDetectorIDs());
-      spectrumGroup.emplace_back(originalWI);
       if (spectrumInfo.hasDetectors(originalWI) && spectrumInfo.isMasked(originalWI)) {
         continue;
       }
@@ -921,7 +982,6 @@ size_t GroupDetectors2::formGroups(const API::MatrixWorkspace_const_sptr &inputW
         }
       }
     }
-    spectrumGroups.emplace_back(std::move(spectrumGroup));
     for (size_t binIndex = 0; binIndex < sum.size(); ++binIndex) {
       errorSum[binIndex] = std::sqrt(errorSum[binIndex]);
       if (behaviour == Behaviour::AVERAGE) {
@@ -938,17 +998,14 @@ size_t GroupDetectors2::formGroups(const API::MatrixWorkspace_const_sptr &inputW
       Es[binIndex] = errorSum[binIndex];
     }
 
-    // make regular progress reports and check for cancelling the algorithm
-    if (outIndex % INTERVAL == 0) {
-      m_FracCompl += INTERVAL * prog4Copy;
-      if (m_FracCompl > 1.0)
-        m_FracCompl = 1.0;
-      progress(m_FracCompl);
-      interruption_point();
-    }
-
-    outIndex++;
+    // make regular progress reports, cancelling is checked by the interrupt
+    // region
+    if (outIndex % INTERVAL == 0)
+      reportGroupingProgress(prog4Copy);
+    PARALLEL_END_INTERRUPT_REGION
   }
+  PARALLEL_CHECK_INTERRUPT_REGION
+  const size_t outIndex = groups.size();
 
   // Add the ungrouped spectra to IndexInfo, if they are being kept
   if (keepAll) {
@@ -994,29 +1051,44 @@ size_t GroupDetectors2::formGroupsEvent(const DataObjects::EventWorkspace_const_
 
   g_log.debug() << name() << ": Preparing to group spectra into " << m_GroupWsInds.size() << " groups\n";
 
-  // where we are copying spectra to, we start copying to the start of the
-  // output workspace
-  size_t outIndex = 0;
-  // Only used for averaging behaviour. We may have a 1:1 map where a Divide
-  // would be waste as it would be just dividing by 1
-  bool requireDivide(false);
+  const auto groups = flattenGroups(m_GroupWsInds);
   const auto &spectrumInfo = inputWS->spectrumInfo();
-  for (storage_map::const_iterator it = m_GroupWsInds.begin(); it != m_GroupWsInds.end(); ++it) {
+  // Each group is the only writer of its output event list (and of its entry
+  // in beh) so the groups can be combined independently
+  const auto numGroups = static_cast<int64_t>(groups.size());
+  PRAGMA_OMP(parallel for schedule(dynamic, 1) if (Kernel::threadSafe(*inputWS, *outputWS)))
+  for (int64_t i = 0; i < numGroups; ++i) {
+    PARALLEL_START_INTERRUPT_REGION
+    const auto outIndex = static_cast<size_t>(i);
     // This is the grouped spectrum
     EventList &outEL = outputWS->getSpectrum(outIndex);
 
     // The spectrum number of the group is the key
-    outEL.setSpectrumNo(it->first);
+    outEL.setSpectrumNo(groups.spectrumNumbers[outIndex]);
     // Start fresh with no detector IDs
     outEL.clearDetectorIDs();
 
+    // Adding a list switches the output to the more general event type, so
+    // switch once up front and make room for all of the events to avoid
+    // reallocating as the lists are appended
+    auto eventType = outEL.getEventType();
+    size_t numEvents = 0;
+    for (auto member = groups.begin(outIndex); member != groups.end(outIndex); ++member) {
+      const EventList &fromEL = inputWS->getSpectrum(*member);
+      eventType = std::max(eventType, fromEL.getEventType());
+      numEvents += fromEL.getNumberEvents();
+    }
+    outEL.switchTo(eventType);
+    outEL.reserve(numEvents);
+
     // the Y values and errors from spectra being grouped are combined in the
     // output spectrum
     // Keep track of number of detectors required for masking
     size_t nonMaskedSpectra(0);
     beh->mutableX(outIndex)[0] = 0.0;
     beh->mutableE(outIndex)[0] = 0.0;
-    for (auto originalWI : it->second) {
+    for (auto member = groups.begin(outIndex); member != groups.end(outIndex); ++member) {
+      const auto originalWI = *member;
       const EventList &fromEL = inputWS->getSpectrum(originalWI);
       // Add the event lists with the operator
       outEL += fromEL;
@@ -1029,19 +1101,22 @@ size_t GroupDetectors2::formGroupsEvent(const DataObjects::EventWorkspace_const_
     }
     if (nonMaskedSpectra == 0)
       ++nonMaskedSpectra; // Avoid possible divide by zero
-    if (!requireDivide)
-      requireDivide = (nonMaskedSpectra > 1);
     beh->mutableY(outIndex)[0] = static_cast<double>(nonMaskedSpectra);
 
-    // make regular progress reports and check for cancelling the algorithm
-    if (outIndex % INTERVAL == 0) {
-      m_FracCompl += INTERVAL * prog4Copy;
-      if (m_FracCompl > 1.0)
-        m_FracCompl = 1.0;
-      progress(m_FracCompl);
-      interruption_point();
-    }
-    outIndex++;
+    // make regular progress reports, cancelling is checked by the interrupt
+    // region
+    if (outIndex % INTERVAL == 0)
+      reportGroupingProgress(prog4Copy);
+    PARALLEL_END_INTERRUPT_REGION
+  }
+  PARALLEL_CHECK_INTERRUPT_REGION
+  const size_t outIndex = groups.size();
+
+  // Only used for averaging behaviour. We may have a 1:1 map where a Divide
+  // would be waste as it would be just dividing by 1
+  bool requireDivide(false);
+  for (size_t i = 0; i < outIndex && !requireDivide; ++i) {
+    requireDivide = beh->y(i)[0] > 1.;
   }
 
   if (bhv == 1 && requireDivide) {
@@ -6,12 +6,15 @@
 // SPDX - License - Identifier: GPL - 3.0 +
 #include "MantidDataHandling/H5Util.h"
 #include "MantidAPI/LogManager.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/System.h"
 
 #include <H5Cpp.h>
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <boost/numeric/conversion/cast.hpp>
+#include <zlib.h>
 
 using namespace H5;
 
@@ -167,6 +170,66 @@ template <typename NumT> void writeArray1D(Group &group, const std::string &name
   data.write(values.data(), dataType);
 }
 
+template <typename NumT>
+void writeArray1DCompressed(Group &group, const std::string &name, const NumT *values, const std::size_t length,
+                            const std::size_t chunkLength, const int deflateLevel) {
+  DataType dataType(getType<NumT>());
+  DataSpace dataSpace = getDataSpace(length);
+  if (length == 0) {
+    group.createDataSet(name, dataType, dataSpace);
+    return;
+  }
+
+  const auto chunk = std::min(chunkLength, length);
+  DSetCreatPropList propList = setCompressionAttributes(chunk, deflateLevel);
+  auto data = group.createDataSet(name, dataType, dataSpace, propList);
+
+#if H5_VERSION_GE(1, 10, 2)
+  const auto numChunks = (length + chunk - 1) / chunk;
+  const auto chunkBytes = static_cast<uLong>(chunk * sizeof(NumT));
+  // Only a few chunks per thread are held in memory at once
+  const auto batchSize = static_cast<std::size_t>(4 * PARALLEL_GET_MAX_THREADS);
+  std::vector<std::vector<Bytef>> compressed(std::min(batchSize, numChunks));
+  for (std::size_t firstChunk = 0; firstChunk < numChunks; firstChunk += batchSize) {
+    const auto lastChunk = std::min(firstChunk + batchSize, numChunks);
+    std::atomic<bool> failed{false};
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int64_t i = static_cast<int64_t>(firstChunk); i < static_cast<int64_t>(lastChunk); ++i) {
+      const auto chunkIndex = static_cast<std::size_t>(i);
+      const auto start = chunkIndex * chunk;
+      const auto count = std::min(chunk, length - start);
+      const auto *source = reinterpret_cast<const Bytef *>(values + start);
+      // The last chunk has to be padded out to a full chunk
+      std::vector<Bytef> padded;
+      if (count < chunk) {
+        padded.resize(chunkBytes, 0);
+        std::copy_n(source, count * sizeof(NumT), padded.begin());
+        source = padded.data();
+      }
+      auto &buffer = compressed[chunkIndex - firstChunk];
+      auto compressedBytes = compressBound(chunkBytes);
+      buffer.resize(compressedBytes);
+      if (compress2(buffer.data(), &compressedBytes, source, chunkBytes, deflateLevel) != Z_OK) {
+        failed = true;
+      }
+      buffer.resize(compressedBytes);
+    }
+    if (failed)
+      throw std::runtime_error("Failed to compress the data for \"" + name + "\"");
+
+    for (auto chunkIndex = firstChunk; chunkIndex < lastChunk; ++chunkIndex) {
+      const auto &buffer = compressed[chunkIndex - firstChunk];
+      hsize_t offset[1] = {chunkIndex * chunk};
+      if (H5Dwrite_chunk(data.getId(), H5P_DEFAULT, 0, offset, buffer.size(), buffer.data()) < 0)
+        throw std::runtime_error("Failed to write a chunk of \"" + name + "\"");
+    }
+  }
+#else
+  // Direct chunk writes are not available, HDF5 compresses the data itself
+  data.write(values, dataType);
+#endif
+}
+
 // -------------------------------------------------------------------
 // read methods
 // -------------------------------------------------------------------
@@ -531,6 +594,19 @@ template MANTID_DATAHANDLING_DLL void writeArray1D(H5::Group &group, const std::
 template MANTID_DATAHANDLING_DLL void writeArray1D(H5::Group &group, const std::string &name,
                                                    const std::vector<uint64_t> &values);
 
+// -------------------------------------------------------------------
+// instantiations for writeArray1DCompressed
+// -------------------------------------------------------------------
+template MANTID_DATAHANDLING_DLL void writeArray1DCompressed(H5::Group &group, const std::string &name,
+                                                             const float *values, const std::size_t length,
+                                                             const std::size_t chunkLength, const int deflateLevel);
+template MANTID_DATAHANDLING_DLL void writeArray1DCompressed(H5::Group &group, const std::string &name,
+                                                             const double *values, const std::size_t length,
+                                                             const std::size_t chunkLength, const int deflateLevel);
+template MANTID_DATAHANDLING_DLL void writeArray1DCompressed(H5::Group &group, const std::string &name,
+                                                             const int64_t *values, const std::size_t length,
+                                                             const std::size_t chunkLength, const int deflateLevel);
+
 // -------------------------------------------------------------------
 // Instantiations for writeScalarWithStrAttributes
 // -------------------------------------------------------------------
@@ -38,8 +38,12 @@
 #include <set>
 #include <sstream>
 #include <stdexcept>
+#include <utility>
 #include <vector>
 
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
 #if BOOST_VERSION < 107100
 #include <boost/timer.hpp>
 #else
@@ -300,11 +304,16 @@ void LoadEventPreNexus2::init() {
   declareProperty("DBNumberOutputPulses", EMPTY_INT(), mustBePositive,
                   "Number of output pulses for debugging purpose. ");
 
+  declareProperty("MapEventFile", true,
+                  "Process the events straight from a memory mapping of the event file. "
+                  "If false, or if the file cannot be mapped, the events are read block by block.");
+
   std::string dbgrp = "Investigation Use";
   setPropertyGroup("EventNumberWorkspace", dbgrp);
   setPropertyGroup("DBOutputBlockNumber", dbgrp);
   setPropertyGroup("DBNumberOutputEvents", dbgrp);
   setPropertyGroup("DBNumberOutputPulses", dbgrp);
+  setPropertyGroup("MapEventFile", dbgrp);
 }
 
 //----------------------------------------------------------------------------------------------
@@ -633,9 +642,39 @@ void LoadEventPreNexus2::procEvents(DataObjects::EventWorkspace_sptr &workspace)
   shortest_tof = static_cast<double>(MAX_TOF_UINT32) * TOF_CONVERSION;
   longest_tof = 0.;
 
-  // Set up loading parameters
-  size_t loadBlockSize = Mantid::Kernel::DEFAULT_BLOCK_SIZE * 2;
-  size_t numBlocks = (max_events + loadBlockSize - 1) / loadBlockSize;
+  // Blocks are whole pages of events and start on page boundaries of the
+  // file, so that threads processing consecutive blocks of the mapping do not
+  // share pages. Only the first and the last block can be partial.
+  const size_t eventsPerPage =
+      std::max<size_t>(1, boost::interprocess::mapped_region::get_page_size() / sizeof(DasEvent));
+  const size_t loadBlockSize =
+      (Mantid::Kernel::DEFAULT_BLOCK_SIZE * 2 + eventsPerPage - 1) / eventsPerPage * eventsPerPage;
+  const size_t alignedFirstEvent = first_event / eventsPerPage * eventsPerPage;
+  const size_t lastEvent = first_event + max_events;
+  const size_t numBlocks = max_events > 0 ? (lastEvent - alignedFirstEvent + loadBlockSize - 1) / loadBlockSize : 0;
+
+  // Map the requested range of the event file, from the page it starts in,
+  // into memory so that blocks can be processed in place by every thread,
+  // without copying them into per-thread buffers under a critical section.
+  // Fall back to reading the file block by block if the mapping cannot be
+  // created.
+  std::unique_ptr<boost::interprocess::mapped_region> mappedEvents;
+  const bool mapEventFile = getProperty("MapEventFile");
+  if (mapEventFile && max_events > 0) {
+    try {
+      boost::interprocess::file_mapping mappedFile(m_eventFilename.c_str(), boost::interprocess::read_only);
+      const auto mappingOffset = static_cast<boost::interprocess::offset_t>(alignedFirstEvent * sizeof(DasEvent));
+      const size_t mappingSize = (lastEvent - alignedFirstEvent) * sizeof(DasEvent);
+      mappedEvents = std::make_unique<boost::interprocess::mapped_region>(mappedFile, boost::interprocess::read_only,
+                                                                          mappingOffset, mappingSize);
+      mappedEvents->advise(boost::interprocess::mapped_region::advice_sequential);
+    } catch (boost::interprocess::interprocess_exception &e) {
+      g_log.debug() << "Could not map " << m_eventFilename << " into memory (" << e.what()
+                    << "). Reading it block by block instead.\n";
+      mappedEvents.reset();
+    }
+  }
+  const auto *mappedEventData = mappedEvents ? static_cast<const DasEvent *>(mappedEvents->get_address()) : nullptr;
 
   // We want to pad out empty pixels.
   const auto &detectorInfo = workspace->detectorInfo();
@@ -729,8 +768,8 @@ void LoadEventPreNexus2::procEvents(DataObjects::EventWorkspace_sptr &workspace)
       } else
         partWS = workspace;
 
-      // Allocate the buffers
-      buffers[i] = new DasEvent[loadBlockSize];
+      // Allocate the buffers, only needed if the file is not mapped
+      buffers[i] = mappedEventData ? nullptr : new DasEvent[loadBlockSize];
 
       // For each partial workspace, make an array where index = detector ID and
       // value = pointer to the events vector
@@ -769,21 +808,26 @@ void LoadEventPreNexus2::procEvents(DataObjects::EventWorkspace_sptr &workspace)
       } else
         ws = workspace;
 
-      // Get the buffer (for this thread)
-      DasEvent *event_buffer = buffers[threadNum];
-
       // Get the speeding-up array of vector<tofEvent> where index = detid.
       EventVector_pt *theseEventVectors = eventVectors[threadNum];
 
-      // Where to start in the file?
-      size_t fileOffset = first_event + (loadBlockSize * blockNum);
-      // May need to reduce size of last (or only) block
-      size_t current_event_buffer_size =
-          (blockNum == int(numBlocks - 1)) ? (max_events - (numBlocks - 1) * loadBlockSize) : loadBlockSize;
+      // Where to start in the file? The first and last blocks may be partial.
+      const size_t blockStart = alignedFirstEvent + loadBlockSize * blockNum;
+      size_t fileOffset = std::max(first_event, blockStart);
+      size_t current_event_buffer_size = std::min(lastEvent, blockStart + loadBlockSize) - fileOffset;
 
-      // Load this chunk of event data (critical block)
-      PARALLEL_CRITICAL(LoadEventPreNexus2_fileAccess) {
-        current_event_buffer_size = eventfile->loadBlockAt(event_buffer, fileOffset, current_event_buffer_size);
+      const DasEvent *event_buffer = nullptr;
+      if (mappedEventData) {
+        // Process the events straight from the mapped file
+        event_buffer = mappedEventData + (fileOffset - alignedFirstEvent);
+      } else {
+        // Load this chunk of event data into the buffer for this thread
+        // (critical block)
+        DasEvent *thread_buffer = buffers[threadNum];
+        PARALLEL_CRITICAL(LoadEventPreNexus2_fileAccess) {
+          current_event_buffer_size = eventfile->loadBlockAt(thread_buffer, fileOffset, current_event_buffer_size);
+        }
+        event_buffer = thread_buffer;
       }
 
       // This processes the events. Can be done in parallel!
@@ -825,7 +869,7 @@ void LoadEventPreNexus2::procEvents(DataObjects::EventWorkspace_sptr &workspace)
         // Now merge the event lists
         for (size_t i = 0; i < numThreads; i++) {
           EventList &partEl = partWorkspaces[i]->getSpectrum(wi);
-          el += partEl.getEvents();
+          el += std::as_const(partEl).getEvents();
           // Free up memory as you go along.
           partEl.clear(false);
         }
@@ -907,7 +951,7 @@ void LoadEventPreNexus2::procEvents(DataObjects::EventWorkspace_sptr &workspace)
  * @param dbprint :: flag to print out events information
  */
 void LoadEventPreNexus2::procEventsLinear(DataObjects::EventWorkspace_sptr & /*workspace*/,
-                                          std::vector<TofEvent> **arrayOfVectors, DasEvent *event_buffer,
+                                          std::vector<TofEvent> **arrayOfVectors, const DasEvent *event_buffer,
                                           size_t current_event_buffer_size, size_t fileOffset, bool dbprint) {
   // Starting pulse time
   DateAndTime pulsetime;
@@ -1184,6 +1228,7 @@ void LoadEventPreNexus2::loadPixelMap(const std::string &filename) {
 void LoadEventPreNexus2::openEventFile(const std::string &filename) {
   // Open the file
   eventfile = std::make_unique<BinaryFile<DasEvent>>(filename);
+  m_eventFilename = filename;
   num_events = eventfile->getNumElements();
   g_log.debug() << "File contains " << num_events << " event records.\n";
 
@@ -23,6 +23,7 @@
 #include "MantidKernel/BoundedValidator.h"
 #include "MantidKernel/ConfigService.h"
 #include "MantidKernel/ListValidator.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/TimeSeriesProperty.h"
 #include "MantidKernel/UnitFactory.h"
 
@@ -728,8 +729,12 @@ void LoadISISNexus2::loadPeriodData(int64_t period, NXEntry &entry, DataObjects:
       const int *const spec_begin = m_spec.data();
       // When reading in blocks we need to be careful that the range is exactly
       // divisible by the block-size
-      // and if not have an extra read of the left overs
-      const int64_t blocksize = 8;
+      // and if not have an extra read of the left overs.
+      // Read large slabs of up to about 64MB so the histograms of each slab
+      // can be filled in parallel.
+      const int64_t maxSlabCounts = 16 * 1024 * 1024;
+      const int64_t blocksize =
+          std::max<int64_t>(1, maxSlabCounts / std::max<int64_t>(1, m_detBlockInfo.getNumberOfChannels()));
       const int64_t rangesize = spectraBlock.last - spectraBlock.first + 1;
       const int64_t fullblocks = rangesize / blocksize;
       int64_t spectra_no = spectraBlock.first;
@@ -792,26 +797,34 @@ void LoadISISNexus2::loadBlock(NXDataSetTyped<int> &data, int64_t blocksize, int
                                int64_t &hist, int64_t &spec_num, DataObjects::Workspace2D_sptr &local_workspace) {
   data.load(static_cast<int>(blocksize), static_cast<int>(period),
             static_cast<int>(start)); // TODO this is just wrong
-  int *data_start = data();
-  int *data_end = data_start + m_loadBlockInfo.getNumberOfChannels();
-  int64_t final(hist + blocksize);
-  while (hist < final) {
+  const int *const block_start = data();
+  const auto nchannels = static_cast<int64_t>(m_loadBlockInfo.getNumberOfChannels());
+  const auto stride = static_cast<int64_t>(m_detBlockInfo.getNumberOfChannels());
+  // All the spectra share the same bin edges
+  const BinEdges binEdges(m_tof_data);
+  const int64_t firstHist = hist;
+
+  PARALLEL_FOR_IF(Kernel::threadSafe(*local_workspace))
+  for (int64_t i = 0; i < blocksize; ++i) {
+    PARALLEL_START_INTERRUPT_REGION
     m_progress->report("Loading data");
-    local_workspace->setHistogram(hist, BinEdges(m_tof_data), Counts(data_start, data_end));
-    data_start += m_detBlockInfo.getNumberOfChannels();
-    data_end += m_detBlockInfo.getNumberOfChannels();
+    const int64_t wsIndex = firstHist + i;
+    const int *data_start = block_start + i * stride;
+    local_workspace->setHistogram(wsIndex, binEdges, Counts(data_start, data_start + nchannels));
     if (m_load_selected_spectra) {
-      auto &spec = local_workspace->getSpectrum(hist);
-      specnum_t specNum = m_wsInd2specNum_map.at(hist);
+      auto &spec = local_workspace->getSpectrum(wsIndex);
+      specnum_t specNum = m_wsInd2specNum_map.at(wsIndex);
       // set detectors corresponding to spectra Number
       spec.setDetectorIDs(m_spec2det_map.getDetectorIDsForSpectrumNo(specNum));
       // set correct spectra Number
       spec.setSpectrumNo(specNum);
     }
-
-    ++hist;
-    ++spec_num;
+    PARALLEL_END_INTERRUPT_REGION
   }
+  PARALLEL_CHECK_INTERRUPT_REGION
+
+  hist += blocksize;
+  spec_num += blocksize;
 }
 
 /// Run the Child Algorithm LoadInstrument (or LoadInstrumentFromNexus)
@@ -160,6 +160,28 @@ bool ISISRAW2::readData(FILE *file, int i) {
   return true;
 }
 
+/// Read the compressed data of a spectrum without expanding it, so that the
+/// expansion can be done later, possibly on another thread
+/// @param file :: The file pointer
+/// @param i :: The index of the data block to read
+/// @param buffer :: Filled with the compressed data
+/// @return true on success
+bool ISISRAW2::readCompressedData(FILE *file, int i, std::vector<char> &buffer) {
+  if (i >= ndes)
+    return false;
+  const int nwords = 4 * ddes[i].nwords;
+  buffer.resize(nwords);
+  return ISISRAW::ioRAW(file, buffer.data(), nwords, true) == 0;
+}
+
+/// Expand data read by readCompressedData. This doesn't change the state of
+/// the reader, so it is safe to call from several threads at once.
+/// @param buffer :: The compressed data of one spectrum
+/// @param counts :: Filled with the t_ntc1 + 1 counts of the spectrum
+void ISISRAW2::expandData(const std::vector<char> &buffer, int *counts) const {
+  byte_rel_expn(buffer.data(), static_cast<int>(buffer.size()), 0, counts, t_ntc1 + 1);
+}
+
 ISISRAW2::~ISISRAW2() {
   if (outbuff)
     delete[] outbuff;
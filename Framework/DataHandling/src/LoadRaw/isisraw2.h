@@ -8,6 +8,8 @@
 
 #include "isisraw.h"
 
+#include <vector>
+
 /// isis raw file.
 //  isis raw
 class ISISRAW2 : public ISISRAW {
@@ -19,6 +21,8 @@ public:
 
   void skipData(FILE *file, int i);
   bool readData(FILE *file, int i);
+  bool readCompressedData(FILE *file, int i, std::vector<char> &buffer);
+  void expandData(const std::vector<char> &buffer, int *counts) const;
   void clear();
 
   int ndes; ///< ndes
@@ -17,6 +17,7 @@
 #include "MantidKernel/BoundedValidator.h"
 #include "MantidKernel/ConfigService.h"
 #include "MantidKernel/ListValidator.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/UnitFactory.h"
 
 #include <Poco/Path.h>
@@ -305,12 +306,8 @@ void LoadRaw3::excludeMonitors(FILE *file, const int &period, const std::vector<
         continue;
       }
 
-      // read spectrum
-      if (!readData(file, histToRead)) {
-        throw std::runtime_error("Error reading raw file");
-      }
-      // set the workspace data
-      setWorkspaceData(ws_sptr, m_timeChannelsVec, wsIndex, i, m_noTimeRegimes, m_lengthIn, 1);
+      // read spectrum, the workspace data are set in batches
+      readSpectrum(file, histToRead, ws_sptr, wsIndex, i);
       // increment workspace index
       ++wsIndex;
 
@@ -326,6 +323,7 @@ void LoadRaw3::excludeMonitors(FILE *file, const int &period, const std::vector<
       skipData(file, histToRead);
     }
   } // end of for loop
+  setPendingSpectra();
 }
 
 /**This method creates outputworkspace including monitors
@@ -345,12 +343,8 @@ void LoadRaw3::includeMonitors(FILE *file, const int64_t &period, const DataObje
         (m_list && find(m_spec_list.begin(), m_spec_list.end(), i) != m_spec_list.end())) {
       progress(m_prog, "Reading raw file data...");
 
-      // read spectrum from raw file
-      if (!readData(file, histToRead)) {
-        throw std::runtime_error("Error reading raw file");
-      }
-      // set workspace data
-      setWorkspaceData(ws_sptr, m_timeChannelsVec, wsIndex, i, m_noTimeRegimes, m_lengthIn, 1);
+      // read spectrum from raw file, the workspace data are set in batches
+      readSpectrum(file, histToRead, ws_sptr, wsIndex, i);
       ++wsIndex;
 
       if (m_numberOfPeriods == 1) {
@@ -364,6 +358,7 @@ void LoadRaw3::includeMonitors(FILE *file, const int64_t &period, const DataObje
       skipData(file, histToRead);
     }
   }
+  setPendingSpectra();
   // loadSpectra(file,period,m_total_specs,ws_sptr,m_timeChannelsVec);
 }
 
@@ -389,17 +384,14 @@ void LoadRaw3::separateMonitors(FILE *file, const int64_t &period, const std::ve
         (m_list && find(m_spec_list.begin(), m_spec_list.end(), i) != m_spec_list.end())) {
       progress(m_prog, "Reading raw file data...");
 
-      // read spectrum from raw file
-      if (!readData(file, histToRead)) {
-        throw std::runtime_error("Error reading raw file");
-      }
+      // read spectrum from raw file, the workspace data are set in batches
       // if this a monitor, store that spectrum to monitor workspace
       if (isMonitor(monitorList, i)) {
-        setWorkspaceData(mws_sptr, m_timeChannelsVec, mwsIndex, i, m_noTimeRegimes, m_lengthIn, 1);
+        readSpectrum(file, histToRead, mws_sptr, mwsIndex, i);
         ++mwsIndex;
       } else {
         // not a monitor, store the spectrum to normal output workspace
-        setWorkspaceData(ws_sptr, m_timeChannelsVec, wsIndex, i, m_noTimeRegimes, m_lengthIn, 1);
+        readSpectrum(file, histToRead, ws_sptr, wsIndex, i);
         ++wsIndex;
       }
 
@@ -414,6 +406,62 @@ void LoadRaw3::separateMonitors(FILE *file, const int64_t &period, const std::ve
       skipData(file, histToRead);
     }
   }
+  setPendingSpectra();
+}
+
+/** Read the compressed data of a spectrum from the file. Expanding the data
+ * is what takes the time, so it is deferred until a batch of spectra has been
+ * read and then done in parallel by setPendingSpectra.
+ *@param file :: pointer to file
+ *@param histToRead :: index of the data block in the file
+ *@param ws :: workspace the spectrum goes into, the spectrum is skipped if null
+ *@param wsIndex :: workspace index the spectrum goes into
+ *@param spectrumNumber :: spectrum number of the spectrum
+ */
+void LoadRaw3::readSpectrum(FILE *file, int64_t histToRead, const DataObjects::Workspace2D_sptr &ws, int64_t wsIndex,
+                            specnum_t spectrumNumber) {
+  if (!ws) {
+    skipData(file, histToRead);
+    return;
+  }
+  if (m_numPendingSpectra == m_pendingSpectra.size())
+    m_pendingSpectra.emplace_back();
+  auto &pending = m_pendingSpectra[m_numPendingSpectra];
+  if (!isisRaw().readCompressedData(file, static_cast<int>(histToRead), pending.compressed)) {
+    throw std::runtime_error("Error reading raw file");
+  }
+  pending.workspace = ws.get();
+  pending.wsIndex = wsIndex;
+  pending.spectrumNumber = spectrumNumber;
+  ++m_numPendingSpectra;
+  m_pendingBytes += pending.compressed.size();
+
+  // Limit the memory held by the batch as well as its length
+  constexpr size_t maxPendingSpectra = 1024;
+  constexpr size_t maxPendingBytes = 64 * 1024 * 1024;
+  if (m_numPendingSpectra >= maxPendingSpectra || m_pendingBytes >= maxPendingBytes)
+    setPendingSpectra();
+}
+
+/** Expand the spectra read by readSpectrum and set them in their workspaces.
+ * The spectra are independent of each other so they are done in parallel.
+ */
+void LoadRaw3::setPendingSpectra() {
+  const auto numPending = static_cast<int64_t>(m_numPendingSpectra);
+  const auto &reader = isisRaw();
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int64_t i = 0; i < numPending; ++i) {
+    PARALLEL_START_INTERRUPT_REGION
+    const auto &pending = m_pendingSpectra[i];
+    std::vector<uint32_t> counts(m_lengthIn);
+    reader.expandData(pending.compressed, reinterpret_cast<int *>(counts.data()));
+    setWorkspaceData(*pending.workspace, m_timeChannelsVec, pending.wsIndex, pending.spectrumNumber, m_noTimeRegimes,
+                     m_lengthIn, 1, counts.data());
+    PARALLEL_END_INTERRUPT_REGION
+  }
+  PARALLEL_CHECK_INTERRUPT_REGION
+  m_numPendingSpectra = 0;
+  m_pendingBytes = 0;
 }
 
 /**
@@ -420,31 +420,52 @@ void LoadRawHelper::setWorkspaceData(const DataObjects::Workspace2D_sptr &newWor
                                      int64_t binStart) {
   if (!newWorkspace)
     return;
+  setWorkspaceData(*newWorkspace, timeChannelsVec, wsIndex, nspecNum, noTimeRegimes, lengthIn, binStart,
+                   isisRaw().dat1);
+}
 
+/** This method sets the counts of a spectrum to workspace vectors. It does not
+ *  use the reader's data buffer, so it can be called from several threads at
+ *  once for different workspace indices.
+ *  @param newWorkspace ::  the  workspace
+ *  @param timeChannelsVec ::  vector holding the X data
+ *  @param  wsIndex  variable used for indexing the output workspace
+ *  @param  nspecNum  spectrum number
+ *  @param noTimeRegimes ::   regime no.
+ *  @param lengthIn :: length of the workspace
+ *  @param binStart :: start of bin
+ *  @param counts :: the expanded counts of the spectrum
+ */
+void LoadRawHelper::setWorkspaceData(DataObjects::Workspace2D &newWorkspace,
+                                     const std::vector<std::shared_ptr<HistogramData::HistogramX>> &timeChannelsVec,
+                                     int64_t wsIndex, specnum_t nspecNum, int64_t noTimeRegimes, int64_t lengthIn,
+                                     int64_t binStart, const uint32_t *counts) const {
   // But note that the last (overflow) bin is kept
-  auto &Y = newWorkspace->mutableY(wsIndex);
-  Y.assign(isisRaw().dat1 + binStart, isisRaw().dat1 + lengthIn);
+  auto &Y = newWorkspace.mutableY(wsIndex);
+  Y.assign(counts + binStart, counts + lengthIn);
   // Fill the vector for the errors, containing sqrt(count)
-  newWorkspace->setCountVariances(wsIndex, Y.rawData());
+  newWorkspace.setCountVariances(wsIndex, Y.rawData());
 
-  newWorkspace->getSpectrum(wsIndex).setSpectrumNo(nspecNum);
+  newWorkspace.getSpectrum(wsIndex).setSpectrumNo(nspecNum);
   // for loadrawbin0
   if (binStart == 0) {
-    newWorkspace->setX(wsIndex, timeChannelsVec[0]);
+    newWorkspace.setX(wsIndex, timeChannelsVec[0]);
     return;
   }
   // for loadrawspectrum 0
   if (nspecNum == 0) {
-    newWorkspace->setX(wsIndex, timeChannelsVec[0]);
+    newWorkspace.setX(wsIndex, timeChannelsVec[0]);
     return;
   }
   // Set the X vector pointer and spectrum number
   if (noTimeRegimes < 2)
-    newWorkspace->setX(wsIndex, timeChannelsVec[0]);
+    newWorkspace.setX(wsIndex, timeChannelsVec[0]);
   else {
-
     // Use std::vector::at just incase spectrum missing from spec array
-    newWorkspace->setX(wsIndex, timeChannelsVec.at(m_specTimeRegimes[nspecNum] - 1));
+    const auto regime = m_specTimeRegimes.find(nspecNum);
+    if (regime == m_specTimeRegimes.end())
+      throw std::out_of_range("No time regime found for spectrum " + std::to_string(nspecNum));
+    newWorkspace.setX(wsIndex, timeChannelsVec.at(regime->second - 1));
   }
 }
 
@@ -12,6 +12,7 @@
 #include "MantidAPI/IMDEventWorkspace.h"
 #include "MantidAPI/IMDHistoWorkspace.h"
 #include "MantidAPI/WorkspaceHistory.h"
+#include "MantidDataHandling/H5Util.h"
 #include "MantidDataObjects/EventWorkspace.h"
 #include "MantidDataObjects/GroupingWorkspace.h"
 #include "MantidDataObjects/MaskWorkspace.h"
@@ -21,6 +22,7 @@
 #include "MantidKernel/ArrayProperty.h"
 #include "MantidKernel/BoundedValidator.h"
 #include "MantidNexus/NexusFileIO.h"
+#include <H5Cpp.h>
 #include <memory>
 #include <utility>
 
@@ -144,7 +146,8 @@ void SaveNexusProcessed::init() {
 
   declareProperty("CompressNexus", false,
                   "For EventWorkspaces, compress the Nexus data field (default False).\n"
-                  "This will make smaller files but takes much longer.");
+                  "This will make smaller files but takes longer. The compression "
+                  "is spread over all of the available cores.");
   setPropertySettings("CompressNexus",
                       std::make_unique<EnabledWhenWorkspaceIsType<EventWorkspace>>("InputWorkspace", true));
 }
@@ -362,9 +365,13 @@ void SaveNexusProcessed::exec() {
   auto nexusFile = std::make_shared<Mantid::NeXus::NexusFileIO>();
 
   // Perform the execution.
+  m_compressedEventData.clear();
   doExec(inputWorkspace, nexusFile);
 
-  // nexusFile->closeNexusFile();
+  if (!m_compressedEventData.empty()) {
+    nexusFile->closeNexusFile();
+    writeCompressedEventData(getPropertyValue("Filename"));
+  }
 }
 
 //-------------------------------------------------------------------------------------
@@ -429,10 +436,10 @@ void SaveNexusProcessed::execEvent(const Mantid::NeXus::NexusFileIO *nexusFile,
 
   // Initialize all the arrays
   int64_t num = index;
-  double *tofs = nullptr;
-  float *weights = nullptr;
-  float *errorSquareds = nullptr;
-  int64_t *pulsetimes = nullptr;
+  std::unique_ptr<double[]> tofs;
+  std::unique_ptr<float[]> weights;
+  std::unique_ptr<float[]> errorSquareds;
+  std::unique_ptr<int64_t[]> pulsetimes;
 
   // overall event type.
   EventType type = m_eventWorkspace->getEventType();
@@ -458,13 +465,13 @@ void SaveNexusProcessed::execEvent(const Mantid::NeXus::NexusFileIO *nexusFile,
 
   // --- Initialize the combined event arrays ----
   if (writeTOF)
-    tofs = new double[num];
+    tofs = std::make_unique_for_overwrite<double[]>(num);
   if (writeWeight)
-    weights = new float[num];
+    weights = std::make_unique_for_overwrite<float[]>(num);
   if (writeError)
-    errorSquareds = new float[num];
+    errorSquareds = std::make_unique_for_overwrite<float[]>(num);
   if (writePulsetime)
-    pulsetimes = new int64_t[num];
+    pulsetimes = std::make_unique_for_overwrite<int64_t[]>(num);
 
   // --- Fill in the combined event arrays ----
   PARALLEL_FOR_NO_WSP_CHECK()
@@ -478,13 +485,15 @@ void SaveNexusProcessed::execEvent(const Mantid::NeXus::NexusFileIO *nexusFile,
 
     switch (el.getEventType()) {
     case TOF:
-      appendEventListData(el.getEvents(), offset, tofs, weights, errorSquareds, pulsetimes);
+      appendEventListData(el.getEvents(), offset, tofs.get(), weights.get(), errorSquareds.get(), pulsetimes.get());
       break;
     case WEIGHTED:
-      appendEventListData(el.getWeightedEvents(), offset, tofs, weights, errorSquareds, pulsetimes);
+      appendEventListData(el.getWeightedEvents(), offset, tofs.get(), weights.get(), errorSquareds.get(),
+                          pulsetimes.get());
       break;
     case WEIGHTED_NOTIME:
-      appendEventListData(el.getWeightedEventsNoTime(), offset, tofs, weights, errorSquareds, pulsetimes);
+      appendEventListData(el.getWeightedEventsNoTime(), offset, tofs.get(), weights.get(), errorSquareds.get(),
+                          pulsetimes.get());
       break;
     }
     m_progress->reportIncrement(el.getNumberEvents(), "Copying EventList");
@@ -496,15 +505,47 @@ void SaveNexusProcessed::execEvent(const Mantid::NeXus::NexusFileIO *nexusFile,
   /*Default = DONT compress - much faster*/
   bool CompressNexus = getProperty("CompressNexus");
 
+  if (CompressNexus && nexusFile->isHDF5()) {
+    // Only write the indices now. The events are compressed in parallel and
+    // written straight to the HDF5 file once the NeXus API has closed it.
+    nexusFile->writeNexusProcessedDataEventCombined(m_eventWorkspace, indices, nullptr, nullptr, nullptr, nullptr,
+                                                    CompressNexus);
+    m_compressedEventData.emplace_back(CompressedEventData{"/" + nexusFile->entryName() + "/event_workspace",
+                                                           static_cast<size_t>(num), std::move(tofs),
+                                                           std::move(weights), std::move(errorSquareds),
+                                                           std::move(pulsetimes)});
+    return;
+  }
+
   // Write out to the NXS file.
-  nexusFile->writeNexusProcessedDataEventCombined(m_eventWorkspace, indices, tofs, weights, errorSquareds, pulsetimes,
-                                                  CompressNexus);
-
-  // Free mem.
-  delete[] tofs;
-  delete[] weights;
-  delete[] errorSquareds;
-  delete[] pulsetimes;
+  nexusFile->writeNexusProcessedDataEventCombined(m_eventWorkspace, indices, tofs.get(), weights.get(),
+                                                  errorSquareds.get(), pulsetimes.get(), CompressNexus);
+}
+
+//-----------------------------------------------------------------------------------------------
+/** Write the event arrays that were held back by execEvent as compressed
+ * datasets. The NeXus file must have been closed.
+ * @param filename :: the file being saved
+ */
+void SaveNexusProcessed::writeCompressedEventData(const std::string &filename) {
+  if (m_compressedEventData.empty())
+    return;
+
+  H5::H5File file(filename, H5F_ACC_RDWR);
+  for (const auto &events : m_compressedEventData) {
+    H5::Group group = file.openGroup(events.groupPath);
+    if (events.tofs)
+      H5Util::writeArray1DCompressed(group, "tof", events.tofs.get(), events.numberOfEvents);
+    if (events.pulsetimes)
+      H5Util::writeArray1DCompressed(group, "pulsetime", events.pulsetimes.get(), events.numberOfEvents);
+    if (events.weights)
+      H5Util::writeArray1DCompressed(group, "weight", events.weights.get(), events.numberOfEvents);
+    if (events.errorSquareds)
+      H5Util::writeArray1DCompressed(group, "error_squared", events.errorSquareds.get(), events.numberOfEvents);
+    if (m_progress)
+      m_progress->reportIncrement(events.numberOfEvents, "Compressing events");
+  }
+  m_compressedEventData.clear();
 }
 
 //-----------------------------------------------------------------------------------------------
@@ -550,6 +591,7 @@ bool SaveNexusProcessed::processGroups() {
   }
 
   nexusFile->closeNexusFile();
+  writeCompressedEventData(getPropertyValue("Filename"));
 
   return true;
 }
@@ -656,6 +656,54 @@ public:
     TS_ASSERT_DELTA((input->y(2)[0] + input->y(3)[0] + input->y(4)[0]) / 3, output->y(0)[0], 0.00001);
   }
 
+  void test_many_groups_events_and_histograms() {
+    // Enough groups for the groups to be shared between threads and for
+    // several progress reports
+    const int numPixels = 600;
+    const int numBins = 5;
+    const int numEvents = 2;
+    EventWorkspace_sptr input = WorkspaceCreationHelper::createEventWorkspace(numPixels, numBins, numEvents, 0, 1, 4);
+    std::string pattern;
+    for (int i = 0; i < numPixels; i += 2) {
+      pattern += (i == 0 ? "" : ",") + std::to_string(i) + "+" + std::to_string(i + 1);
+    }
+    for (const bool preserveEvents : {true, false}) {
+      GroupDetectors2 gd2;
+      gd2.initialize();
+      gd2.setChild(true);
+      gd2.setRethrows(true);
+      gd2.setProperty("InputWorkspace", std::dynamic_pointer_cast<MatrixWorkspace>(input));
+      gd2.setPropertyValue("OutputWorkspace", "_unused_for_child");
+      gd2.setPropertyValue("GroupingPattern", pattern);
+      gd2.setProperty("PreserveEvents", preserveEvents);
+      TS_ASSERT_THROWS_NOTHING(gd2.execute());
+      TS_ASSERT(gd2.isExecuted())
+      MatrixWorkspace_sptr output = gd2.getProperty("OutputWorkspace");
+      TS_ASSERT_EQUALS(output->getNumberHistograms(), numPixels / 2)
+      auto outputEvents = std::dynamic_pointer_cast<EventWorkspace>(output);
+      TS_ASSERT_EQUALS(outputEvents != nullptr, preserveEvents)
+      for (size_t i = 0; i < output->getNumberHistograms(); ++i) {
+        auto expectedDetIds = input->getSpectrum(2 * i).getDetectorIDs();
+        const auto &secondDetIds = input->getSpectrum(2 * i + 1).getDetectorIDs();
+        expectedDetIds.insert(secondDetIds.cbegin(), secondDetIds.cend());
+        TS_ASSERT_EQUALS(output->getSpectrum(i).getDetectorIDs(), expectedDetIds)
+        for (size_t bin = 0; bin < numBins; ++bin) {
+          TS_ASSERT_DELTA(output->y(i)[bin], input->y(2 * i)[bin] + input->y(2 * i + 1)[bin], 1e-10)
+        }
+        if (outputEvents) {
+          // The members are appended in the order they are listed
+          const auto &outEL = outputEvents->getSpectrum(i);
+          const auto &firstEL = input->getSpectrum(2 * i);
+          TS_ASSERT_EQUALS(outEL.getNumberEvents(), firstEL.getNumberEvents() +
+                                                        input->getSpectrum(2 * i + 1).getNumberEvents())
+          if (firstEL.getNumberEvents() > 0) {
+            TS_ASSERT_EQUALS(outEL.getEvents().front().tof(), firstEL.getEvents().front().tof())
+          }
+        }
+      }
+    }
+  }
+
   void test_GroupingWorkspace_ThreeGroup_NoUngrouped_dontPreserveEvents_inplace() {
     dotestGroupingWorkspace(3, false, false, true, false);
   }
@@ -158,6 +158,57 @@ public:
     removeFile(FILENAME);
   }
 
+  void test_array1d_compressed() {
+    const std::string FILENAME("H5UtilTest_array1d_compressed.h5");
+    const std::string GRP_NAME("array1d");
+    // several full chunks and a partial one at the end
+    const std::size_t chunkLength = 64;
+    std::vector<double> array1d_double(10 * chunkLength + 7);
+    std::vector<int64_t> array1d_int64(array1d_double.size());
+    for (std::size_t i = 0; i < array1d_double.size(); ++i) {
+      array1d_double[i] = 0.5 * static_cast<double>(i % 17);
+      array1d_int64[i] = static_cast<int64_t>(i) * 1000000000;
+    }
+    const std::vector<float> array1d_float = {0, 1, 2, 3, 4};
+
+    // HDF doesn't like opening existing files in write mode
+    removeFile(FILENAME);
+
+    { // write tests
+      H5File file(FILENAME, H5F_ACC_EXCL);
+      auto group = H5Util::createGroupNXS(file, GRP_NAME, "NXentry");
+      H5Util::writeArray1DCompressed(group, "array1d_double", array1d_double.data(), array1d_double.size(),
+                                     chunkLength);
+      H5Util::writeArray1DCompressed(group, "array1d_int64", array1d_int64.data(), array1d_int64.size(), chunkLength);
+      // smaller than one chunk
+      H5Util::writeArray1DCompressed(group, "array1d_float", array1d_float.data(), array1d_float.size(), chunkLength);
+      H5Util::writeArray1DCompressed(group, "array1d_empty", array1d_float.data(), 0, chunkLength);
+      file.close();
+    }
+
+    { // read tests
+      H5File file(FILENAME, H5F_ACC_RDONLY);
+      auto group = file.openGroup(GRP_NAME);
+      TS_ASSERT_EQUALS(H5Util::readArray1DCoerce<double>(group, "array1d_double"), array1d_double);
+      TS_ASSERT_EQUALS(H5Util::readArray1DCoerce<int64_t>(group, "array1d_int64"), array1d_int64);
+      TS_ASSERT_EQUALS(H5Util::readArray1DCoerce<float>(group, "array1d_float"), array1d_float);
+      TS_ASSERT_EQUALS(group.openDataSet("array1d_empty").getSpace().getSelectNpoints(), 0);
+
+      // stored as an ordinary deflated dataset
+      auto dataset = group.openDataSet("array1d_double");
+      auto propList = dataset.getCreatePlist();
+      TS_ASSERT_EQUALS(propList.getLayout(), H5D_CHUNKED);
+      TS_ASSERT_EQUALS(propList.getNfilters(), 1);
+      hsize_t chunkDims[1];
+      propList.getChunk(1, chunkDims);
+      TS_ASSERT_EQUALS(chunkDims[0], chunkLength);
+      file.close();
+    }
+
+    // cleanup
+    removeFile(FILENAME);
+  }
+
   void test_string_vector() {
     std::vector<std::string> readout;
     const std::string filename = "test_string_vec.h5";
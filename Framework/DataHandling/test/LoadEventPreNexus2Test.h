@@ -20,6 +20,7 @@
 #include "MantidKernel/DateAndTime.h"
 #include "MantidKernel/TimeSeriesProperty.h"
 
+#include <algorithm>
 #include <sys/stat.h>
 
 using namespace Mantid;
@@ -279,6 +280,56 @@ public:
     TS_ASSERT_EQUALS(chunk1->getNumberEvents(), 56139)
     TS_ASSERT_EQUALS(chunk2->getNumberEvents(), 56127)
   }
+
+  void test_parallel_load_gives_the_same_events_as_serial_load() {
+    const auto serial = load({{"UseParallelProcessing", "Serial"}});
+    const auto parallel = load({{"UseParallelProcessing", "Parallel"}});
+    TS_ASSERT_EQUALS(parallel->getNumberEvents(), 112266);
+    compareEvents(*serial, *parallel);
+  }
+
+  void test_reading_the_file_block_by_block_gives_the_same_events_as_mapping_it() {
+    // The second chunk does not start on a page boundary of the file
+    const std::vector<std::pair<std::string, std::string>> chunk{
+        {"UseParallelProcessing", "Parallel"}, {"ChunkNumber", "2"}, {"TotalChunks", "2"}};
+    auto notMappedChunk = chunk;
+    notMappedChunk.emplace_back("MapEventFile", "0");
+    const auto mapped = load(chunk);
+    const auto notMapped = load(notMappedChunk);
+    TS_ASSERT_EQUALS(notMapped->getNumberEvents(), 56127);
+    compareEvents(*mapped, *notMapped);
+  }
+
+private:
+  EventWorkspace_sptr load(const std::vector<std::pair<std::string, std::string>> &properties) {
+    LoadEventPreNexus2 loader;
+    loader.initialize();
+    loader.setChild(true);
+    loader.setPropertyValue("EventFilename", "CNCS_7860_neutron_event.dat");
+    loader.setPropertyValue("OutputWorkspace", "unused_for_child");
+    for (const auto &property : properties)
+      loader.setPropertyValue(property.first, property.second);
+    TS_ASSERT(loader.execute());
+    IEventWorkspace_sptr outputWS = loader.getProperty("OutputWorkspace");
+    return std::dynamic_pointer_cast<EventWorkspace>(outputWS);
+  }
+
+  /// The events of each spectrum may be in a different order, depending on which thread loaded them
+  void compareEvents(const EventWorkspace &expected, const EventWorkspace &actual) {
+    TS_ASSERT_EQUALS(expected.getNumberEvents(), actual.getNumberEvents());
+    TS_ASSERT_EQUALS(expected.getNumberHistograms(), actual.getNumberHistograms());
+    if (expected.getNumberHistograms() != actual.getNumberHistograms())
+      return;
+    for (size_t i = 0; i < expected.getNumberHistograms(); ++i) {
+      auto expectedTofs = expected.getSpectrum(i).getTofs();
+      auto actualTofs = actual.getSpectrum(i).getTofs();
+      std::sort(expectedTofs.begin(), expectedTofs.end());
+      std::sort(actualTofs.begin(), actualTofs.end());
+      TSM_ASSERT_EQUALS("Spectrum " + std::to_string(i), expectedTofs, actualTofs);
+      if (expectedTofs != actualTofs)
+        return;
+    }
+  }
 };
 
 //------------------------------------------------------------------------------
@@ -294,4 +345,16 @@ public:
     loader.setPropertyValue("OutputWorkspace", "LoadEventPreNexus2_outws");
     TS_ASSERT(loader.execute());
   }
+
+  void testParallelLoad() {
+    LoadEventPreNexus2 loader;
+    loader.initialize();
+    loader.setPropertyValue("EventFilename", "CNCS_7860_neutron_event.dat");
+    loader.setPropertyValue("UseParallelProcessing", "Parallel");
+    loader.setPropertyValue("OutputWorkspace", "LoadEventPreNexus2_outws");
+    TS_ASSERT(loader.execute());
+    // The events are compared with a serial load in LoadEventPreNexus2Test
+    auto outputWS = AnalysisDataService::Instance().retrieveWS<EventWorkspace>("LoadEventPreNexus2_outws");
+    TS_ASSERT_EQUALS(outputWS->getNumberEvents(), 112266);
+  }
 };
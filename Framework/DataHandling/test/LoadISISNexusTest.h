@@ -1507,4 +1507,21 @@ public:
     loader.setPropertyValue("OutputWorkspace", "ws");
     TS_ASSERT(loader.execute());
   }
+
+  void testLoadMultiPeriod() {
+    LoadISISNexus2 loader;
+    loader.initialize();
+    loader.setPropertyValue("Filename", "POLREF00004699.nxs");
+    loader.setPropertyValue("OutputWorkspace", "ws");
+    TS_ASSERT(loader.execute());
+  }
+
+  void testLoadLongSpectra() {
+    // 17036 bins per spectrum
+    LoadISISNexus2 loader;
+    loader.initialize();
+    loader.setPropertyValue("Filename", "INS09161.nxs");
+    loader.setPropertyValue("OutputWorkspace", "ws");
+    TS_ASSERT(loader.execute());
+  }
 };
@@ -1184,4 +1184,13 @@ public:
     loader.setPropertyValue("OutputWorkspace", "ws");
     TS_ASSERT(loader.execute());
   }
+
+  void testLoadSeparateMonitors() {
+    LoadRaw3 loader;
+    loader.initialize();
+    loader.setPropertyValue("Filename", "HET15869.raw");
+    loader.setPropertyValue("OutputWorkspace", "ws");
+    loader.setPropertyValue("LoadMonitors", "Separate");
+    TS_ASSERT(loader.execute());
+  }
 };
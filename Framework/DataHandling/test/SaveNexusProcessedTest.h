@@ -307,6 +307,34 @@ public:
                                 true /* DONT preserve events */, true /* Compress */);
   }
 
+  void testExec_EventWorkspace_CompressNexus_reloads() {
+    std::string outputFile;
+    const auto inputWS = do_testExec_EventWorkspaces("SaveNexusProcessed_Compressed", WEIGHTED_NOTIME, outputFile,
+                                                     true /* different types */, false, true, true /* Compress */);
+
+    LoadNexus loadAlg;
+    loadAlg.initialize();
+    loadAlg.setPropertyValue("Filename", outputFile);
+    loadAlg.setPropertyValue("OutputWorkspace", "SaveNexusProcessed_Compressed_reloaded");
+    TS_ASSERT_THROWS_NOTHING(loadAlg.execute());
+    TS_ASSERT(loadAlg.isExecuted());
+    const auto reloaded =
+        AnalysisDataService::Instance().retrieveWS<EventWorkspace>("SaveNexusProcessed_Compressed_reloaded");
+    TS_ASSERT(reloaded);
+    if (reloaded) {
+      TS_ASSERT_EQUALS(reloaded->getNumberHistograms(), inputWS->getNumberHistograms());
+      TS_ASSERT_EQUALS(reloaded->getNumberEvents(), inputWS->getNumberEvents());
+      for (size_t wi = 0; wi < inputWS->getNumberHistograms(); ++wi) {
+        TS_ASSERT_EQUALS(reloaded->getSpectrum(wi).getNumberEvents(), inputWS->getSpectrum(wi).getNumberEvents());
+        TS_ASSERT_EQUALS(reloaded->getSpectrum(wi).getTofs(), inputWS->getSpectrum(wi).getTofs());
+        TS_ASSERT_EQUALS(reloaded->getSpectrum(wi).getWeights(), inputWS->getSpectrum(wi).getWeights());
+      }
+    }
+    AnalysisDataService::Instance().remove("SaveNexusProcessed_Compressed_reloaded");
+    if (clearfiles)
+      Poco::File(outputFile).remove();
+  }
+
   void testExecSaveLabel() {
     SaveNexusProcessed alg;
     if (!alg.isInitialized())
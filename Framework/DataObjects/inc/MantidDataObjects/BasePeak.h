@@ -91,6 +91,7 @@ public:
   Mantid::Kernel::Matrix<double> getGoniometerMatrix() const override;
   Mantid::Kernel::Matrix<double> getInverseGoniometerMatrix() const;
   void setGoniometerMatrix(const Mantid::Kernel::Matrix<double> &goniometerMatrix) override;
+  bool shareGoniometerMatrix(const BasePeak &other);
 
   void setPeakNumber(int m_peakNumber) override;
   int getPeakNumber() const override;
@@ -143,12 +144,22 @@ private:
   /// absorption weighted path length (aka t bar)
   double m_absorptionWeightedPathLength;
 
-  /// Orientation matrix of the goniometer angles.
-  Mantid::Kernel::Matrix<double> m_GoniometerMatrix;
-
-  /// Inverse of the goniometer rotation matrix; used to go from Q in lab frame
-  /// to Q in sample frame
-  Mantid::Kernel::Matrix<double> m_InverseGoniometerMatrix;
+  /// The goniometer rotation matrix and its inverse. These are immutable once
+  /// created so that copies of a peak, and peaks from the same run, can share them.
+  struct GoniometerMatrices {
+    explicit GoniometerMatrices(const Mantid::Kernel::Matrix<double> &goniometerMatrix);
+    /// Orientation matrix of the goniometer angles.
+    Mantid::Kernel::Matrix<double> matrix;
+    /// Inverse of the goniometer rotation matrix; used to go from Q in lab
+    /// frame to Q in sample frame
+    Mantid::Kernel::Matrix<double> inverse;
+    /// True if the matrix could not be inverted
+    bool singular;
+  };
+  static std::shared_ptr<const GoniometerMatrices> identityGoniometer();
+
+  /// Goniometer matrices, shared between peaks
+  std::shared_ptr<const GoniometerMatrices> m_goniometer;
 
   /// Originating run number for this peak
   int m_runNumber;
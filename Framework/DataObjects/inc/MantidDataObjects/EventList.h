@@ -102,7 +102,7 @@ public:
    * @param event :: TofEvent to add at the end of the list.
    * */
   inline void addEventQuickly(const Types::Event::TofEvent &event) {
-    this->events.emplace_back(event);
+    this->events.access().emplace_back(event);
     this->setSortOrder(UNSORTED);
   }
 
@@ -112,7 +112,7 @@ public:
    * @param event :: WeightedEvent to add at the end of the list.
    * */
   inline void addEventQuickly(const WeightedEvent &event) {
-    this->weightedEvents.emplace_back(event);
+    this->weightedEvents.access().emplace_back(event);
     this->setSortOrder(UNSORTED);
   }
 
@@ -122,7 +122,7 @@ public:
    * @param event :: WeightedEventNoTime to add at the end of the list.
    * */
   inline void addEventQuickly(const WeightedEventNoTime &event) {
-    this->weightedEventsNoTime.emplace_back(event);
+    this->weightedEventsNoTime.access().emplace_back(event);
     this->setSortOrder(UNSORTED);
   }
 
@@ -209,6 +209,7 @@ public:
   void generateHistogram(const MantidVec &X, MantidVec &Y, MantidVec &E, bool skipError = false) const override;
   void generateHistogram(const double step, const MantidVec &X, MantidVec &Y, MantidVec &E,
                          bool skipError = false) const;
+  void generateHistogramWithoutSorting(const MantidVec &X, MantidVec &Y, MantidVec &E, bool skipError = false) const;
   void generateHistogramPulseTime(const MantidVec &X, MantidVec &Y, MantidVec &E,
                                   bool skipError = false) const override;
 
@@ -232,6 +233,7 @@ public:
   void addPulsetimes(const std::vector<double> &seconds) override;
 
   void maskTof(const double tofMin, const double tofMax) override;
+  void cropTof(const double tofMin, const double tofMax);
   void maskCondition(const std::vector<bool> &mask) override;
 
   void getTofs(std::vector<double> &tofs) const override;
@@ -325,14 +327,19 @@ private:
   /// Histogram object holding the histogram data. Currently only X.
   HistogramData::Histogram m_histogram;
 
+  // The event vectors are shared copy-on-write between copies of an EventList,
+  // so copying a list is cheap and the events are only duplicated when one of
+  // the copies is modified. Read through operator* and operator->, and use
+  // access() before modifying the events.
+
   /// List of TofEvent (no weights).
-  mutable std::vector<Types::Event::TofEvent> events;
+  mutable Kernel::cow_ptr<std::vector<Types::Event::TofEvent>> events;
 
   /// List of WeightedEvent's
-  mutable std::vector<WeightedEvent> weightedEvents;
+  mutable Kernel::cow_ptr<std::vector<WeightedEvent>> weightedEvents;
 
   /// List of WeightedEvent's
-  mutable std::vector<WeightedEventNoTime> weightedEventsNoTime;
+  mutable Kernel::cow_ptr<std::vector<WeightedEventNoTime>> weightedEventsNoTime;
 
   /// What type of event is in our list.
   Mantid::API::EventType eventType;
@@ -405,8 +412,8 @@ private:
   static void histogramForWeightsHelper(const std::vector<T> &events, const double step, const MantidVec &X,
                                         MantidVec &Y, MantidVec &E);
   template <class T>
-  static void integrateHelper(std::vector<T> &events, const double minX, const double maxX, const bool entireRange,
-                              double &sum, double &error);
+  static void integrateHelper(const std::vector<T> &events, const double minX, const double maxX,
+                              const bool entireRange, double &sum, double &error);
   template <class T> void convertTofHelper(std::vector<T> &events, const std::function<double(double)> &func);
 
   template <class T> void convertTofHelper(std::vector<T> &events, const double factor, const double offset);
@@ -425,11 +432,11 @@ private:
 
   template <class T> static void setTofsHelper(std::vector<T> &events, const std::vector<double> &tofs);
   template <class T>
-  static void filterByPulseTimeHelper(std::vector<T> &events, Types::Core::DateAndTime start,
+  static void filterByPulseTimeHelper(const std::vector<T> &events, Types::Core::DateAndTime start,
                                       Types::Core::DateAndTime stop, std::vector<T> &output);
 
   template <class T>
-  static void filterByTimeROIHelper(std::vector<T> &events, const std::vector<Kernel::TimeInterval> &intervals,
+  static void filterByTimeROIHelper(const std::vector<T> &events, const std::vector<Kernel::TimeInterval> &intervals,
                                     EventList *output);
 
   template <class T> void filterInPlaceHelper(Kernel::TimeROI const *timeRoi, typename std::vector<T> &events);
@@ -33,6 +33,52 @@ namespace DataObjects {
 
 namespace FractionalRebinning {
 
+/**
+ * Per-thread partial output grids. Each thread accumulates the overlaps of
+ * its input bins into its own dense copy of the output signal, variance and
+ * (for a RebinnedOutput) fraction arrays without locking. The copies are
+ * summed into the output workspace by addTo once the rebinning loop is done.
+ *
+ * If a copy for every thread would take more than the memory limit, or there
+ * is only one thread, no copies are made and the overlaps are added to the
+ * output workspace directly, under a lock.
+ */
+class MANTID_DATAOBJECTS_DLL PartialOutputs {
+public:
+  /// Dense copy of the output arrays owned by a single thread
+  struct Grid {
+    std::vector<double> signal;
+    std::vector<double> variance;
+    std::vector<double> fraction;
+  };
+
+  explicit PartialOutputs(API::MatrixWorkspace &outputWS, const size_t memoryLimit = defaultMemoryLimit());
+
+  static size_t defaultMemoryLimit();
+
+  /// Whether each thread accumulates into its own grid
+  bool perThread() const { return m_perThread; }
+  /// The output workspace, written directly if the grids are not per thread
+  API::MatrixWorkspace &outputWS() const { return m_outputWS; }
+  /// The output horizontal axis edges
+  const std::vector<double> &xAxis() const { return m_xAxis; }
+  /// Number of bins in each output spectrum
+  size_t blocksize() const { return m_nBins; }
+  /// Grid of the calling thread, allocated on first use
+  Grid &local();
+  /// Sum the partial grids into the output workspace
+  void addTo(API::MatrixWorkspace &outputWS) const;
+
+private:
+  API::MatrixWorkspace &m_outputWS;
+  size_t m_nHistograms;
+  size_t m_nBins;
+  bool m_withFractions;
+  bool m_perThread;
+  std::vector<double> m_xAxis;
+  std::vector<Grid> m_grids;
+};
+
 /// Find the intersect region on the output grid
 MANTID_DATAOBJECTS_DLL bool getIntersectionRegion(const std::vector<double> &xAxis,
                                                   const std::vector<double> &verticalAxis,
@@ -57,6 +103,19 @@ MANTID_DATAOBJECTS_DLL void rebinToFractionalOutput(const Geometry::Quadrilatera
                                                     const std::vector<double> &verticalAxis,
                                                     const DataObjects::RebinnedOutput_const_sptr &inputRB = nullptr);
 
+/// Rebin the input quadrilateral to the calling thread's partial output grid
+MANTID_DATAOBJECTS_DLL void rebinToOutput(const Geometry::Quadrilateral &inputQ,
+                                          const API::MatrixWorkspace_const_sptr &inputWS, const size_t i,
+                                          const size_t j, PartialOutputs &outputs,
+                                          const std::vector<double> &verticalAxis);
+
+/// Rebin the input quadrilateral to the calling thread's partial output grid
+MANTID_DATAOBJECTS_DLL void rebinToFractionalOutput(const Geometry::Quadrilateral &inputQ,
+                                                    const API::MatrixWorkspace_const_sptr &inputWS, const size_t i,
+                                                    const size_t j, PartialOutputs &outputs,
+                                                    const std::vector<double> &verticalAxis,
+                                                    const DataObjects::RebinnedOutput_const_sptr &inputRB = nullptr);
+
 /// Set finalize flag after fractional rebinning loop
 MANTID_DATAOBJECTS_DLL void finalizeFractionalRebin(DataObjects::RebinnedOutput &outputWS);
 
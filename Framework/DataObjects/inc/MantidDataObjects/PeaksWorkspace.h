@@ -166,6 +166,8 @@ private:
   void initColumns();
   /// Adds a new PeakColumn of the given type
   void addPeakColumn(const std::string &name);
+  /// Share the goniometer of the last peak added with the peak before it
+  void shareGoniometerWithPrevious();
 
   // ====================================== ITableWorkspace Methods
   // ==================================
@@ -227,7 +229,9 @@ private:
   // ====================================== End ITableWorkspace Methods
   // ==================================
 
-  /** Vector of Peak contained within. */
+  /** Vector of Peak contained within. Whole peaks are stored, not columns,
+   * because getPeak() and getPeaks() hand out references to them. Peaks with
+   * the same goniometer share its matrices (see BasePeak). */
   std::vector<Peak> m_peaks;
 
   /** Column shared pointers. */
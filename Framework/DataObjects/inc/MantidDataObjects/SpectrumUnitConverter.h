@@ -0,0 +1,66 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2024 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidDataObjects/DllConfig.h"
+#include "MantidKernel/DeltaEMode.h"
+#include "MantidKernel/EmptyValues.h"
+#include "MantidKernel/Unit.h"
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+namespace Mantid {
+namespace API {
+class MatrixWorkspace;
+class SpectrumInfo;
+} // namespace API
+namespace DataObjects {
+class EventWorkspace;
+
+/** Converts the X values of single spectra of a workspace, and their events if
+ * it is an EventWorkspace, from one unit to another via time-of-flight. This is
+ * the per-spectrum part of ConvertUnits, for algorithms that convert the units
+ * while they are already working through the spectra.
+ *
+ * convert() may be called for different spectra from several threads at once.
+ * A spectrum without a usable detector is cleared and masked, like
+ * ConvertUnits does.
+ */
+class MANTID_DATAOBJECTS_DLL SpectrumUnitConverter {
+public:
+  SpectrumUnitConverter(API::MatrixWorkspace &workspace, const Kernel::Unit &fromUnit, const Kernel::Unit &toUnit,
+                        const Kernel::DeltaEMode::Type emode, const double efixed = EMPTY_DBL());
+
+  bool convert(const size_t index);
+
+  /// The number of spectra that could not be converted so far
+  size_t numberOfFailedSpectra() const { return m_numberOfFailedSpectra; }
+
+  static void storeEMode(API::MatrixWorkspace &workspace, const Kernel::DeltaEMode::Type emode);
+
+private:
+  API::MatrixWorkspace &m_workspace;
+  /// The workspace if it is an EventWorkspace, otherwise nullptr
+  EventWorkspace *m_eventWorkspace;
+  API::SpectrumInfo &m_spectrumInfo;
+  const double m_l1;
+  const Kernel::DeltaEMode::Type m_emode;
+  const double m_efixed;
+  /// Whether the instrument asks for signed two theta
+  const bool m_signedTheta;
+  std::unique_ptr<Kernel::Unit> m_fromUnit;
+  std::unique_ptr<Kernel::Unit> m_toUnit;
+  /// One pair of units per thread, re-initialized for each spectrum
+  std::vector<std::unique_ptr<Kernel::Unit>> m_threadFromUnits;
+  std::vector<std::unique_ptr<Kernel::Unit>> m_threadToUnits;
+  std::atomic<size_t> m_numberOfFailedSpectra{0};
+};
+
+} // namespace DataObjects
+} // namespace Mantid
@@ -93,8 +93,10 @@ protected:
   /// a vector holding workspace index of monitors in the workspace
   std::vector<specnum_t> m_monitorList;
 
-  /// A vector that holds the 1D histograms
-  std::vector<std::unique_ptr<Histogram1D>> data;
+  /// A vector that holds the 1D histograms contiguously. Only the Histogram1D
+  /// objects are contiguous: the Y and E arrays of each spectrum are still
+  /// separate copy-on-write allocations, not rows of one slab.
+  std::vector<Histogram1D> data;
 
 private:
   Workspace2D *doClone() const override;
@@ -30,8 +30,8 @@ namespace Mantid::DataObjects {
 BasePeak::BasePeak()
     : m_convention(Kernel::ConfigService::Instance().getString("Q.convention")), m_samplePos(V3D(0, 0, 0)), m_H(0),
       m_K(0), m_L(0), m_intensity(0), m_sigmaIntensity(0), m_binCount(0), m_absorptionWeightedPathLength(0),
-      m_GoniometerMatrix(3, 3, true), m_InverseGoniometerMatrix(3, 3, true), m_runNumber(0), m_monitorCount(0),
-      m_peakNumber(0), m_intHKL(V3D(0, 0, 0)), m_intMNP(V3D(0, 0, 0)), m_peakShape(std::make_shared<NoShape>()) {}
+      m_goniometer(identityGoniometer()), m_runNumber(0), m_monitorCount(0), m_peakNumber(0), m_intHKL(V3D(0, 0, 0)),
+      m_intMNP(V3D(0, 0, 0)), m_peakShape(std::make_shared<NoShape>()) {}
 
 //----------------------------------------------------------------------------------------------
 /** Constructor including goniometer
@@ -40,18 +40,17 @@ BasePeak::BasePeak()
  */
 BasePeak::BasePeak(const Mantid::Kernel::Matrix<double> &goniometer)
     : m_convention(Kernel::ConfigService::Instance().getString("Q.convention")), m_H(0), m_K(0), m_L(0), m_intensity(0),
-      m_sigmaIntensity(0), m_binCount(0), m_absorptionWeightedPathLength(0), m_GoniometerMatrix(goniometer),
-      m_InverseGoniometerMatrix(goniometer), m_runNumber(0), m_monitorCount(0), m_peakNumber(0), m_intHKL(V3D(0, 0, 0)),
-      m_intMNP(V3D(0, 0, 0)), m_peakShape(std::make_shared<NoShape>()) {
-  if (fabs(m_InverseGoniometerMatrix.Invert()) < 1e-8)
+      m_sigmaIntensity(0), m_binCount(0), m_absorptionWeightedPathLength(0),
+      m_goniometer(std::make_shared<GoniometerMatrices>(goniometer)), m_runNumber(0), m_monitorCount(0),
+      m_peakNumber(0), m_intHKL(V3D(0, 0, 0)), m_intMNP(V3D(0, 0, 0)), m_peakShape(std::make_shared<NoShape>()) {
+  if (m_goniometer->singular)
     throw std::invalid_argument("BasePeak::ctor(): Goniometer matrix must non-singular.");
 }
 
 BasePeak::BasePeak(const BasePeak &other)
     : m_convention(other.m_convention), m_samplePos(other.m_samplePos), m_H(other.m_H), m_K(other.m_K), m_L(other.m_L),
       m_intensity(other.m_intensity), m_sigmaIntensity(other.m_sigmaIntensity), m_binCount(other.m_binCount),
-      m_absorptionWeightedPathLength(other.m_absorptionWeightedPathLength),
-      m_GoniometerMatrix(other.m_GoniometerMatrix), m_InverseGoniometerMatrix(other.m_InverseGoniometerMatrix),
+      m_absorptionWeightedPathLength(other.m_absorptionWeightedPathLength), m_goniometer(other.m_goniometer),
       m_runNumber(other.m_runNumber), m_monitorCount(other.m_monitorCount), m_peakNumber(other.m_peakNumber),
       m_intHKL(other.m_intHKL), m_intMNP(other.m_intMNP), m_peakShape(other.m_peakShape->clone()) {}
 
@@ -65,13 +64,25 @@ BasePeak::BasePeak(const Geometry::IPeak &ipeak)
       m_K(ipeak.getK()), m_L(ipeak.getL()), m_intensity(ipeak.getIntensity()),
       m_sigmaIntensity(ipeak.getSigmaIntensity()), m_binCount(ipeak.getBinCount()),
       m_absorptionWeightedPathLength(ipeak.getAbsorptionWeightedPathLength()),
-      m_GoniometerMatrix(ipeak.getGoniometerMatrix()), m_InverseGoniometerMatrix(ipeak.getGoniometerMatrix()),
+      m_goniometer(std::make_shared<GoniometerMatrices>(ipeak.getGoniometerMatrix())),
       m_runNumber(ipeak.getRunNumber()), m_monitorCount(ipeak.getMonitorCount()), m_peakNumber(ipeak.getPeakNumber()),
       m_intHKL(ipeak.getIntHKL()), m_intMNP(ipeak.getIntMNP()), m_peakShape(std::make_shared<NoShape>()) {
-  if (fabs(m_InverseGoniometerMatrix.Invert()) < 1e-8)
+  if (m_goniometer->singular)
     throw std::invalid_argument("Peak::ctor(): Goniometer matrix must non-singular.");
 }
 
+/** Store a goniometer matrix and calculate its inverse
+ * @param goniometerMatrix :: 3x3 rotation matrix of the goniometer
+ */
+BasePeak::GoniometerMatrices::GoniometerMatrices(const Mantid::Kernel::Matrix<double> &goniometerMatrix)
+    : matrix(goniometerMatrix), inverse(goniometerMatrix), singular(fabs(inverse.Invert()) < 1e-8) {}
+
+/// @return the identity goniometer shared by all default constructed peaks
+std::shared_ptr<const BasePeak::GoniometerMatrices> BasePeak::identityGoniometer() {
+  static const auto identity = std::make_shared<const GoniometerMatrices>(Mantid::Kernel::Matrix<double>(3, 3, true));
+  return identity;
+}
+
 //----------------------------------------------------------------------------------------------
 /** Return the run number this peak was measured at. */
 int BasePeak::getRunNumber() const { return m_runNumber; }
@@ -206,11 +217,11 @@ void BasePeak::setSigmaIntensity(double m_sigmaIntensity) { this->m_sigmaIntensi
 
 // -------------------------------------------------------------------------------------
 /** Get the goniometer rotation matrix at which this peak was measured. */
-Mantid::Kernel::Matrix<double> BasePeak::getGoniometerMatrix() const { return this->m_GoniometerMatrix; }
+Mantid::Kernel::Matrix<double> BasePeak::getGoniometerMatrix() const { return m_goniometer->matrix; }
 
 // -------------------------------------------------------------------------------------
 /** Get the goniometer rotation matrix at which this peak was measured. */
-Mantid::Kernel::Matrix<double> BasePeak::getInverseGoniometerMatrix() const { return this->m_InverseGoniometerMatrix; }
+Mantid::Kernel::Matrix<double> BasePeak::getInverseGoniometerMatrix() const { return m_goniometer->inverse; }
 
 /** Set the goniometer rotation matrix at which this peak was measured.
  * @param goniometerMatrix :: 3x3 matrix that represents the rotation matrix of
@@ -219,14 +230,30 @@ Mantid::Kernel::Matrix<double> BasePeak::getInverseGoniometerMatrix() const { re
 void BasePeak::setGoniometerMatrix(const Mantid::Kernel::Matrix<double> &goniometerMatrix) {
   if ((goniometerMatrix.numCols() != 3) || (goniometerMatrix.numRows() != 3))
     throw std::invalid_argument("BasePeak::setGoniometerMatrix(): Goniometer matrix must be 3x3.");
-  this->m_GoniometerMatrix = goniometerMatrix;
-  // Calc the inverse rotation matrix
-  m_InverseGoniometerMatrix = m_GoniometerMatrix;
-  if (fabs(m_InverseGoniometerMatrix.Invert()) < 1e-8)
+  m_goniometer = std::make_shared<GoniometerMatrices>(goniometerMatrix);
+  if (m_goniometer->singular)
     throw std::invalid_argument("BasePeak::setGoniometerMatrix(): Goniometer "
                                 "matrix must be non-singular.");
 }
 
+/** Share the goniometer matrices of another peak if they are identical to the
+ * ones of this peak, so that many peaks from the same run hold a single copy.
+ * @param other :: the peak to share the goniometer with
+ * @return true if the goniometer is now shared with the other peak
+ */
+bool BasePeak::shareGoniometerMatrix(const BasePeak &other) {
+  if (m_goniometer == other.m_goniometer)
+    return true;
+  const auto &mine = m_goniometer->matrix;
+  const auto &theirs = other.m_goniometer->matrix;
+  for (size_t row = 0; row < 3; ++row) {
+    if (!std::equal(mine[row], mine[row] + 3, theirs[row]))
+      return false;
+  }
+  m_goniometer = other.m_goniometer;
+  return true;
+}
+
 // -------------------------------------------------------------------------------------
 /**Returns the unique peak number
  * Returns -1 if it could not find it. */
@@ -321,8 +348,7 @@ BasePeak &BasePeak::operator=(const BasePeak &other) {
     m_intensity = other.m_intensity;
     m_sigmaIntensity = other.m_sigmaIntensity;
     m_binCount = other.m_binCount;
-    m_GoniometerMatrix = other.m_GoniometerMatrix;
-    m_InverseGoniometerMatrix = other.m_InverseGoniometerMatrix;
+    m_goniometer = other.m_goniometer;
     m_runNumber = other.m_runNumber;
     m_monitorCount = other.m_monitorCount;
     m_peakNumber = other.m_peakNumber;
@@ -13,6 +13,7 @@
 #include "MantidKernel/Logger.h"
 #include "MantidKernel/TimeROI.h"
 #include "MantidKernel/Unit.h"
+#include "MantidKernel/make_cow.h"
 
 #ifdef _MSC_VER
 // qualifier applied to function type has no meaning; ignored
@@ -24,10 +25,12 @@
 #endif
 
 #include <algorithm>
+#include <array>
 #include <cfloat>
 #include <cmath>
 #include <functional>
 #include <limits>
+#include <numeric>
 #include <stdexcept>
 
 using std::ostream;
@@ -87,6 +90,64 @@ public:
     return (tAtSample1 < tAtSample2);
   }
 };
+
+/**
+ * An empty vector of events shared by every EventList that has none of this
+ * type, so that constructing an EventList does not allocate. The first call
+ * to access() on it makes a copy like for any other shared vector.
+ * @return The shared empty vector
+ */
+template <typename EventType> const std::shared_ptr<std::vector<EventType>> &noEvents() {
+  static const auto empty = std::make_shared<std::vector<EventType>>();
+  return empty;
+}
+
+/**
+ * Free the memory used by a vector of events. Events that are shared with
+ * another EventList are left to it rather than being copied first.
+ * @param events : The events to release
+ */
+template <typename EventType> void releaseEvents(Kernel::cow_ptr<std::vector<EventType>> &events) {
+  if (events->empty())
+    return;
+  if (events.unique())
+    std::vector<EventType>().swap(events.access()); // STL Trick to release memory
+  else
+    events = noEvents<EventType>();
+}
+
+/// Share of the memory used by a vector of events that falls to one of the EventLists holding it
+template <typename EventType> size_t sharedEventsMemorySize(const Kernel::cow_ptr<std::vector<EventType>> &events) {
+  return events->capacity() * sizeof(EventType) / static_cast<size_t>(events.use_count());
+}
+
+/**
+ * Remove the events with a time-of-flight outside of [tofMin, tofMax]. The
+ * order of the remaining events is kept, and a vector shared with another
+ * EventList is only copied if there is something to remove.
+ * @param events : The events to crop
+ * @param tofMin : The smallest time-of-flight to keep
+ * @param tofMax : The largest time-of-flight to keep
+ */
+template <typename EventType>
+void cropEvents(Kernel::cow_ptr<std::vector<EventType>> &events, const double tofMin, const double tofMax) {
+  const auto outside = [tofMin, tofMax](const EventType &event) {
+    const double tof = event.tof();
+    return tof < tofMin || tof > tofMax;
+  };
+  const auto firstOutside = std::find_if(events->cbegin(), events->cend(), outside);
+  if (firstOutside == events->cend())
+    return;
+  const auto offset = std::distance(events->cbegin(), firstOutside);
+  auto &vec = events.access();
+  vec.erase(std::remove_if(vec.begin() + offset, vec.end(), outside), vec.end());
+}
+
+/// Reverse a vector of events, detaching it from any other EventList sharing it.
+template <typename EventType> void reverseEvents(Kernel::cow_ptr<std::vector<EventType>> &events) {
+  auto &vec = events.access();
+  std::reverse(vec.begin(), vec.end());
+}
 } // namespace
 //==========================================================================
 /// --------------------- TofEvent Comparators
@@ -160,11 +221,81 @@ struct FindBin {
   }
 };
 
+/**
+ * Finds the bin a value falls in for arbitrary increasing bin edges, without
+ * requiring the values to be sorted. The range of the edges is split into
+ * uniform cells and each cell records how many edges lie at or below it, so a
+ * value is located with one multiplication and a binary search over the few
+ * edges that can share its cell. Piecewise-uniform binnings end up with one
+ * or two candidate bins per cell.
+ */
+class EdgeBinFinder {
+public:
+  explicit EdgeBinFinder(const Mantid::MantidVec &X) : m_X(X), m_xmin(X.front()), m_xmax(X.back()) {
+    const size_t nBins = X.size() - 1;
+    const double scale = static_cast<double>(nBins) / (m_xmax - m_xmin);
+    // Degenerate edges fall back to a search over all of them
+    if (std::isfinite(scale) && scale > 0.) {
+      m_nCells = nBins;
+      m_scale = scale;
+    }
+    m_edgesUpTo.assign(m_nCells + 2, 0);
+    for (const double x : X)
+      ++m_edgesUpTo[cell(x) + 1];
+    std::partial_sum(m_edgesUpTo.begin(), m_edgesUpTo.end(), m_edgesUpTo.begin());
+  }
+
+  /// @returns The bin containing tof, or nothing if it is outside the edges
+  std::optional<size_t> operator()(const double tof) const {
+    if (!(tof >= m_xmin && tof < m_xmax))
+      return std::nullopt;
+    const size_t c = cell(tof);
+    // The bin starts at or below this cell and ends at or above it
+    const size_t first = std::max(m_edgesUpTo[c], size_t{1}) - 1;
+    const size_t last = std::min(m_edgesUpTo[c + 1], m_X.size() - 1);
+    const auto upper = std::upper_bound(m_X.cbegin() + first + 1, m_X.cbegin() + last, tof);
+    return static_cast<size_t>(std::distance(m_X.cbegin(), upper)) - 1;
+  }
+
+private:
+  size_t cell(const double x) const {
+    const double position = (x - m_xmin) * m_scale;
+    return position <= 0. ? 0 : std::min(static_cast<size_t>(position), m_nCells);
+  }
+
+  const Mantid::MantidVec &m_X;
+  const double m_xmin;
+  const double m_xmax;
+  size_t m_nCells{0};
+  double m_scale{0.};
+  /// Number of edges in the cells before each cell, plus the total
+  std::vector<size_t> m_edgesUpTo;
+};
+
+/**
+ * Histograms events in whatever order they are stored.
+ * @param events :: the events to histogram
+ * @param findBin :: finds the bin of an event
+ * @param Y :: zeroed counts, incremented by the event weights
+ * @param E :: zeroed squared errors, incremented by the event errors
+ */
+template <class T>
+void histogramUnsortedHelper(const std::vector<T> &events, const EdgeBinFinder &findBin, Mantid::MantidVec &Y,
+                             Mantid::MantidVec &E) {
+  for (const T &ev : events) {
+    if (const auto bin = findBin(ev.tof())) {
+      Y[*bin] += double(ev.weight());
+      E[*bin] += double(ev.errorSquared());
+    }
+  }
+}
+
 /// Constructor (empty)
 // EventWorkspace is always histogram data and so is thus EventList
 EventList::EventList(const EventType event_type)
     : m_histogram(HistogramData::Histogram::XMode::BinEdges, HistogramData::Histogram::YMode::Counts),
-      eventType(event_type), order(UNSORTED), mru(nullptr) {}
+      events(noEvents<Types::Event::TofEvent>()), weightedEvents(noEvents<WeightedEvent>()),
+      weightedEventsNoTime(noEvents<WeightedEventNoTime>()), eventType(event_type), order(UNSORTED), mru(nullptr) {}
 
 /** Constructor with a MRU list
  * @param mru :: pointer to the MRU of the parent EventWorkspace
@@ -172,12 +303,15 @@ EventList::EventList(const EventType event_type)
  */
 EventList::EventList(EventWorkspaceMRU *mru, specnum_t specNo)
     : IEventList(specNo),
-      m_histogram(HistogramData::Histogram::XMode::BinEdges, HistogramData::Histogram::YMode::Counts), eventType(TOF),
-      order(UNSORTED), mru(mru) {}
+      m_histogram(HistogramData::Histogram::XMode::BinEdges, HistogramData::Histogram::YMode::Counts),
+      events(noEvents<Types::Event::TofEvent>()), weightedEvents(noEvents<WeightedEvent>()),
+      weightedEventsNoTime(noEvents<WeightedEventNoTime>()), eventType(TOF), order(UNSORTED), mru(mru) {}
 
 /** Constructor copying from an existing event list
  * @param rhs :: EventList object to copy*/
-EventList::EventList(const EventList &rhs) : IEventList(rhs), m_histogram(rhs.m_histogram), mru{nullptr} {
+EventList::EventList(const EventList &rhs)
+    : IEventList(rhs), m_histogram(rhs.m_histogram), events(rhs.events), weightedEvents(rhs.weightedEvents),
+      weightedEventsNoTime(rhs.weightedEventsNoTime), mru{nullptr} {
   // Note that operator= also assigns m_histogram, but the above use of the copy
   // constructor avoid a memory allocation and is thus faster.
   this->operator=(rhs);
@@ -186,9 +320,10 @@ EventList::EventList(const EventList &rhs) : IEventList(rhs), m_histogram(rhs.m_
 /** Constructor, taking a vector of events.
  * @param events :: Vector of TofEvent's */
 EventList::EventList(const std::vector<Types::Event::TofEvent> &events)
-    : m_histogram(HistogramData::Histogram::XMode::BinEdges, HistogramData::Histogram::YMode::Counts), eventType(TOF),
-      mru(nullptr) {
-  this->events.assign(events.cbegin(), events.cend());
+    : m_histogram(HistogramData::Histogram::XMode::BinEdges, HistogramData::Histogram::YMode::Counts),
+      events(noEvents<Types::Event::TofEvent>()), weightedEvents(noEvents<WeightedEvent>()),
+      weightedEventsNoTime(noEvents<WeightedEventNoTime>()), eventType(TOF), mru(nullptr) {
+  this->events.access().assign(events.cbegin(), events.cend());
   this->eventType = TOF;
   this->order = UNSORTED;
 }
@@ -196,8 +331,10 @@ EventList::EventList(const std::vector<Types::Event::TofEvent> &events)
 /** Constructor, taking a vector of events.
  * @param events :: Vector of WeightedEvent's */
 EventList::EventList(const std::vector<WeightedEvent> &events)
-    : m_histogram(HistogramData::Histogram::XMode::BinEdges, HistogramData::Histogram::YMode::Counts), mru(nullptr) {
-  this->weightedEvents.assign(events.cbegin(), events.cend());
+    : m_histogram(HistogramData::Histogram::XMode::BinEdges, HistogramData::Histogram::YMode::Counts),
+      events(noEvents<Types::Event::TofEvent>()), weightedEvents(noEvents<WeightedEvent>()),
+      weightedEventsNoTime(noEvents<WeightedEventNoTime>()), mru(nullptr) {
+  this->weightedEvents.access().assign(events.cbegin(), events.cend());
   this->eventType = WEIGHTED;
   this->order = UNSORTED;
 }
@@ -205,8 +342,10 @@ EventList::EventList(const std::vector<WeightedEvent> &events)
 /** Constructor, taking a vector of events.
  * @param events :: Vector of WeightedEventNoTime's */
 EventList::EventList(const std::vector<WeightedEventNoTime> &events)
-    : m_histogram(HistogramData::Histogram::XMode::BinEdges, HistogramData::Histogram::YMode::Counts), mru(nullptr) {
-  this->weightedEventsNoTime.assign(events.cbegin(), events.cend());
+    : m_histogram(HistogramData::Histogram::XMode::BinEdges, HistogramData::Histogram::YMode::Counts),
+      events(noEvents<Types::Event::TofEvent>()), weightedEvents(noEvents<WeightedEvent>()),
+      weightedEventsNoTime(noEvents<WeightedEventNoTime>()), mru(nullptr) {
+  this->weightedEventsNoTime.access().assign(events.cbegin(), events.cend());
   this->eventType = WEIGHTED_NOTIME;
   this->order = UNSORTED;
 }
@@ -267,8 +406,9 @@ void EventList::createFromHistogram(const ISpectrum *inSpec, bool GenerateZeros,
   this->copyInfoFrom(*inSpec);
   // We need weights but have no way to set the time. So use weighted, no time
   this->switchTo(WEIGHTED_NOTIME);
+  auto &newEvents = this->weightedEventsNoTime.access();
   if (GenerateZeros)
-    this->weightedEventsNoTime.reserve(Y.size());
+    newEvents.reserve(Y.size());
 
   for (size_t i = 0; i < X.size() - 1; i++) {
     double weight = Y[i];
@@ -299,7 +439,7 @@ void EventList::createFromHistogram(const ISpectrum *inSpec, bool GenerateZeros,
             double tof = X[i] + tofStep * (0.5 + double(j));
             // Create and add the event
             // TODO: try emplace_back() here.
-            weightedEventsNoTime.emplace_back(tof, weight, errorSquared);
+            newEvents.emplace_back(tof, weight, errorSquared);
           }
         } else {
           // --------- Single event per bin ----------
@@ -309,7 +449,7 @@ void EventList::createFromHistogram(const ISpectrum *inSpec, bool GenerateZeros,
           double errorSquared = E[i];
           errorSquared *= errorSquared;
           // Create and add the event
-          weightedEventsNoTime.emplace_back(tof, weight, errorSquared);
+          newEvents.emplace_back(tof, weight, errorSquared);
         }
       } // error is nont NAN or infinite
     }   // weight is non-zero, not NAN, and non-infinite
@@ -354,15 +494,15 @@ EventList &EventList::operator+=(const Types::Event::TofEvent &event) {
   switch (this->eventType) {
   case TOF:
     // Simply push the events
-    this->events.emplace_back(event);
+    this->events.access().emplace_back(event);
     break;
 
   case WEIGHTED:
-    this->weightedEvents.emplace_back(event);
+    this->weightedEvents.access().emplace_back(event);
     break;
 
   case WEIGHTED_NOTIME:
-    this->weightedEventsNoTime.emplace_back(event);
+    this->weightedEventsNoTime.access().emplace_back(event);
     break;
   }
 
@@ -379,27 +519,33 @@ EventList &EventList::operator+=(const Types::Event::TofEvent &event) {
  * */
 EventList &EventList::operator+=(const std::vector<Types::Event::TofEvent> &more_events) {
   switch (this->eventType) {
-  case TOF:
+  case TOF: {
     // Simply push the events
-    this->events.insert(this->events.end(), more_events.cbegin(), more_events.cend());
+    auto &tofEvents = this->events.access();
+    tofEvents.insert(tofEvents.end(), more_events.cbegin(), more_events.cend());
     break;
+  }
 
-  case WEIGHTED:
+  case WEIGHTED: {
     // Add default weights to all the un-weighted incoming events from the list.
     // and append to the list
-    this->weightedEvents.reserve(this->weightedEvents.size() + more_events.size());
-    std::transform(std::cbegin(more_events), std::cend(more_events), std::back_inserter(this->weightedEvents),
+    auto &weighted = this->weightedEvents.access();
+    weighted.reserve(weighted.size() + more_events.size());
+    std::transform(std::cbegin(more_events), std::cend(more_events), std::back_inserter(weighted),
                    [](const TofEvent &event) { return WeightedEvent(event); });
     break;
+  }
 
-  case WEIGHTED_NOTIME:
+  case WEIGHTED_NOTIME: {
     // Add default weights to all the un-weighted incoming events from the list.
     // and append to the list
-    this->weightedEventsNoTime.reserve(this->weightedEventsNoTime.size() + more_events.size());
-    std::transform(std::cbegin(more_events), std::cend(more_events), std::back_inserter(this->weightedEventsNoTime),
+    auto &weightedNoTime = this->weightedEventsNoTime.access();
+    weightedNoTime.reserve(weightedNoTime.size() + more_events.size());
+    std::transform(std::cbegin(more_events), std::cend(more_events), std::back_inserter(weightedNoTime),
                    [](const TofEvent &event) { return WeightedEventNoTime(event); });
     break;
   }
+  }
 
   this->order = UNSORTED;
   return *this;
@@ -415,7 +561,7 @@ EventList &EventList::operator+=(const std::vector<Types::Event::TofEvent> &more
  * */
 EventList &EventList::operator+=(const WeightedEvent &event) {
   this->switchTo(WEIGHTED);
-  this->weightedEvents.emplace_back(event);
+  this->weightedEvents.access().emplace_back(event);
   this->order = UNSORTED;
   return *this;
 }
@@ -435,19 +581,23 @@ EventList &EventList::operator+=(const std::vector<WeightedEvent> &more_events)
     this->switchTo(WEIGHTED);
     // Fall through to the insertion!
 
-  case WEIGHTED:
+  case WEIGHTED: {
     // Append the two lists
-    this->weightedEvents.insert(weightedEvents.end(), more_events.cbegin(), more_events.cend());
+    auto &weighted = this->weightedEvents.access();
+    weighted.insert(weighted.end(), more_events.cbegin(), more_events.cend());
     break;
+  }
 
-  case WEIGHTED_NOTIME:
+  case WEIGHTED_NOTIME: {
     // Add default weights to all the un-weighted incoming events from the list.
     // and append to the list
-    this->weightedEventsNoTime.reserve(this->weightedEventsNoTime.size() + more_events.size());
-    std::transform(std::cbegin(more_events), std::cend(more_events), std::back_inserter(this->weightedEventsNoTime),
+    auto &weightedNoTime = this->weightedEventsNoTime.access();
+    weightedNoTime.reserve(weightedNoTime.size() + more_events.size());
+    std::transform(std::cbegin(more_events), std::cend(more_events), std::back_inserter(weightedNoTime),
                    [](const WeightedEvent &event) { return WeightedEventNoTime(event); });
     break;
   }
+  }
 
   this->order = UNSORTED;
   return *this;
@@ -469,11 +619,13 @@ EventList &EventList::operator+=(const std::vector<WeightedEventNoTime> &more_ev
     this->switchTo(WEIGHTED_NOTIME);
     // Fall through to the insertion!
 
-  case WEIGHTED_NOTIME:
+  case WEIGHTED_NOTIME: {
     // Simple appending of the two lists
-    this->weightedEventsNoTime.insert(weightedEventsNoTime.end(), more_events.cbegin(), more_events.cend());
+    auto &weightedNoTime = this->weightedEventsNoTime.access();
+    weightedNoTime.insert(weightedNoTime.end(), more_events.cbegin(), more_events.cend());
     break;
   }
+  }
 
   this->order = UNSORTED;
   return *this;
@@ -493,15 +645,15 @@ EventList &EventList::operator+=(const EventList &more_events) {
     // We'll let the += operator for the given vector of event lists handle it
     switch (more_events.getEventType()) {
     case TOF:
-      this->operator+=(more_events.events);
+      this->operator+=(*more_events.events);
       break;
 
     case WEIGHTED:
-      this->operator+=(more_events.weightedEvents);
+      this->operator+=(*more_events.weightedEvents);
       break;
 
     case WEIGHTED_NOTIME:
-      this->operator+=(more_events.weightedEventsNoTime);
+      this->operator+=(*more_events.weightedEventsNoTime);
       break;
     }
 
@@ -568,14 +720,14 @@ EventList &EventList::operator-=(const EventList &more_events) {
   case WEIGHTED:
     switch (more_events.getEventType()) {
     case TOF:
-      minusHelper(this->weightedEvents, more_events.events);
+      minusHelper(this->weightedEvents.access(), *more_events.events);
       break;
     case WEIGHTED:
-      minusHelper(this->weightedEvents, more_events.weightedEvents);
+      minusHelper(this->weightedEvents.access(), *more_events.weightedEvents);
       break;
     case WEIGHTED_NOTIME:
       // TODO: Should this throw?
-      minusHelper(this->weightedEvents, more_events.weightedEventsNoTime);
+      minusHelper(this->weightedEvents.access(), *more_events.weightedEventsNoTime);
       break;
     }
     break;
@@ -583,13 +735,13 @@ EventList &EventList::operator-=(const EventList &more_events) {
   case WEIGHTED_NOTIME:
     switch (more_events.getEventType()) {
     case TOF:
-      minusHelper(this->weightedEventsNoTime, more_events.events);
+      minusHelper(this->weightedEventsNoTime.access(), *more_events.events);
       break;
     case WEIGHTED:
-      minusHelper(this->weightedEventsNoTime, more_events.weightedEvents);
+      minusHelper(this->weightedEventsNoTime.access(), *more_events.weightedEvents);
       break;
     case WEIGHTED_NOTIME:
-      minusHelper(this->weightedEventsNoTime, more_events.weightedEventsNoTime);
+      minusHelper(this->weightedEventsNoTime.access(), *more_events.weightedEventsNoTime);
       break;
     }
     break;
@@ -613,11 +765,11 @@ bool EventList::operator==(const EventList &rhs) const {
   if (this->eventType != rhs.eventType)
     return false;
   // Check all event lists; The empty ones will compare equal
-  if (events != rhs.events)
+  if (*events != *rhs.events)
     return false;
-  if (weightedEvents != rhs.weightedEvents)
+  if (*weightedEvents != *rhs.weightedEvents)
     return false;
-  if (weightedEventsNoTime != rhs.weightedEventsNoTime)
+  if (*weightedEventsNoTime != *rhs.weightedEventsNoTime)
     return false;
   return true;
 }
@@ -641,19 +793,19 @@ bool EventList::equals(const EventList &rhs, const double tolTof, const double t
   switch (this->eventType) {
   case TOF:
     for (size_t i = 0; i < numEvents; ++i) {
-      if (!this->events[i].equals(rhs.events[i], tolTof, tolPulse))
+      if (!(*this->events)[i].equals((*rhs.events)[i], tolTof, tolPulse))
         return false;
     }
     break;
   case WEIGHTED:
     for (size_t i = 0; i < numEvents; ++i) {
-      if (!this->weightedEvents[i].equals(rhs.weightedEvents[i], tolTof, tolWeight, tolPulse))
+      if (!(*this->weightedEvents)[i].equals((*rhs.weightedEvents)[i], tolTof, tolWeight, tolPulse))
         return false;
     }
     break;
   case WEIGHTED_NOTIME:
     for (size_t i = 0; i < numEvents; ++i) {
-      if (!this->weightedEventsNoTime[i].equals(rhs.weightedEventsNoTime[i], tolTof, tolWeight))
+      if (!(*this->weightedEventsNoTime)[i].equals((*rhs.weightedEventsNoTime)[i], tolTof, tolWeight))
         return false;
     }
     break;
@@ -715,11 +867,11 @@ void EventList::switchToWeightedEvents() {
     break;
 
   case TOF:
-    weightedEventsNoTime.clear();
+    releaseEvents(weightedEventsNoTime);
     // Convert and copy all TofEvents to the weightedEvents list.
-    this->weightedEvents.assign(events.cbegin(), events.cend());
+    this->weightedEvents.access().assign(events->cbegin(), events->cend());
     // Get rid of the old events
-    events.clear();
+    releaseEvents(events);
     eventType = WEIGHTED;
     break;
   }
@@ -737,19 +889,19 @@ void EventList::switchToWeightedEventsNoTime() {
 
   case TOF: {
     // Convert and copy all TofEvents to the weightedEvents list.
-    this->weightedEventsNoTime.assign(events.cbegin(), events.cend());
+    this->weightedEventsNoTime.access().assign(events->cbegin(), events->cend());
     // Get rid of the old events
-    events.clear();
-    weightedEvents.clear();
+    releaseEvents(events);
+    releaseEvents(weightedEvents);
     eventType = WEIGHTED_NOTIME;
   } break;
 
   case WEIGHTED: {
     // Convert and copy all TofEvents to the weightedEvents list.
-    this->weightedEventsNoTime.assign(weightedEvents.cbegin(), weightedEvents.cend());
+    this->weightedEventsNoTime.access().assign(weightedEvents->cbegin(), weightedEvents->cend());
     // Get rid of the old events
-    events.clear();
-    weightedEvents.clear();
+    releaseEvents(events);
+    releaseEvents(weightedEvents);
     eventType = WEIGHTED_NOTIME;
   } break;
   }
@@ -769,12 +921,13 @@ void EventList::switchToWeightedEventsNoTime() {
 WeightedEvent EventList::getEvent(size_t event_number) {
   switch (eventType) {
   case TOF:
-    return WeightedEvent(events[event_number]);
+    return WeightedEvent((*events)[event_number]);
   case WEIGHTED:
-    return weightedEvents[event_number];
-  case WEIGHTED_NOTIME:
-    return WeightedEvent(weightedEventsNoTime[event_number].tof(), 0, weightedEventsNoTime[event_number].weight(),
-                         weightedEventsNoTime[event_number].errorSquared());
+    return (*weightedEvents)[event_number];
+  case WEIGHTED_NOTIME: {
+    const auto &event = (*weightedEventsNoTime)[event_number];
+    return WeightedEvent(event.tof(), 0, event.weight(), event.errorSquared());
+  }
   }
   throw std::runtime_error("EventList: invalid event type value was found.");
 }
@@ -796,7 +949,7 @@ const std::vector<TofEvent> &EventList::getEvents() const {
     throw std::runtime_error("EventList::getEvents() called for an EventList "
                              "that has weights. Use getWeightedEvents() or "
                              "getWeightedEventsNoTime().");
-  return this->events;
+  return *this->events;
 }
 
 /** Return the list of TofEvents contained.
@@ -811,7 +964,7 @@ std::vector<TofEvent> &EventList::getEvents() {
     throw std::runtime_error("EventList::getEvents() called for an EventList "
                              "that has weights. Use getWeightedEvents() or "
                              "getWeightedEventsNoTime().");
-  return this->events;
+  return this->events.access();
 }
 
 /** Return the list of WeightedEvent contained.
@@ -826,7 +979,7 @@ std::vector<WeightedEvent> &EventList::getWeightedEvents() {
     throw std::runtime_error("EventList::getWeightedEvents() called for an "
                              "EventList not of type WeightedEvent. Use "
                              "getEvents() or getWeightedEventsNoTime().");
-  return this->weightedEvents;
+  return this->weightedEvents.access();
 }
 
 /** Return the list of WeightedEvent contained.
@@ -841,7 +994,7 @@ const std::vector<WeightedEvent> &EventList::getWeightedEvents() const {
     throw std::runtime_error("EventList::getWeightedEvents() called for an "
                              "EventList not of type WeightedEvent. Use "
                              "getEvents() or getWeightedEventsNoTime().");
-  return this->weightedEvents;
+  return *this->weightedEvents;
 }
 
 /** Return the list of WeightedEvent contained.
@@ -854,7 +1007,7 @@ std::vector<WeightedEventNoTime> &EventList::getWeightedEventsNoTime() {
     throw std::runtime_error("EventList::getWeightedEventsNoTime() called for an "
                              "EventList not of type WeightedEventNoTime. Use "
                              "getEvents() or getWeightedEvents().");
-  return this->weightedEventsNoTime;
+  return this->weightedEventsNoTime.access();
 }
 
 /** Return the list of WeightedEventNoTime contained.
@@ -867,7 +1020,7 @@ const std::vector<WeightedEventNoTime> &EventList::getWeightedEventsNoTime() con
     throw std::runtime_error("EventList::getWeightedEventsNoTime() called for "
                              "an EventList not of type WeightedEventNoTime. "
                              "Use getEvents() or getWeightedEvents().");
-  return this->weightedEventsNoTime;
+  return *this->weightedEventsNoTime;
 }
 
 /** Clear the list of events and any
@@ -882,18 +1035,9 @@ void EventList::clear(const bool removeDetIDs) {
     }
   }
   if (!this->empty()) {
-    if (!this->events.empty()) {
-      this->events.clear();
-      std::vector<TofEvent>().swap(this->events); // STL Trick to release memory
-    }
-    if (!this->weightedEvents.empty()) {
-      this->weightedEvents.clear();
-      std::vector<WeightedEvent>().swap(this->weightedEvents); // STL Trick to release memory
-    }
-    if (!this->weightedEventsNoTime.empty()) {
-      this->weightedEventsNoTime.clear();
-      std::vector<WeightedEventNoTime>().swap(this->weightedEventsNoTime); // STL Trick to release memory
-    }
+    releaseEvents(this->events);
+    releaseEvents(this->weightedEvents);
+    releaseEvents(this->weightedEventsNoTime);
   }
   if (removeDetIDs)
     this->clearDetectorIDs();
@@ -904,18 +1048,12 @@ void EventList::clear(const bool removeDetIDs) {
  * Memory is freed.
  * */
 void EventList::clearUnused() {
-  if (eventType != TOF && (!this->events.empty())) {
-    this->events.clear();
-    std::vector<TofEvent>().swap(this->events); // STL Trick to release memory
-  }
-  if (eventType != WEIGHTED && (!this->weightedEvents.empty())) {
-    this->weightedEvents.clear();
-    std::vector<WeightedEvent>().swap(this->weightedEvents); // STL Trick to release memory
-  }
-  if (eventType != WEIGHTED_NOTIME && (!this->weightedEventsNoTime.empty())) {
-    this->weightedEventsNoTime.clear();
-    std::vector<WeightedEventNoTime>().swap(this->weightedEventsNoTime); // STL Trick to release memory
-  }
+  if (eventType != TOF)
+    releaseEvents(this->events);
+  if (eventType != WEIGHTED)
+    releaseEvents(this->weightedEvents);
+  if (eventType != WEIGHTED_NOTIME)
+    releaseEvents(this->weightedEventsNoTime);
 }
 
 /// Mask the spectrum to this value. Removes all events.
@@ -937,13 +1075,13 @@ void EventList::setMRU(EventWorkspaceMRU *newMRU) { mru = newMRU; }
 void EventList::reserve(size_t num) {
   switch (this->eventType) {
   case TOF:
-    this->events.reserve(num);
+    this->events.access().reserve(num);
     break;
   case WEIGHTED:
-    this->weightedEvents.reserve(num);
+    this->weightedEvents.access().reserve(num);
     break;
   case WEIGHTED_NOTIME:
-    this->weightedEventsNoTime.reserve(num);
+    this->weightedEventsNoTime.access().reserve(num);
     break;
   }
 }
@@ -1005,6 +1143,17 @@ template <class RandomIt, class Compare> void switchable_sort(RandomIt first, Ra
   else
     tbb::parallel_sort(first, last, comp);
 }
+
+/// Sort a vector of events, detaching it from any other EventList sharing it.
+template <class T> void switchable_sort(Kernel::cow_ptr<std::vector<T>> &events) {
+  auto &vec = events.access();
+  switchable_sort(vec.begin(), vec.end());
+}
+
+template <class T, class Compare> void switchable_sort(Kernel::cow_ptr<std::vector<T>> &events, Compare comp) {
+  auto &vec = events.access();
+  switchable_sort(vec.begin(), vec.end(), std::move(comp));
+}
 } // anonymous namespace
 
 // --------------------------------------------------------------------------
@@ -1022,13 +1171,13 @@ void EventList::sortTof() const {
 
   switch (eventType) {
   case TOF:
-    switchable_sort(events.begin(), events.end());
+    switchable_sort(events);
     break;
   case WEIGHTED:
-    switchable_sort(weightedEvents.begin(), weightedEvents.end());
+    switchable_sort(weightedEvents);
     break;
   case WEIGHTED_NOTIME:
-    switchable_sort(weightedEventsNoTime.begin(), weightedEventsNoTime.end());
+    switchable_sort(weightedEventsNoTime);
     break;
   }
   // Save the order to avoid unnecessary re-sorting.
@@ -1059,15 +1208,15 @@ void EventList::sortTimeAtSample(const double &tofFactor, const double &tofShift
   switch (eventType) {
   case TOF: {
     CompareTimeAtSample<TofEvent> comparitor(tofFactor, tofShift);
-    switchable_sort(events.begin(), events.end(), comparitor);
+    switchable_sort(events, comparitor);
   } break;
   case WEIGHTED: {
     CompareTimeAtSample<WeightedEvent> comparitor(tofFactor, tofShift);
-    switchable_sort(weightedEvents.begin(), weightedEvents.end(), comparitor);
+    switchable_sort(weightedEvents, comparitor);
   } break;
   case WEIGHTED_NOTIME: {
     CompareTimeAtSample<WeightedEventNoTime> comparitor(tofFactor, tofShift);
-    switchable_sort(weightedEventsNoTime.begin(), weightedEventsNoTime.end(), comparitor);
+    switchable_sort(weightedEventsNoTime, comparitor);
   } break;
   }
   // Save the order to avoid unnecessary re-sorting.
@@ -1089,10 +1238,10 @@ void EventList::sortPulseTime() const {
   // Perform sort.
   switch (eventType) {
   case TOF:
-    switchable_sort(events.begin(), events.end(), compareEventPulseTime);
+    switchable_sort(events, compareEventPulseTime);
     break;
   case WEIGHTED:
-    switchable_sort(weightedEvents.begin(), weightedEvents.end(), compareEventPulseTime);
+    switchable_sort(weightedEvents, compareEventPulseTime);
     break;
   case WEIGHTED_NOTIME:
     // Do nothing; there is no time to sort
@@ -1118,10 +1267,10 @@ void EventList::sortPulseTimeTOF() const {
 
   switch (eventType) {
   case TOF:
-    switchable_sort(events.begin(), events.end(), compareEventPulseTimeTOF);
+    switchable_sort(events, compareEventPulseTimeTOF);
     break;
   case WEIGHTED:
-    switchable_sort(weightedEvents.begin(), weightedEvents.end(), compareEventPulseTimeTOF);
+    switchable_sort(weightedEvents, compareEventPulseTimeTOF);
     break;
   case WEIGHTED_NOTIME:
     // Do nothing; there is no time to sort
@@ -1147,10 +1296,10 @@ void EventList::sortPulseTimeTOFDelta(const Types::Core::DateAndTime &start, con
 
   switch (eventType) {
   case TOF:
-    switchable_sort(events.begin(), events.end(), std::move(comparator));
+    switchable_sort(events, std::move(comparator));
     break;
   case WEIGHTED:
-    switchable_sort(weightedEvents.begin(), weightedEvents.end(), std::move(comparator));
+    switchable_sort(weightedEvents, std::move(comparator));
     break;
   case WEIGHTED_NOTIME:
     // Do nothing; there is no time to sort
@@ -1183,13 +1332,13 @@ void EventList::reverse() {
   if (this->isSortedByTof()) {
     switch (eventType) {
     case TOF:
-      std::reverse(this->events.begin(), this->events.end());
+      reverseEvents(this->events);
       break;
     case WEIGHTED:
-      std::reverse(this->weightedEvents.begin(), this->weightedEvents.end());
+      reverseEvents(this->weightedEvents);
       break;
     case WEIGHTED_NOTIME:
-      std::reverse(this->weightedEventsNoTime.begin(), this->weightedEventsNoTime.end());
+      reverseEvents(this->weightedEventsNoTime);
       break;
     }
     // And we are still sorted! :)
@@ -1208,11 +1357,11 @@ void EventList::reverse() {
 size_t EventList::getNumberEvents() const {
   switch (eventType) {
   case TOF:
-    return this->events.size();
+    return this->events->size();
   case WEIGHTED:
-    return this->weightedEvents.size();
+    return this->weightedEvents->size();
   case WEIGHTED_NOTIME:
-    return this->weightedEventsNoTime.size();
+    return this->weightedEventsNoTime->size();
   }
   throw std::runtime_error("EventList: invalid event type value was found.");
 }
@@ -1223,11 +1372,11 @@ size_t EventList::getNumberEvents() const {
 bool EventList::empty() const {
   switch (eventType) {
   case TOF:
-    return this->events.empty();
+    return this->events->empty();
   case WEIGHTED:
-    return this->weightedEvents.empty();
+    return this->weightedEvents->empty();
   case WEIGHTED_NOTIME:
-    return this->weightedEventsNoTime.empty();
+    return this->weightedEventsNoTime->empty();
   }
   throw std::runtime_error("EventList: invalid event type value was found.");
 }
@@ -1235,18 +1384,19 @@ bool EventList::empty() const {
 // --------------------------------------------------------------------------
 /** Memory used by this event list. Note: It reports the CAPACITY of the
  * vectors, rather than their size, since that is a more accurate
- * representation of the size used.
+ * representation of the size used. Events shared with other EventLists are
+ * split evenly between them so that they are only counted once in total.
  *
  * @return :: the memory used by the EventList, in bytes.
  * */
 size_t EventList::getMemorySize() const {
   switch (eventType) {
   case TOF:
-    return this->events.capacity() * sizeof(TofEvent) + sizeof(EventList);
+    return sharedEventsMemorySize(events) + sizeof(EventList);
   case WEIGHTED:
-    return this->weightedEvents.capacity() * sizeof(WeightedEvent) + sizeof(EventList);
+    return sharedEventsMemorySize(weightedEvents) + sizeof(EventList);
   case WEIGHTED_NOTIME:
-    return this->weightedEventsNoTime.capacity() * sizeof(WeightedEventNoTime) + sizeof(EventList);
+    return sharedEventsMemorySize(weightedEventsNoTime) + sizeof(EventList);
   }
   throw std::runtime_error("EventList: invalid event type value was found.");
 }
@@ -1732,7 +1882,7 @@ void EventList::compressEvents(double tolerance, EventList *destination) {
       //        compressEventsParallelHelper(this->events,
       //        destination->weightedEventsNoTime, tolerance);
       //      else
-      compressEventsHelper(this->events, destination->weightedEventsNoTime, tolerance);
+      compressEventsHelper(*this->events, destination->weightedEventsNoTime.access(), tolerance);
       break;
 
     case WEIGHTED:
@@ -1740,7 +1890,7 @@ void EventList::compressEvents(double tolerance, EventList *destination) {
       //        compressEventsParallelHelper(this->weightedEvents,
       //        destination->weightedEventsNoTime, tolerance);
       //      else
-      compressEventsHelper(this->weightedEvents, destination->weightedEventsNoTime, tolerance);
+      compressEventsHelper(*this->weightedEvents, destination->weightedEventsNoTime.access(), tolerance);
 
       break;
 
@@ -1753,15 +1903,15 @@ void EventList::compressEvents(double tolerance, EventList *destination) {
         //          out,
         //          tolerance);
         //        else
-        compressEventsHelper(this->weightedEventsNoTime, out, tolerance);
+        compressEventsHelper(*this->weightedEventsNoTime, out, tolerance);
         // Put it back
-        this->weightedEventsNoTime.swap(out);
+        this->weightedEventsNoTime = Kernel::make_cow<std::vector<WeightedEventNoTime>>(std::move(out));
       } else {
         //        if (parallel)
         //          compressEventsParallelHelper(this->weightedEventsNoTime,
         //          destination->weightedEventsNoTime, tolerance);
         //        else
-        compressEventsHelper(this->weightedEventsNoTime, destination->weightedEventsNoTime, tolerance);
+        compressEventsHelper(*this->weightedEventsNoTime, destination->weightedEventsNoTime.access(), tolerance);
       }
       break;
     }
@@ -1824,7 +1974,7 @@ void EventList::compressEvents(double tolerance, EventList *destination,
     case TOF: {
       std::vector<double> tof(NUM_BINS, 0);
       std::vector<uint32_t> count(NUM_BINS, 0);
-      for (const auto &ev : this->events) {
+      for (const auto &ev : *this->events) {
         const auto &bin_optional = findBin(*histogram_bin_edges.get(), ev.m_tof, false);
         if (bin_optional) {
           const auto bin = bin_optional.value();
@@ -1836,16 +1986,17 @@ void EventList::compressEvents(double tolerance, EventList *destination,
       // average TOFs
       std::transform(tof.begin(), tof.end(), count.begin(), tof.begin(), std::divides<double>());
 
-      createWeightedEvents(destination->weightedEventsNoTime, tof, count, count);
+      createWeightedEvents(destination->weightedEventsNoTime.access(), tof, count, count);
     } break;
 
     case WEIGHTED:
-      processWeightedEvents(this->weightedEvents, destination->weightedEventsNoTime, histogram_bin_edges, findBin);
+      processWeightedEvents(*this->weightedEvents, destination->weightedEventsNoTime.access(), histogram_bin_edges,
+                            findBin);
       break;
 
     case WEIGHTED_NOTIME:
-      processWeightedEvents(this->weightedEventsNoTime, destination->weightedEventsNoTime, histogram_bin_edges,
-                            findBin);
+      processWeightedEvents(*this->weightedEventsNoTime, destination->weightedEventsNoTime.access(),
+                            histogram_bin_edges, findBin);
       break;
     }
   }
@@ -1868,18 +2019,19 @@ void EventList::compressFatEvents(const double tolerance, const Mantid::Types::C
       throw std::invalid_argument("Cannot compress events that do not have pulsetime");
     case TOF:
       this->sortPulseTimeTOFDelta(timeStart, seconds);
-      compressFatEventsHelper(this->events, destination->weightedEvents, tolerance, timeStart, seconds);
+      compressFatEventsHelper(*this->events, destination->weightedEvents.access(), tolerance, timeStart, seconds);
       break;
     case WEIGHTED:
       this->sortPulseTimeTOFDelta(timeStart, seconds);
       if (destination == this) {
         // Put results in a temp output
         std::vector<WeightedEvent> out;
-        compressFatEventsHelper(this->weightedEvents, out, tolerance, timeStart, seconds);
+        compressFatEventsHelper(*this->weightedEvents, out, tolerance, timeStart, seconds);
         // Put it back
-        this->weightedEvents.swap(out);
+        this->weightedEvents = Kernel::make_cow<std::vector<WeightedEvent>>(std::move(out));
       } else {
-        compressFatEventsHelper(this->weightedEvents, destination->weightedEvents, tolerance, timeStart, seconds);
+        compressFatEventsHelper(*this->weightedEvents, destination->weightedEvents.access(), tolerance, timeStart,
+                                seconds);
       }
       break;
     }
@@ -2214,11 +2366,11 @@ void EventList::generateHistogram(const MantidVec &X, MantidVec &Y, MantidVec &E
     break;
 
   case WEIGHTED:
-    histogramForWeightsHelper(this->weightedEvents, X, Y, E);
+    histogramForWeightsHelper(*this->weightedEvents, X, Y, E);
     break;
 
   case WEIGHTED_NOTIME:
-    histogramForWeightsHelper(this->weightedEventsNoTime, X, Y, E);
+    histogramForWeightsHelper(*this->weightedEventsNoTime, X, Y, E);
     break;
   }
 }
@@ -2252,15 +2404,68 @@ void EventList::generateHistogram(const double step, const MantidVec &X, MantidV
     break;
 
   case WEIGHTED:
-    histogramForWeightsHelper(this->weightedEvents, step, X, Y, E);
+    histogramForWeightsHelper(*this->weightedEvents, step, X, Y, E);
     break;
 
   case WEIGHTED_NOTIME:
-    histogramForWeightsHelper(this->weightedEventsNoTime, step, X, Y, E);
+    histogramForWeightsHelper(*this->weightedEventsNoTime, step, X, Y, E);
     break;
   }
 }
 
+// --------------------------------------------------------------------------
+/** Generates both the Y and E (error) histograms w.r.t TOF for an EventList with or without WeightedEvents.
+ *  This will zero out the Y array as part of the process.
+ *
+ * This places each event in its bin directly instead of sorting the events first, so works for any bin edges and
+ * never modifies the event list. This makes it safe to histogram the same list from several threads. If the events
+ * are already sorted the sorted histogram method is used, as that will be faster.
+ *
+ * @param X: x-bins supplied
+ * @param Y: counts returned
+ * @param E: errors returned
+ * @param skipError: skip calculating the error. This has no effect for weighted
+ *        events; you can just ignore the returned E vector.
+ */
+void EventList::generateHistogramWithoutSorting(const MantidVec &X, MantidVec &Y, MantidVec &E,
+                                                bool skipError) const {
+  if (isSortedByTof())
+    return generateHistogram(X, Y, E, skipError);
+
+  if (X.size() <= 1) {
+    // X was not set. Return an empty array.
+    Y.resize(0, 0);
+    return;
+  }
+
+  Y.assign(X.size() - 1, 0.0);
+  // Note: Errors will be squared until the last step.
+  E.assign(X.size() - 1, 0.0);
+  const EdgeBinFinder findBin(X);
+
+  switch (eventType) {
+  case TOF:
+    for (const TofEvent &ev : *this->events) {
+      if (const auto bin = findBin(ev.tof()))
+        ++Y[*bin];
+    }
+    if (!skipError)
+      this->generateErrorsHistogram(Y, E);
+    return;
+
+  case WEIGHTED:
+    histogramUnsortedHelper(*this->weightedEvents, findBin, Y, E);
+    break;
+
+  case WEIGHTED_NOTIME:
+    histogramUnsortedHelper(*this->weightedEventsNoTime, findBin, Y, E);
+    break;
+  }
+
+  // Now do the sqrt of all errors
+  std::transform(E.cbegin(), E.cend(), E.begin(), static_cast<double (*)(double)>(sqrt));
+}
+
 // --------------------------------------------------------------------------
 /** With respect to PulseTime Fill a histogram given specified histogram bounds.
  * Does not modify
@@ -2286,10 +2491,10 @@ void EventList::generateCountsHistogramPulseTime(const MantidVec &X, MantidVec &
   //---------------------- Histogram without weights
   //---------------------------------
 
-  if (!this->events.empty()) {
+  if (!this->events->empty()) {
     // Iterate through all events (sorted by pulse time)
-    auto itev = findFirstPulseEvent(this->events, X[0]);
-    auto itev_end = events.cend(); // cache for speed
+    auto itev = findFirstPulseEvent(*this->events, X[0]);
+    auto itev_end = events->cend(); // cache for speed
     // The above can still take you to end() if no events above X[0], so check
     // again.
     if (itev == itev_end)
@@ -2345,7 +2550,7 @@ void EventList::generateCountsHistogramPulseTime(const MantidVec &X, MantidVec &
 void EventList::generateCountsHistogramPulseTime(const double &xMin, const double &xMax, MantidVec &Y,
                                                  const double TOF_min, const double TOF_max) const {
 
-  if (this->events.empty())
+  if (this->events->empty())
     return;
 
   size_t nBins = Y.size();
@@ -2355,7 +2560,7 @@ void EventList::generateCountsHistogramPulseTime(const double &xMin, const doubl
 
   double step = (xMax - xMin) / static_cast<double>(nBins);
 
-  for (const TofEvent &ev : this->events) {
+  for (const TofEvent &ev : *this->events) {
     double pulsetime = static_cast<double>(ev.pulseTime().totalNanoseconds());
     if (pulsetime < xMin || pulsetime >= xMax)
       continue;
@@ -2395,10 +2600,10 @@ void EventList::generateCountsHistogramTimeAtSample(const MantidVec &X, MantidVe
   //---------------------- Histogram without weights
   //---------------------------------
 
-  if (!this->events.empty()) {
+  if (!this->events->empty()) {
     // Iterate through all events (sorted by pulse time)
-    auto itev = findFirstTimeAtSampleEvent(this->events, X[0], tofFactor, tofOffset);
-    std::vector<TofEvent>::const_iterator itev_end = events.end(); // cache for speed
+    auto itev = findFirstTimeAtSampleEvent(*this->events, X[0], tofFactor, tofOffset);
+    std::vector<TofEvent>::const_iterator itev_end = events->end(); // cache for speed
     // The above can still take you to end() if no events above X[0], so check
     // again.
     if (itev == itev_end)
@@ -2460,12 +2665,12 @@ void EventList::generateCountsHistogram(const MantidVec &X, MantidVec &Y) const
   //---------------------------------
 
   // Do we even have any events to do?
-  if (!this->events.empty()) {
+  if (!this->events->empty()) {
     // Iterate through all events (sorted by tof) placing them in the correct
     // bin.
-    auto itev = findFirstEvent(this->events, TofEvent(X[0]));
+    auto itev = findFirstEvent(*this->events, TofEvent(X[0]));
     // Go through all the events,
-    for (auto itx = X.cbegin(); itev != events.end(); ++itev) {
+    for (auto itx = X.cbegin(); itev != events->end(); ++itev) {
       double tof = itev->tof();
       itx = std::find_if(itx, X.cend(), [tof](const double x) { return tof < x; });
       if (itx == X.cend()) {
@@ -2572,7 +2777,7 @@ void EventList::generateCountsHistogram(const double step, const MantidVec &X, M
     std::fill(Y.begin(), Y.end(), 0.0);
 
   // Do we even have any events to do?
-  if (this->events.empty())
+  if (this->events->empty())
     return;
 
   const auto xmin = X.front();
@@ -2580,7 +2785,7 @@ void EventList::generateCountsHistogram(const double step, const MantidVec &X, M
 
   auto findBin = FindBin(step, xmin);
 
-  for (const TofEvent &ev : this->events) {
+  for (const TofEvent &ev : *this->events) {
     const double tof = ev.tof();
     if (tof < xmin || tof >= xmax)
       continue;
@@ -2620,8 +2825,8 @@ void EventList::generateErrorsHistogram(const MantidVec &Y, MantidVec &E) const
  * @param error :: reference to a double to put the error in.
  */
 template <class T>
-void EventList::integrateHelper(std::vector<T> &events, const double minX, const double maxX, const bool entireRange,
-                                double &sum, double &error) {
+void EventList::integrateHelper(const std::vector<T> &events, const double minX, const double maxX,
+                                const bool entireRange, double &sum, double &error) {
   sum = 0;
   error = 0;
   // Nothing in the list?
@@ -2691,13 +2896,13 @@ void EventList::integrate(const double minX, const double maxX, const bool entir
   // Convert the list
   switch (eventType) {
   case TOF:
-    integrateHelper(this->events, minX, maxX, entireRange, sum, error);
+    integrateHelper(*this->events, minX, maxX, entireRange, sum, error);
     break;
   case WEIGHTED:
-    integrateHelper(this->weightedEvents, minX, maxX, entireRange, sum, error);
+    integrateHelper(*this->weightedEvents, minX, maxX, entireRange, sum, error);
     break;
   case WEIGHTED_NOTIME:
-    integrateHelper(this->weightedEventsNoTime, minX, maxX, entireRange, sum, error);
+    integrateHelper(*this->weightedEventsNoTime, minX, maxX, entireRange, sum, error);
     break;
   default:
     throw std::runtime_error("EventList: invalid event type value was found.");
@@ -2733,13 +2938,13 @@ void EventList::convertTof(std::function<double(double)> func, const int sorting
   // Convert the list
   switch (eventType) {
   case TOF:
-    this->convertTofHelper(this->events, func);
+    this->convertTofHelper(this->events.access(), func);
     break;
   case WEIGHTED:
-    this->convertTofHelper(this->weightedEvents, func);
+    this->convertTofHelper(this->weightedEvents.access(), func);
     break;
   case WEIGHTED_NOTIME:
-    this->convertTofHelper(this->weightedEventsNoTime, func);
+    this->convertTofHelper(this->weightedEventsNoTime.access(), func);
     break;
   }
 }
@@ -2775,13 +2980,13 @@ void EventList::convertTof(const double factor, const double offset) {
   // Convert the list
   switch (eventType) {
   case TOF:
-    this->convertTofHelper(this->events, factor, offset);
+    this->convertTofHelper(this->events.access(), factor, offset);
     break;
   case WEIGHTED:
-    this->convertTofHelper(this->weightedEvents, factor, offset);
+    this->convertTofHelper(this->weightedEvents.access(), factor, offset);
     break;
   case WEIGHTED_NOTIME:
-    this->convertTofHelper(this->weightedEventsNoTime, factor, offset);
+    this->convertTofHelper(this->weightedEventsNoTime.access(), factor, offset);
     break;
   }
 }
@@ -2857,10 +3062,10 @@ void EventList::addPulsetime(const double seconds) {
   // Convert the list
   switch (eventType) {
   case TOF:
-    this->addPulsetimeHelper(this->events, seconds);
+    this->addPulsetimeHelper(this->events.access(), seconds);
     break;
   case WEIGHTED:
-    this->addPulsetimeHelper(this->weightedEvents, seconds);
+    this->addPulsetimeHelper(this->weightedEvents.access(), seconds);
     break;
   case WEIGHTED_NOTIME:
     throw std::runtime_error("EventList::addPulsetime() called on an event "
@@ -2885,10 +3090,10 @@ void EventList::addPulsetimes(const std::vector<double> &seconds) {
   // Convert the list
   switch (eventType) {
   case TOF:
-    this->addPulsetimesHelper(this->events, seconds);
+    this->addPulsetimesHelper(this->events.access(), seconds);
     break;
   case WEIGHTED:
-    this->addPulsetimesHelper(this->weightedEvents, seconds);
+    this->addPulsetimesHelper(this->weightedEvents.access(), seconds);
     break;
   case WEIGHTED_NOTIME:
     throw std::runtime_error("EventList::addPulsetime() called on an event "
@@ -2959,16 +3164,16 @@ void EventList::maskTof(const double tofMin, const double tofMax) {
   size_t numDel = 0;
   switch (eventType) {
   case TOF:
-    numOrig = this->events.size();
-    numDel = this->maskTofHelper(this->events, tofMin, tofMax);
+    numOrig = this->events->size();
+    numDel = this->maskTofHelper(this->events.access(), tofMin, tofMax);
     break;
   case WEIGHTED:
-    numOrig = this->weightedEvents.size();
-    numDel = this->maskTofHelper(this->weightedEvents, tofMin, tofMax);
+    numOrig = this->weightedEvents->size();
+    numDel = this->maskTofHelper(this->weightedEvents.access(), tofMin, tofMax);
     break;
   case WEIGHTED_NOTIME:
-    numOrig = this->weightedEventsNoTime.size();
-    numDel = this->maskTofHelper(this->weightedEventsNoTime, tofMin, tofMax);
+    numOrig = this->weightedEventsNoTime->size();
+    numDel = this->maskTofHelper(this->weightedEventsNoTime.access(), tofMin, tofMax);
     break;
   }
 
@@ -2976,6 +3181,28 @@ void EventList::maskTof(const double tofMin, const double tofMax) {
     this->clear(false);
 }
 
+// --------------------------------------------------------------------------
+/**
+ * Remove the events that have a tof outside of tofMin and tofMax (inclusively),
+ * like CropWorkspace. Unlike maskTof the list does not need to be sorted and
+ * its sort order is kept.
+ * @param tofMin :: lower bound of TOF to keep
+ * @param tofMax :: upper bound of TOF to keep
+ */
+void EventList::cropTof(const double tofMin, const double tofMax) {
+  switch (eventType) {
+  case TOF:
+    cropEvents(this->events, tofMin, tofMax);
+    break;
+  case WEIGHTED:
+    cropEvents(this->weightedEvents, tofMin, tofMax);
+    break;
+  case WEIGHTED_NOTIME:
+    cropEvents(this->weightedEventsNoTime, tofMin, tofMax);
+    break;
+  }
+}
+
 // --------------------------------------------------------------------------
 /** Mask out events by the condition vector.
  * Events are removed from the list.
@@ -3026,16 +3253,16 @@ void EventList::maskCondition(const std::vector<bool> &mask) {
   size_t numDel = 0;
   switch (eventType) {
   case TOF:
-    numOrig = this->events.size();
-    numDel = this->maskConditionHelper(this->events, mask);
+    numOrig = this->events->size();
+    numDel = this->maskConditionHelper(this->events.access(), mask);
     break;
   case WEIGHTED:
-    numOrig = this->weightedEvents.size();
-    numDel = this->maskConditionHelper(this->weightedEvents, mask);
+    numOrig = this->weightedEvents->size();
+    numDel = this->maskConditionHelper(this->weightedEvents.access(), mask);
     break;
   case WEIGHTED_NOTIME:
-    numOrig = this->weightedEventsNoTime.size();
-    numDel = this->maskConditionHelper(this->weightedEventsNoTime, mask);
+    numOrig = this->weightedEventsNoTime->size();
+    numDel = this->maskConditionHelper(this->weightedEventsNoTime.access(), mask);
     break;
   }
 
@@ -3065,13 +3292,13 @@ void EventList::getTofs(std::vector<double> &tofs) const {
   // Convert the list
   switch (eventType) {
   case TOF:
-    this->getTofsHelper(this->events, tofs);
+    this->getTofsHelper(*this->events, tofs);
     break;
   case WEIGHTED:
-    this->getTofsHelper(this->weightedEvents, tofs);
+    this->getTofsHelper(*this->weightedEvents, tofs);
     break;
   case WEIGHTED_NOTIME:
-    this->getTofsHelper(this->weightedEventsNoTime, tofs);
+    this->getTofsHelper(*this->weightedEventsNoTime, tofs);
     break;
   }
 }
@@ -3109,10 +3336,10 @@ void EventList::getWeights(std::vector<double> &weights) const {
   // Convert the list
   switch (eventType) {
   case WEIGHTED:
-    this->getWeightsHelper(this->weightedEvents, weights);
+    this->getWeightsHelper(*this->weightedEvents, weights);
     break;
   case WEIGHTED_NOTIME:
-    this->getWeightsHelper(this->weightedEventsNoTime, weights);
+    this->getWeightsHelper(*this->weightedEventsNoTime, weights);
     break;
   default:
     // not a weighted event type, return 1.0 for all.
@@ -3155,10 +3382,10 @@ void EventList::getWeightErrors(std::vector<double> &weightErrors) const {
   // Convert the list
   switch (eventType) {
   case WEIGHTED:
-    this->getWeightErrorsHelper(this->weightedEvents, weightErrors);
+    this->getWeightErrorsHelper(*this->weightedEvents, weightErrors);
     break;
   case WEIGHTED_NOTIME:
-    this->getWeightErrorsHelper(this->weightedEventsNoTime, weightErrors);
+    this->getWeightErrorsHelper(*this->weightedEventsNoTime, weightErrors);
     break;
   default:
     // not a weighted event type, return 1.0 for all.
@@ -3187,16 +3414,16 @@ std::vector<DateAndTime> EventList::eventTimesCalculator(const UnaryOperation &t
   std::vector<DateAndTime> times;
   switch (eventType) {
   case TOF:
-    times.reserve(events.size());
-    std::transform(events.cbegin(), events.cend(), std::back_inserter(times), timesCalc);
+    times.reserve(events->size());
+    std::transform(events->cbegin(), events->cend(), std::back_inserter(times), timesCalc);
     break;
   case WEIGHTED:
-    times.reserve(weightedEvents.size());
-    std::transform(weightedEvents.cbegin(), weightedEvents.cend(), std::back_inserter(times), timesCalc);
+    times.reserve(weightedEvents->size());
+    std::transform(weightedEvents->cbegin(), weightedEvents->cend(), std::back_inserter(times), timesCalc);
     break;
   case WEIGHTED_NOTIME:
-    times.reserve(weightedEventsNoTime.size());
-    std::transform(weightedEventsNoTime.cbegin(), weightedEventsNoTime.cend(), std::back_inserter(times), timesCalc);
+    times.reserve(weightedEventsNoTime->size());
+    std::transform(weightedEventsNoTime->cbegin(), weightedEventsNoTime->cend(), std::back_inserter(times), timesCalc);
     break;
   }
   return times;
@@ -3257,26 +3484,26 @@ double EventList::getTofMin() const {
   if (this->order == TOF_SORT) {
     switch (eventType) {
     case TOF:
-      return this->events.begin()->tof();
+      return this->events->begin()->tof();
     case WEIGHTED:
-      return this->weightedEvents.begin()->tof();
+      return this->weightedEvents->begin()->tof();
     case WEIGHTED_NOTIME:
-      return this->weightedEventsNoTime.begin()->tof();
+      return this->weightedEventsNoTime->begin()->tof();
     }
   }
 
   // now we are stuck with a linear search
   switch (eventType) {
   case TOF: {
-    tMin = getTofMinimumHelper(this->events);
+    tMin = getTofMinimumHelper(*this->events);
     break;
   }
   case WEIGHTED: {
-    tMin = getTofMinimumHelper(this->weightedEvents);
+    tMin = getTofMinimumHelper(*this->weightedEvents);
     break;
   }
   case WEIGHTED_NOTIME: {
-    tMin = getTofMinimumHelper(this->weightedEventsNoTime);
+    tMin = getTofMinimumHelper(*this->weightedEventsNoTime);
     break;
   }
   }
@@ -3299,26 +3526,26 @@ double EventList::getTofMax() const {
   if (this->order == TOF_SORT) {
     switch (eventType) {
     case TOF:
-      return this->events.rbegin()->tof();
+      return this->events->rbegin()->tof();
     case WEIGHTED:
-      return this->weightedEvents.rbegin()->tof();
+      return this->weightedEvents->rbegin()->tof();
     case WEIGHTED_NOTIME:
-      return this->weightedEventsNoTime.rbegin()->tof();
+      return this->weightedEventsNoTime->rbegin()->tof();
     }
   }
 
   // now we are stuck with a linear search
   switch (eventType) {
   case TOF: {
-    tMax = getTofMaximumHelper(this->events);
+    tMax = getTofMaximumHelper(*this->events);
     break;
   }
   case WEIGHTED: {
-    tMax = getTofMaximumHelper(this->weightedEvents);
+    tMax = getTofMaximumHelper(*this->weightedEvents);
     break;
   }
   case WEIGHTED_NOTIME: {
-    tMax = getTofMaximumHelper(this->weightedEventsNoTime);
+    tMax = getTofMaximumHelper(*this->weightedEventsNoTime);
     break;
   }
   }
@@ -3342,11 +3569,11 @@ DateAndTime EventList::getPulseTimeMin() const {
   if (this->order == PULSETIME_SORT) {
     switch (eventType) {
     case TOF:
-      return this->events.begin()->pulseTime();
+      return this->events->begin()->pulseTime();
     case WEIGHTED:
-      return this->weightedEvents.begin()->pulseTime();
+      return this->weightedEvents->begin()->pulseTime();
     case WEIGHTED_NOTIME:
-      return this->weightedEventsNoTime.begin()->pulseTime();
+      return this->weightedEventsNoTime->begin()->pulseTime();
     }
   }
 
@@ -3356,13 +3583,13 @@ DateAndTime EventList::getPulseTimeMin() const {
   for (size_t i = 0; i < numEvents; i++) {
     switch (eventType) {
     case TOF:
-      temp = this->events[i].pulseTime();
+      temp = (*this->events)[i].pulseTime();
       break;
     case WEIGHTED:
-      temp = this->weightedEvents[i].pulseTime();
+      temp = (*this->weightedEvents)[i].pulseTime();
       break;
     case WEIGHTED_NOTIME:
-      temp = this->weightedEventsNoTime[i].pulseTime();
+      temp = (*this->weightedEventsNoTime)[i].pulseTime();
       break;
     }
     if (temp < tMin)
@@ -3386,11 +3613,11 @@ DateAndTime EventList::getPulseTimeMax() const {
   if (this->order == PULSETIME_SORT) {
     switch (eventType) {
     case TOF:
-      return this->events.rbegin()->pulseTime();
+      return this->events->rbegin()->pulseTime();
     case WEIGHTED:
-      return this->weightedEvents.rbegin()->pulseTime();
+      return this->weightedEvents->rbegin()->pulseTime();
     case WEIGHTED_NOTIME:
-      return this->weightedEventsNoTime.rbegin()->pulseTime();
+      return this->weightedEventsNoTime->rbegin()->pulseTime();
     }
   }
 
@@ -3400,13 +3627,13 @@ DateAndTime EventList::getPulseTimeMax() const {
   for (size_t i = 0; i < numEvents; i++) {
     switch (eventType) {
     case TOF:
-      temp = this->events[i].pulseTime();
+      temp = (*this->events)[i].pulseTime();
       break;
     case WEIGHTED:
-      temp = this->weightedEvents[i].pulseTime();
+      temp = (*this->weightedEvents)[i].pulseTime();
       break;
     case WEIGHTED_NOTIME:
-      temp = this->weightedEventsNoTime[i].pulseTime();
+      temp = (*this->weightedEventsNoTime)[i].pulseTime();
       break;
     }
     if (temp > tMax)
@@ -3429,16 +3656,16 @@ void EventList::getPulseTimeMinMax(Mantid::Types::Core::DateAndTime &tMin,
   if (this->order == PULSETIME_SORT) {
     switch (eventType) {
     case TOF:
-      tMin = this->events.begin()->pulseTime();
-      tMax = this->events.rbegin()->pulseTime();
+      tMin = this->events->begin()->pulseTime();
+      tMax = this->events->rbegin()->pulseTime();
       return;
     case WEIGHTED:
-      tMin = this->weightedEvents.begin()->pulseTime();
-      tMax = this->weightedEvents.rbegin()->pulseTime();
+      tMin = this->weightedEvents->begin()->pulseTime();
+      tMax = this->weightedEvents->rbegin()->pulseTime();
       return;
     case WEIGHTED_NOTIME:
-      tMin = this->weightedEventsNoTime.begin()->pulseTime();
-      tMax = this->weightedEventsNoTime.rbegin()->pulseTime();
+      tMin = this->weightedEventsNoTime->begin()->pulseTime();
+      tMax = this->weightedEventsNoTime->rbegin()->pulseTime();
       return;
     }
   }
@@ -3449,13 +3676,13 @@ void EventList::getPulseTimeMinMax(Mantid::Types::Core::DateAndTime &tMin,
   for (size_t i = 0; i < numEvents; i++) {
     switch (eventType) {
     case TOF:
-      temp = this->events[i].pulseTime();
+      temp = (*this->events)[i].pulseTime();
       break;
     case WEIGHTED:
-      temp = this->weightedEvents[i].pulseTime();
+      temp = (*this->weightedEvents)[i].pulseTime();
       break;
     case WEIGHTED_NOTIME:
-      temp = this->weightedEventsNoTime[i].pulseTime();
+      temp = (*this->weightedEventsNoTime)[i].pulseTime();
       break;
     }
     if (temp > tMax)
@@ -3477,11 +3704,11 @@ DateAndTime EventList::getTimeAtSampleMax(const double &tofFactor, const double
   if (this->order == TIMEATSAMPLE_SORT) {
     switch (eventType) {
     case TOF:
-      return calculateCorrectedFullTime(*(this->events.rbegin()), tofFactor, tofOffset);
+      return calculateCorrectedFullTime(*(this->events->rbegin()), tofFactor, tofOffset);
     case WEIGHTED:
-      return calculateCorrectedFullTime(*(this->weightedEvents.rbegin()), tofFactor, tofOffset);
+      return calculateCorrectedFullTime(*(this->weightedEvents->rbegin()), tofFactor, tofOffset);
     case WEIGHTED_NOTIME:
-      return calculateCorrectedFullTime(*(this->weightedEventsNoTime.rbegin()), tofFactor, tofOffset);
+      return calculateCorrectedFullTime(*(this->weightedEventsNoTime->rbegin()), tofFactor, tofOffset);
     }
   }
 
@@ -3491,13 +3718,13 @@ DateAndTime EventList::getTimeAtSampleMax(const double &tofFactor, const double
   for (size_t i = 0; i < numEvents; i++) {
     switch (eventType) {
     case TOF:
-      temp = calculateCorrectedFullTime(this->events[i], tofFactor, tofOffset);
+      temp = calculateCorrectedFullTime((*this->events)[i], tofFactor, tofOffset);
       break;
     case WEIGHTED:
-      temp = calculateCorrectedFullTime(this->weightedEvents[i], tofFactor, tofOffset);
+      temp = calculateCorrectedFullTime((*this->weightedEvents)[i], tofFactor, tofOffset);
       break;
     case WEIGHTED_NOTIME:
-      temp = calculateCorrectedFullTime(this->weightedEventsNoTime[i], tofFactor, tofOffset);
+      temp = calculateCorrectedFullTime((*this->weightedEventsNoTime)[i], tofFactor, tofOffset);
       break;
     }
     if (temp > tMax)
@@ -3518,11 +3745,11 @@ DateAndTime EventList::getTimeAtSampleMin(const double &tofFactor, const double
   if (this->order == TIMEATSAMPLE_SORT) {
     switch (eventType) {
     case TOF:
-      return calculateCorrectedFullTime(*(this->events.begin()), tofFactor, tofOffset);
+      return calculateCorrectedFullTime(*(this->events->begin()), tofFactor, tofOffset);
     case WEIGHTED:
-      return calculateCorrectedFullTime(*(this->weightedEvents.begin()), tofFactor, tofOffset);
+      return calculateCorrectedFullTime(*(this->weightedEvents->begin()), tofFactor, tofOffset);
     case WEIGHTED_NOTIME:
-      return calculateCorrectedFullTime(*(this->weightedEventsNoTime.begin()), tofFactor, tofOffset);
+      return calculateCorrectedFullTime(*(this->weightedEventsNoTime->begin()), tofFactor, tofOffset);
     }
   }
 
@@ -3532,13 +3759,13 @@ DateAndTime EventList::getTimeAtSampleMin(const double &tofFactor, const double
   for (size_t i = 0; i < numEvents; i++) {
     switch (eventType) {
     case TOF:
-      temp = calculateCorrectedFullTime(this->events[i], tofFactor, tofOffset);
+      temp = calculateCorrectedFullTime((*this->events)[i], tofFactor, tofOffset);
       break;
     case WEIGHTED:
-      temp = calculateCorrectedFullTime(this->weightedEvents[i], tofFactor, tofOffset);
+      temp = calculateCorrectedFullTime((*this->weightedEvents)[i], tofFactor, tofOffset);
       break;
     case WEIGHTED_NOTIME:
-      temp = calculateCorrectedFullTime(this->weightedEventsNoTime[i], tofFactor, tofOffset);
+      temp = calculateCorrectedFullTime((*this->weightedEventsNoTime)[i], tofFactor, tofOffset);
       break;
     }
     if (temp < tMin)
@@ -3577,13 +3804,13 @@ void EventList::setTofs(const MantidVec &tofs) {
   // Convert the list
   switch (eventType) {
   case TOF:
-    this->setTofsHelper(this->events, tofs);
+    this->setTofsHelper(this->events.access(), tofs);
     break;
   case WEIGHTED:
-    this->setTofsHelper(this->weightedEvents, tofs);
+    this->setTofsHelper(this->weightedEvents.access(), tofs);
     break;
   case WEIGHTED_NOTIME:
-    this->setTofsHelper(this->weightedEventsNoTime, tofs);
+    this->setTofsHelper(this->weightedEventsNoTime.access(), tofs);
     break;
   }
 }
@@ -3681,11 +3908,11 @@ void EventList::multiply(const double value, const double error) {
     // Fall through
 
   case WEIGHTED:
-    multiplyHelper(this->weightedEvents, value, error);
+    multiplyHelper(this->weightedEvents.access(), value, error);
     break;
 
   case WEIGHTED_NOTIME:
-    multiplyHelper(this->weightedEventsNoTime, value, error);
+    multiplyHelper(this->weightedEventsNoTime.access(), value, error);
     break;
   }
 }
@@ -3804,13 +4031,13 @@ void EventList::multiply(const MantidVec &X, const MantidVec &Y, const MantidVec
   case WEIGHTED:
     // Sorting by tof is necessary for the algorithm
     this->sortTof();
-    multiplyHistogramHelper(this->weightedEvents, X, Y, E);
+    multiplyHistogramHelper(this->weightedEvents.access(), X, Y, E);
     break;
 
   case WEIGHTED_NOTIME:
     // Sorting by tof is necessary for the algorithm
     this->sortTof();
-    multiplyHistogramHelper(this->weightedEventsNoTime, X, Y, E);
+    multiplyHistogramHelper(this->weightedEventsNoTime.access(), X, Y, E);
     break;
   }
 }
@@ -3941,13 +4168,13 @@ void EventList::divide(const MantidVec &X, const MantidVec &Y, const MantidVec &
   case WEIGHTED:
     // Sorting by tof is necessary for the algorithm
     this->sortTof();
-    divideHistogramHelper(this->weightedEvents, X, Y, E);
+    divideHistogramHelper(this->weightedEvents.access(), X, Y, E);
     break;
 
   case WEIGHTED_NOTIME:
     // Sorting by tof is necessary for the algorithm
     this->sortTof();
-    divideHistogramHelper(this->weightedEventsNoTime, X, Y, E);
+    divideHistogramHelper(this->weightedEventsNoTime.access(), X, Y, E);
     break;
   }
 }
@@ -4025,10 +4252,10 @@ void EventList::filterByPulseTime(Types::Core::DateAndTime start, Types::Core::D
   // Iterate through all events (sorted by pulse time)
   switch (eventType) {
   case TOF:
-    filterByPulseTimeHelper(this->events, start, stop, output.events);
+    filterByPulseTimeHelper(*this->events, start, stop, output.events.access());
     break;
   case WEIGHTED:
-    filterByPulseTimeHelper(this->weightedEvents, start, stop, output.weightedEvents);
+    filterByPulseTimeHelper(*this->weightedEvents, start, stop, output.weightedEvents.access());
     break;
   case WEIGHTED_NOTIME:
     throw std::runtime_error("EventList::filterByPulseTime() called on an "
@@ -4069,10 +4296,10 @@ void EventList::filterByPulseTime(Kernel::TimeROI const *timeRoi, EventList *out
 
   switch (eventType) {
   case TOF:
-    filterByTimeROIHelper(this->events, intervals, output);
+    filterByTimeROIHelper(*this->events, intervals, output);
     break;
   case WEIGHTED:
-    filterByTimeROIHelper(this->weightedEvents, intervals, output);
+    filterByTimeROIHelper(*this->weightedEvents, intervals, output);
     break;
   case WEIGHTED_NOTIME:
     throw std::runtime_error("EventList::filterByPulseTime() called on an "
@@ -4089,7 +4316,7 @@ void EventList::filterByPulseTime(Kernel::TimeROI const *timeRoi, EventList *out
  * @param output :: reference to an event list that will be output.
  */
 template <class T>
-void EventList::filterByPulseTimeHelper(std::vector<T> &events, DateAndTime start, DateAndTime stop,
+void EventList::filterByPulseTimeHelper(const std::vector<T> &events, DateAndTime start, DateAndTime stop,
                                         std::vector<T> &output) {
   std::copy_if(events.begin(), events.end(), std::back_inserter(output),
                [start, stop](const T &t) { return (t.m_pulsetime >= start) && (t.m_pulsetime < stop); });
@@ -4102,7 +4329,7 @@ void EventList::filterByPulseTimeHelper(std::vector<T> &events, DateAndTime star
  * @param output :: reference to an event list that will be output.
  */
 template <class T>
-void EventList::filterByTimeROIHelper(std::vector<T> &events, const std::vector<Kernel::TimeInterval> &intervals,
+void EventList::filterByTimeROIHelper(const std::vector<T> &events, const std::vector<Kernel::TimeInterval> &intervals,
                                       EventList *output) {
   // Iterate through the splitter at the same time
   auto itspl = intervals.cbegin();
@@ -4158,10 +4385,10 @@ void EventList::filterInPlace(Kernel::TimeROI const *timeRoi) {
   // Iterate through all events (sorted by pulse time)
   switch (eventType) {
   case TOF:
-    filterInPlaceHelper(timeRoi, this->events);
+    filterInPlaceHelper(timeRoi, this->events.access());
     break;
   case WEIGHTED:
-    filterInPlaceHelper(timeRoi, this->weightedEvents);
+    filterInPlaceHelper(timeRoi, this->weightedEvents.access());
     break;
   case WEIGHTED_NOTIME:
     throw std::runtime_error("EventList::filterInPlace() called on an "
@@ -4326,11 +4553,22 @@ void getEventsFrom(const EventList &el, std::vector<WeightedEventNoTime> const *
 template <class T>
 void EventList::convertUnitsViaTofHelper(typename std::vector<T> &events, Mantid::Kernel::Unit const *fromUnit,
                                          Mantid::Kernel::Unit const *toUnit) {
-  for (auto &itev : events) {
-    // Conver to TOF
-    const double tof = fromUnit->singleToTOF(itev.m_tof);
+  // Work through the events in blocks small enough to stay in cache so that
+  // each unit converts a contiguous array of values in a single call
+  constexpr size_t blockSize = 1024;
+  std::array<double, blockSize> buffer;
+  for (auto first = events.begin(); first != events.end();) {
+    const auto count = std::min(blockSize, static_cast<size_t>(std::distance(first, events.end())));
+    const auto last = std::next(first, count);
+    const std::span<double> values(buffer.data(), count);
+    std::transform(first, last, values.begin(), [](const T &event) { return event.m_tof; });
+    // Convert to TOF
+    fromUnit->convertToTOF(values);
     // And back from TOF to whatever
-    itev.m_tof = toUnit->singleFromTOF(tof);
+    toUnit->convertFromTOF(values);
+    auto value = values.begin();
+    for (; first != last; ++first, ++value)
+      first->m_tof = *value;
   }
 }
 
@@ -4353,13 +4591,13 @@ void EventList::convertUnitsViaTof(Mantid::Kernel::Unit const *fromUnit, Mantid:
 
   switch (eventType) {
   case TOF:
-    convertUnitsViaTofHelper(this->events, fromUnit, toUnit);
+    convertUnitsViaTofHelper(this->events.access(), fromUnit, toUnit);
     break;
   case WEIGHTED:
-    convertUnitsViaTofHelper(this->weightedEvents, fromUnit, toUnit);
+    convertUnitsViaTofHelper(this->weightedEvents.access(), fromUnit, toUnit);
     break;
   case WEIGHTED_NOTIME:
-    convertUnitsViaTofHelper(this->weightedEventsNoTime, fromUnit, toUnit);
+    convertUnitsViaTofHelper(this->weightedEventsNoTime.access(), fromUnit, toUnit);
     break;
   }
 }
@@ -4388,13 +4626,13 @@ void EventList::convertUnitsQuicklyHelper(typename std::vector<T> &events, const
 void EventList::convertUnitsQuickly(const double &factor, const double &power) {
   switch (eventType) {
   case TOF:
-    convertUnitsQuicklyHelper(this->events, factor, power);
+    convertUnitsQuicklyHelper(this->events.access(), factor, power);
     break;
   case WEIGHTED:
-    convertUnitsQuicklyHelper(this->weightedEvents, factor, power);
+    convertUnitsQuicklyHelper(this->weightedEvents.access(), factor, power);
     break;
   case WEIGHTED_NOTIME:
-    convertUnitsQuicklyHelper(this->weightedEventsNoTime, factor, power);
+    convertUnitsQuicklyHelper(this->weightedEventsNoTime.access(), factor, power);
     break;
   }
 }
@@ -49,7 +49,7 @@ EventWorkspace::EventWorkspace() : IEventWorkspace(), mru(std::make_unique<Event
 EventWorkspace::EventWorkspace(const EventWorkspace &other)
     : IEventWorkspace(other), mru(std::make_unique<EventWorkspaceMRU>()) {
   for (const auto &el : other.data) {
-    // Create a new event list, copying over the events
+    // Create a new event list, sharing the events until either list is modified
     auto newel = std::make_unique<EventList>(*el);
     // Make sure to update the MRU to point to THIS event workspace.
     newel->setMRU(this->mru.get());
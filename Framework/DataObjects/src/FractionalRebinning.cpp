@@ -10,6 +10,8 @@
 #include "MantidGeometry/Math/ConvexPolygon.h"
 #include "MantidGeometry/Math/PolygonIntersection.h"
 #include "MantidGeometry/Math/Quadrilateral.h"
+#include "MantidKernel/Memory.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/V2D.h"
 
 #include <cmath>
@@ -113,6 +115,27 @@ bool getIntersectionRegion(const std::vector<double> &xAxis, const std::vector<d
   return true;
 }
 
+/**
+ * Computes the length of the overlap of an interval with each of a range of
+ * consecutive bins. Overlaps of axis-aligned rectangles are separable, so
+ * the area of overlap with a rectangular output bin is the product of the
+ * lengths along each axis.
+ * @param axis The bin edges
+ * @param lo The lower end of the interval
+ * @param hi The upper end of the interval
+ * @param start The index of the first bin
+ * @param end One past the index of the last bin
+ * @return The overlap with each bin, zero where they do not overlap
+ */
+std::vector<double> overlapLengths(const std::vector<double> &axis, const double lo, const double hi,
+                                   const size_t start, const size_t end) {
+  std::vector<double> lengths(end - start);
+  for (size_t i = start; i < end; ++i) {
+    lengths[i - start] = std::max(0., std::min(axis[i + 1], hi) - std::max(axis[i], lo));
+  }
+  return lengths;
+}
+
 /**
  * Computes the output grid bins which intersect the input quad and their
  * overlapping areas assuming both input and output grids are rectangular
@@ -128,21 +151,14 @@ bool getIntersectionRegion(const std::vector<double> &xAxis, const std::vector<d
 void calcRectangleIntersections(const std::vector<double> &xAxis, const std::vector<double> &yAxis,
                                 const Quadrilateral &inputQ, const size_t y_start, const size_t y_end,
                                 const size_t x_start, const size_t x_end, std::vector<AreaInfo> &areaInfos) {
-  std::vector<double> width;
-  width.reserve(x_end - x_start);
-  for (size_t xi = x_start; xi < x_end; ++xi) {
-    const double x0 = (xi == x_start) ? inputQ.minX() : xAxis[xi];
-    const double x1 = (xi == x_end - 1) ? inputQ.maxX() : xAxis[xi + 1];
-    width.emplace_back(x1 - x0);
-  }
+  const auto width = overlapLengths(xAxis, inputQ.minX(), inputQ.maxX(), x_start, x_end);
+  const auto height = overlapLengths(yAxis, inputQ.minY(), inputQ.maxY(), y_start, y_end);
   areaInfos.reserve((y_end - y_start) * (x_end - x_start));
   for (size_t yi = y_start; yi < y_end; ++yi) {
-    const double y0 = (yi == y_start) ? inputQ.minY() : yAxis[yi];
-    const double y1 = (yi == y_end - 1) ? inputQ.maxY() : yAxis[yi + 1];
-    const double height = y1 - y0;
+    const double binHeight = height[yi - y_start];
     auto width_it = width.begin();
     for (size_t xi = x_start; xi < x_end; ++xi) {
-      areaInfos.emplace_back(xi, yi, height * (*width_it++));
+      areaInfos.emplace_back(xi, yi, binHeight * (*width_it++));
     }
   }
 }
@@ -490,31 +506,63 @@ void normaliseOutput(const MatrixWorkspace_sptr &outputWS, const MatrixWorkspace
     rebinnedWS->setSqrdErrors(false);
 }
 
+namespace {
 /**
- * Rebin the input quadrilateral to the output grid.
- * The quadrilateral must have a CLOCKWISE winding.
+ * Rebin the input quadrilateral to an output grid, passing each overlap to
+ * the given accumulator. The quadrilateral must have a CLOCKWISE winding.
  * @param inputQ The input polygon (Polygon winding must be Clockwise)
  * @param inputWS The input workspace containing the input intensity values
  * @param i The index in the vertical axis direction that inputQ references
  * @param j The index in the horizontal axis direction that inputQ references
- * @param outputWS A pointer to the output workspace that accumulates the data
+ * @param X A vector containing the output horizontal axis bin boundaries
  * @param verticalAxis A vector containing the output vertical axis bin
  * boundaries
+ * @param accumulate Called with (wsIndex, binIndex, signal, variance) for
+ * each output bin overlapping inputQ
  */
-void rebinToOutput(const Quadrilateral &inputQ, const MatrixWorkspace_const_sptr &inputWS, const size_t i,
-                   const size_t j, MatrixWorkspace &outputWS, const std::vector<double> &verticalAxis) {
-  const auto &inY = inputWS->y(i);
+template <typename Accumulator>
+void rebinToOutputImpl(const Quadrilateral &inputQ, const MatrixWorkspace &inputWS, const size_t i, const size_t j,
+                       const std::vector<double> &X, const std::vector<double> &verticalAxis,
+                       Accumulator &&accumulate) {
+  const auto &inY = inputWS.y(i);
   // Check once whether the signal
   if (std::isnan(inY[j])) {
     return;
   }
 
-  const auto &X = outputWS.x(0).rawData();
   size_t qstart(0), qend(verticalAxis.size() - 1), x_start(0), x_end(X.size() - 1);
   if (!getIntersectionRegion(X, verticalAxis, inputQ, qstart, qend, x_start, x_end))
     return;
 
-  const auto &inE = inputWS->e(i);
+  const auto &inE = inputWS.e(i);
+  const bool isDistribution = inputWS.isDistribution();
+  const double inputQArea = inputQ.area();
+  if (getQuadrilateralType(inputQ) == QuadrilateralType::Rectangle) {
+    // Rectangular input and output bins overlap in rectangles, so there is
+    // no need for general polygon clipping
+    const auto widths = overlapLengths(X, inputQ.minX(), inputQ.maxX(), x_start, x_end);
+    const auto heights = overlapLengths(verticalAxis, inputQ.minY(), inputQ.maxY(), qstart, qend);
+    for (size_t y = qstart; y < qend; ++y) {
+      const double height = heights[y - qstart];
+      if (height == 0.)
+        continue;
+      for (size_t xi = x_start; xi < x_end; ++xi) {
+        const double width = widths[xi - x_start];
+        if (width == 0.)
+          continue;
+        const double weight = height * width / inputQArea;
+        double yValue = inY[j] * weight;
+        double eValue = inE[j];
+        if (isDistribution) {
+          yValue *= width;
+          eValue *= width;
+        }
+        accumulate(y, xi, yValue, eValue * eValue * weight);
+      }
+    }
+    return;
+  }
+
   // It seems to be more efficient to construct this once and clear it before
   // each calculation in the loop
   ConvexPolygon intersectOverlap;
@@ -529,56 +577,52 @@ void rebinToOutput(const Quadrilateral &inputQ, const MatrixWorkspace_const_sptr
         if (overlapArea == 0.) {
           continue;
         }
-        const double weight = overlapArea / inputQ.area();
+        const double weight = overlapArea / inputQArea;
         double yValue = inY[j];
         yValue *= weight;
         double eValue = inE[j];
-        if (inputWS->isDistribution()) {
+        if (isDistribution) {
           const double overlapWidth = intersectOverlap.maxX() - intersectOverlap.minX();
           yValue *= overlapWidth;
           eValue *= overlapWidth;
         }
         eValue = eValue * eValue * weight;
-        PARALLEL_CRITICAL(overlap_sum) {
-          // The mutable calls must be in the critical section
-          // so that any calls from omp sections can write to the
-          // output workspace safely
-          outputWS.mutableY(y)[xi] += yValue;
-          outputWS.mutableE(y)[xi] += eValue;
-        }
+        accumulate(y, xi, yValue, eValue);
       }
     }
   }
 }
 
 /**
- * Rebin the input quadrilateral to the output grid
+ * Rebin the input quadrilateral to an output grid tracking the fractional
+ * area of each output bin, passing each overlap to the given accumulator.
  * The quadrilateral must have a CLOCKWISE winding.
  * @param inputQ The input polygon (Polygon winding must be clockwise)
  * @param inputWS The input workspace containing the input intensity values
- * @param i The indexiin the vertical axis direction that inputQ references
+ * @param i The index in the vertical axis direction that inputQ references
  * @param j The index in the horizontal axis direction that inputQ references
- * @param outputWS A pointer to the output workspace that accumulates the data
- *        Note that the error array of the output workspace contains the
- *        **variance** and not the errors (standard deviations).
+ * @param X A vector containing the output horizontal axis bin boundaries
  * @param verticalAxis A vector containing the output vertical axis bin
  * boundaries
  * @param inputRB A pointer, of RebinnedOutput type, to the input workspace.
  * It is used to take into account the input area fractions when calcuting
  * the final output fractions.
  * This can be null to indicate that the input was a standard 2D workspace.
+ * @param accumulate Called with (wsIndex, binIndex, signal, variance,
+ * fraction) for each output bin overlapping inputQ. The variance is
+ * accumulated in place of the error.
  */
-void rebinToFractionalOutput(const Quadrilateral &inputQ, const MatrixWorkspace_const_sptr &inputWS, const size_t i,
-                             const size_t j, RebinnedOutput &outputWS, const std::vector<double> &verticalAxis,
-                             const RebinnedOutput_const_sptr &inputRB) {
-  const auto &inX = inputWS->binEdges(i);
-  const auto &inY = inputWS->y(i);
-  const auto &inE = inputWS->e(i);
+template <typename Accumulator>
+void rebinToFractionalOutputImpl(const Quadrilateral &inputQ, const MatrixWorkspace &inputWS, const size_t i,
+                                 const size_t j, const std::vector<double> &X, const std::vector<double> &verticalAxis,
+                                 const RebinnedOutput_const_sptr &inputRB, Accumulator &&accumulate) {
+  const auto &inX = inputWS.binEdges(i);
+  const auto &inY = inputWS.y(i);
+  const auto &inE = inputWS.e(i);
   double signal = inY[j];
   if (std::isnan(signal))
     return;
 
-  const auto &X = outputWS.x(0).rawData();
   size_t qstart(0), qend(verticalAxis.size() - 1), x_start(0), x_end(X.size() - 1);
   if (!getIntersectionRegion(X, verticalAxis, inputQ, qstart, qend, x_start, x_end))
     return;
@@ -589,7 +633,7 @@ void rebinToFractionalOutput(const Quadrilateral &inputQ, const MatrixWorkspace_
   // This wreaks havoc on the data.
   double error = inE[j];
   double inputWeight = 1.;
-  if (inputWS->isDistribution() && !inputRB) {
+  if (inputWS.isDistribution() && !inputRB) {
     const double overlapWidth = inX[j + 1] - inX[j];
     signal *= overlapWidth;
     error *= overlapWidth;
@@ -633,13 +677,211 @@ void rebinToFractionalOutput(const Quadrilateral &inputQ, const MatrixWorkspace_
       continue;
     }
     const double weight = ai.weight / inputQArea;
-    PARALLEL_CRITICAL(overlap) {
-      // The mutable calls must be in the critical section
-      // so that any calls from omp sections can write to the
-      // output workspace safely
-      outputWS.mutableY(ai.wsIndex)[ai.binIndex] += signal * weight;
-      outputWS.mutableE(ai.wsIndex)[ai.binIndex] += variance * weight;
-      outputWS.dataF(ai.wsIndex)[ai.binIndex] += weight * inputWeight;
+    accumulate(ai.wsIndex, ai.binIndex, signal * weight, variance * weight, weight * inputWeight);
+  }
+}
+} // namespace
+
+/**
+ * Rebin the input quadrilateral to the output grid.
+ * The quadrilateral must have a CLOCKWISE winding.
+ * @param inputQ The input polygon (Polygon winding must be Clockwise)
+ * @param inputWS The input workspace containing the input intensity values
+ * @param i The index in the vertical axis direction that inputQ references
+ * @param j The index in the horizontal axis direction that inputQ references
+ * @param outputWS A pointer to the output workspace that accumulates the data
+ * @param verticalAxis A vector containing the output vertical axis bin
+ * boundaries
+ */
+void rebinToOutput(const Quadrilateral &inputQ, const MatrixWorkspace_const_sptr &inputWS, const size_t i,
+                   const size_t j, MatrixWorkspace &outputWS, const std::vector<double> &verticalAxis) {
+  rebinToOutputImpl(inputQ, *inputWS, i, j, outputWS.x(0).rawData(), verticalAxis,
+                    [&outputWS](const size_t wsIndex, const size_t binIndex, const double signal,
+                                const double variance) {
+                      PARALLEL_CRITICAL(overlap_sum) {
+                        // The mutable calls must be in the critical section
+                        // so that any calls from omp sections can write to the
+                        // output workspace safely
+                        outputWS.mutableY(wsIndex)[binIndex] += signal;
+                        outputWS.mutableE(wsIndex)[binIndex] += variance;
+                      }
+                    });
+}
+
+/**
+ * Rebin the input quadrilateral to the calling thread's partial output grid.
+ * Unlike writing to the output workspace directly this needs no locking.
+ * The quadrilateral must have a CLOCKWISE winding.
+ * @param inputQ The input polygon (Polygon winding must be Clockwise)
+ * @param inputWS The input workspace containing the input intensity values
+ * @param i The index in the vertical axis direction that inputQ references
+ * @param j The index in the horizontal axis direction that inputQ references
+ * @param outputs The partial output grids that accumulate the data
+ * @param verticalAxis A vector containing the output vertical axis bin
+ * boundaries
+ */
+void rebinToOutput(const Quadrilateral &inputQ, const MatrixWorkspace_const_sptr &inputWS, const size_t i,
+                   const size_t j, PartialOutputs &outputs, const std::vector<double> &verticalAxis) {
+  if (!outputs.perThread()) {
+    rebinToOutput(inputQ, inputWS, i, j, outputs.outputWS(), verticalAxis);
+    return;
+  }
+  auto &grid = outputs.local();
+  const size_t nBins = outputs.blocksize();
+  rebinToOutputImpl(
+      inputQ, *inputWS, i, j, outputs.xAxis(), verticalAxis,
+      [&grid, nBins](const size_t wsIndex, const size_t binIndex, const double signal, const double variance) {
+        grid.signal[wsIndex * nBins + binIndex] += signal;
+        grid.variance[wsIndex * nBins + binIndex] += variance;
+      });
+}
+
+/**
+ * Rebin the input quadrilateral to the output grid
+ * The quadrilateral must have a CLOCKWISE winding.
+ * @param inputQ The input polygon (Polygon winding must be clockwise)
+ * @param inputWS The input workspace containing the input intensity values
+ * @param i The indexiin the vertical axis direction that inputQ references
+ * @param j The index in the horizontal axis direction that inputQ references
+ * @param outputWS A pointer to the output workspace that accumulates the data
+ *        Note that the error array of the output workspace contains the
+ *        **variance** and not the errors (standard deviations).
+ * @param verticalAxis A vector containing the output vertical axis bin
+ * boundaries
+ * @param inputRB A pointer, of RebinnedOutput type, to the input workspace.
+ * It is used to take into account the input area fractions when calcuting
+ * the final output fractions.
+ * This can be null to indicate that the input was a standard 2D workspace.
+ */
+void rebinToFractionalOutput(const Quadrilateral &inputQ, const MatrixWorkspace_const_sptr &inputWS, const size_t i,
+                             const size_t j, RebinnedOutput &outputWS, const std::vector<double> &verticalAxis,
+                             const RebinnedOutput_const_sptr &inputRB) {
+  rebinToFractionalOutputImpl(inputQ, *inputWS, i, j, outputWS.x(0).rawData(), verticalAxis, inputRB,
+                              [&outputWS](const size_t wsIndex, const size_t binIndex, const double signal,
+                                          const double variance, const double fraction) {
+                                PARALLEL_CRITICAL(overlap) {
+                                  // The mutable calls must be in the critical section
+                                  // so that any calls from omp sections can write to the
+                                  // output workspace safely
+                                  outputWS.mutableY(wsIndex)[binIndex] += signal;
+                                  outputWS.mutableE(wsIndex)[binIndex] += variance;
+                                  outputWS.dataF(wsIndex)[binIndex] += fraction;
+                                }
+                              });
+}
+
+/**
+ * Rebin the input quadrilateral to the calling thread's partial output grid
+ * tracking fractional areas. Unlike writing to the output workspace directly
+ * this needs no locking. The quadrilateral must have a CLOCKWISE winding.
+ * @param inputQ The input polygon (Polygon winding must be clockwise)
+ * @param inputWS The input workspace containing the input intensity values
+ * @param i The index in the vertical axis direction that inputQ references
+ * @param j The index in the horizontal axis direction that inputQ references
+ * @param outputs The partial output grids, created from a RebinnedOutput
+ *        workspace, that accumulate the data. The variance is accumulated in
+ *        place of the error.
+ * @param verticalAxis A vector containing the output vertical axis bin
+ * boundaries
+ * @param inputRB A pointer, of RebinnedOutput type, to the input workspace.
+ * This can be null to indicate that the input was a standard 2D workspace.
+ */
+void rebinToFractionalOutput(const Quadrilateral &inputQ, const MatrixWorkspace_const_sptr &inputWS, const size_t i,
+                             const size_t j, PartialOutputs &outputs, const std::vector<double> &verticalAxis,
+                             const RebinnedOutput_const_sptr &inputRB) {
+  if (!outputs.perThread()) {
+    auto *outputRB = dynamic_cast<RebinnedOutput *>(&outputs.outputWS());
+    if (!outputRB)
+      throw std::invalid_argument("Fractional rebinning requires partial outputs created from a RebinnedOutput");
+    rebinToFractionalOutput(inputQ, inputWS, i, j, *outputRB, verticalAxis, inputRB);
+    return;
+  }
+  auto &grid = outputs.local();
+  if (grid.fraction.empty())
+    throw std::invalid_argument("Fractional rebinning requires partial outputs created from a RebinnedOutput");
+  const size_t nBins = outputs.blocksize();
+  rebinToFractionalOutputImpl(inputQ, *inputWS, i, j, outputs.xAxis(), verticalAxis, inputRB,
+                              [&grid, nBins](const size_t wsIndex, const size_t binIndex, const double signal,
+                                             const double variance, const double fraction) {
+                                const size_t index = wsIndex * nBins + binIndex;
+                                grid.signal[index] += signal;
+                                grid.variance[index] += variance;
+                                grid.fraction[index] += fraction;
+                              });
+}
+
+/**
+ * @param outputWS The workspace the partial grids will be added to. Its
+ * fractions are accumulated too if it is a RebinnedOutput.
+ * @param memoryLimit The most memory, in bytes, the grids of all threads may
+ * take together. Above it the overlaps are added to outputWS directly.
+ */
+PartialOutputs::PartialOutputs(MatrixWorkspace &outputWS, const size_t memoryLimit)
+    : m_outputWS(outputWS), m_nHistograms(outputWS.getNumberHistograms()), m_nBins(outputWS.blocksize()),
+      m_withFractions(dynamic_cast<const RebinnedOutput *>(&outputWS) != nullptr), m_perThread(false),
+      m_xAxis(outputWS.x(0).rawData()) {
+  const auto nThreads = static_cast<size_t>(PARALLEL_GET_MAX_THREADS);
+  const size_t gridSize = m_nHistograms * m_nBins * (m_withFractions ? 3 : 2) * sizeof(double);
+  m_perThread = nThreads > 1 && gridSize <= memoryLimit / nThreads;
+  if (m_perThread)
+    m_grids.resize(nThreads);
+}
+
+/**
+ * The default memory limit for the grids of all threads: half of the memory
+ * that is available now.
+ * @return The limit in bytes
+ */
+size_t PartialOutputs::defaultMemoryLimit() {
+  const Kernel::MemoryStats memoryStats;
+  return memoryStats.availMem() / 2 * 1024; // availMem is in kiB
+}
+
+/**
+ * Get the grid of the calling thread. The grids are allocated when a thread
+ * first asks for one, so threads that do no work cost no memory.
+ * @return The calling thread's grid
+ */
+PartialOutputs::Grid &PartialOutputs::local() {
+  if (!m_perThread)
+    throw std::logic_error("The output is too large for a grid per thread, write to the output workspace instead");
+  auto &grid = m_grids[PARALLEL_THREAD_NUMBER];
+  if (grid.signal.empty()) {
+    const size_t size = m_nHistograms * m_nBins;
+    grid.signal.assign(size, 0.);
+    grid.variance.assign(size, 0.);
+    if (m_withFractions)
+      grid.fraction.assign(size, 0.);
+  }
+  return grid;
+}
+
+/**
+ * Add the partial grids of all threads to the output workspace
+ * @param outputWS The workspace the grids were created for
+ */
+void PartialOutputs::addTo(MatrixWorkspace &outputWS) const {
+  if (m_grids.empty())
+    return; // the overlaps were added to the output workspace directly
+  auto *rebinnedWS = dynamic_cast<RebinnedOutput *>(&outputWS);
+  PARALLEL_FOR_IF(Kernel::threadSafe(outputWS))
+  for (int64_t i = 0; i < static_cast<int64_t>(m_nHistograms); ++i) {
+    auto &outputY = outputWS.mutableY(i);
+    auto &outputE = outputWS.mutableE(i);
+    const size_t offset = static_cast<size_t>(i) * m_nBins;
+    for (const auto &grid : m_grids) {
+      if (grid.signal.empty())
+        continue;
+      for (size_t j = 0; j < m_nBins; ++j) {
+        outputY[j] += grid.signal[offset + j];
+        outputE[j] += grid.variance[offset + j];
+      }
+      if (rebinnedWS && !grid.fraction.empty()) {
+        auto &outputF = rebinnedWS->dataF(i);
+        for (size_t j = 0; j < m_nBins; ++j) {
+          outputF[j] += grid.fraction[offset + j];
+        }
+      }
     }
   }
 }
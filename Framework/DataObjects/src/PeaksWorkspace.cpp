@@ -19,7 +19,10 @@
 #include <nexus/NeXusException.hpp>
 // clang-format on
 
+#include <algorithm>
 #include <cmath>
+#include <iterator>
+#include <numeric>
 
 using namespace Mantid::API;
 using namespace Mantid::Kernel;
@@ -53,52 +56,18 @@ PeaksWorkspace::PeaksWorkspace(const PeaksWorkspace &other)
   setNumberOfDetectorGroups(0);
 }
 
-/** Comparator class for sorting peaks by one or more criteria
+namespace {
+/** The values of one sort criterion for every peak, held contiguously so
+ * that sorting compares plain values rather than looking them up by column
+ * name on each comparison.
  */
-class PeakComparator {
-public:
-  using ColumnAndDirection = PeaksWorkspace::ColumnAndDirection;
-  std::vector<ColumnAndDirection> &criteria;
-
-  /** Constructor for the comparator for sorting peaks
-   * @param criteria : a vector with a list of pairs: column name, bool;
-   *        where bool = true for ascending, false for descending sort.
-   */
-  explicit PeakComparator(std::vector<ColumnAndDirection> &criteria) : criteria(criteria) {}
-
-  /** Compare two peaks using the stored criteria */
-  inline bool operator()(const Peak &a, const Peak &b) {
-    for (const auto &name : criteria) {
-      const auto &col = name.first;
-      const bool ascending = name.second;
-      bool lessThan = false;
-      if (col == "BankName") {
-        // If this criterion is equal, move on to the next one
-        const std::string valA = a.getBankName();
-        const std::string valB = b.getBankName();
-        // Move on to lesser criterion if equal
-        if (valA == valB)
-          continue;
-        lessThan = (valA < valB);
-      } else {
-        // General double comparison
-        const double valA = a.getValueByColName(col);
-        const double valB = b.getValueByColName(col);
-        // Move on to lesser criterion if equal
-        if (valA == valB)
-          continue;
-        lessThan = (valA < valB);
-      }
-      // Flip the sign of comparison if descending.
-      if (ascending)
-        return lessThan;
-      else
-        return !lessThan;
-    }
-    // If you reach here, all criteria were ==; so not <, so return false
-    return false;
-  }
+struct SortColumn {
+  bool ascending;
+  bool byBankName;
+  std::vector<double> values;
+  std::vector<std::string> bankNames;
 };
+} // namespace
 
 //---------------------------------------------------------------------------------------------
 /** Sort the peaks by one or more criteria
@@ -109,8 +78,56 @@ public:
  *equal, etc.
  */
 void PeaksWorkspace::sort(std::vector<ColumnAndDirection> &criteria) {
-  PeakComparator comparator(criteria);
-  std::stable_sort(m_peaks.begin(), m_peaks.end(), comparator);
+  const size_t numPeaks = m_peaks.size();
+  std::vector<SortColumn> columns;
+  columns.reserve(criteria.size());
+  for (const auto &[name, ascending] : criteria) {
+    SortColumn column{ascending, name == "BankName", {}, {}};
+    if (column.byBankName) {
+      column.bankNames.reserve(numPeaks);
+      std::transform(m_peaks.cbegin(), m_peaks.cend(), std::back_inserter(column.bankNames),
+                     [](const Peak &peak) { return peak.getBankName(); });
+    } else {
+      column.values.reserve(numPeaks);
+      std::transform(m_peaks.cbegin(), m_peaks.cend(), std::back_inserter(column.values),
+                     [&name](const Peak &peak) { return peak.getValueByColName(name); });
+    }
+    columns.emplace_back(std::move(column));
+  }
+
+  const auto lessThan = [&columns](const size_t a, const size_t b) {
+    for (const auto &column : columns) {
+      bool less = false;
+      if (column.byBankName) {
+        const auto &valA = column.bankNames[a];
+        const auto &valB = column.bankNames[b];
+        // Move on to lesser criterion if equal
+        if (valA == valB)
+          continue;
+        less = (valA < valB);
+      } else {
+        const double valA = column.values[a];
+        const double valB = column.values[b];
+        if (valA == valB)
+          continue;
+        less = (valA < valB);
+      }
+      // Flip the sign of comparison if descending.
+      return column.ascending ? less : !less;
+    }
+    // If you reach here, all criteria were ==; so not <, so return false
+    return false;
+  };
+  std::vector<size_t> order(numPeaks);
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), lessThan);
+
+  // Move each peak to its sorted position once
+  std::vector<Peak> sorted;
+  sorted.reserve(numPeaks);
+  for (const auto index : order)
+    sorted.emplace_back(std::move(m_peaks[index]));
+  m_peaks.swap(sorted);
 }
 
 //---------------------------------------------------------------------------------------------
@@ -141,12 +158,13 @@ void PeaksWorkspace::removePeaks(std::vector<int> badPeaks) {
   if (badPeaks.empty())
     return;
   // if index of peak is in badPeaks remove
-  int ip = -1;
-  auto it = std::remove_if(m_peaks.begin(), m_peaks.end(), [&ip, badPeaks](Peak &pk) {
-    (void)pk;
-    ip++;
-    return std::any_of(badPeaks.cbegin(), badPeaks.cend(), [ip](int badPeak) { return badPeak == ip; });
-  });
+  std::vector<bool> isBad(m_peaks.size(), false);
+  for (const auto badPeak : badPeaks) {
+    if (badPeak >= 0 && static_cast<size_t>(badPeak) < isBad.size())
+      isBad[badPeak] = true;
+  }
+  size_t ip = 0;
+  auto it = std::remove_if(m_peaks.begin(), m_peaks.end(), [&ip, &isBad](const Peak &) { return isBad[ip++]; });
   m_peaks.erase(it, m_peaks.end());
 }
 
@@ -160,6 +178,7 @@ void PeaksWorkspace::addPeak(const Geometry::IPeak &ipeak) {
   } else {
     m_peaks.emplace_back(Peak(ipeak));
   }
+  shareGoniometerWithPrevious();
 }
 
 //---------------------------------------------------------------------------------------------
@@ -176,7 +195,19 @@ void PeaksWorkspace::addPeak(const V3D &position, const SpecialCoordinateSystem
 /** Add a peak to the list
  * @param peak :: Peak object to add (move) into this.
  */
-void PeaksWorkspace::addPeak(Peak &&peak) { m_peaks.emplace_back(peak); }
+void PeaksWorkspace::addPeak(Peak &&peak) {
+  m_peaks.emplace_back(std::move(peak));
+  shareGoniometerWithPrevious();
+}
+
+//---------------------------------------------------------------------------------------------
+/** Peaks are usually added a run at a time, so the newest peak shares its
+ * goniometer matrices with the one before it where they are identical.
+ */
+void PeaksWorkspace::shareGoniometerWithPrevious() {
+  if (m_peaks.size() > 1)
+    m_peaks.back().shareGoniometerMatrix(m_peaks[m_peaks.size() - 2]);
+}
 
 //---------------------------------------------------------------------------------------------
 /** Return a reference to the Peak
@@ -679,7 +710,7 @@ void PeaksWorkspace::saveNexus(::NeXus::File *file) const {
   // Populate column vectors from Peak Workspace
   size_t maxShapeJSONLength = 0;
   for (size_t i = 0; i < np; i++) {
-    Peak p = m_peaks[i];
+    const Peak &p = m_peaks[i];
     detectorID[i] = p.getDetectorID();
     H[i] = p.getH();
     K[i] = p.getK();
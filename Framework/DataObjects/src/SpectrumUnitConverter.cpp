@@ -0,0 +1,94 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2024 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidDataObjects/SpectrumUnitConverter.h"
+#include "MantidAPI/Run.h"
+#include "MantidAPI/SpectrumInfo.h"
+#include "MantidDataObjects/EventWorkspace.h"
+#include "MantidGeometry/Instrument.h"
+#include "MantidKernel/MultiThreaded.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace Mantid::DataObjects {
+
+using namespace Kernel;
+
+namespace {
+/// Whether the instrument of the workspace asks for signed two theta
+bool showSignedTheta(const API::MatrixWorkspace &workspace) {
+  const auto parameters = workspace.getInstrument()->getStringParameter("show-signed-theta");
+  return std::find(parameters.cbegin(), parameters.cend(), "Always") != parameters.cend();
+}
+} // namespace
+
+/**
+ * @param workspace :: The workspace whose spectra are converted. Its axis unit is not changed.
+ * @param fromUnit :: The current unit of the X values
+ * @param toUnit :: The unit to convert to
+ * @param emode :: The energy mode
+ * @param efixed :: The fixed energy, EMPTY_DBL() to use the one of each detector
+ */
+SpectrumUnitConverter::SpectrumUnitConverter(API::MatrixWorkspace &workspace, const Unit &fromUnit,
+                                             const Unit &toUnit, const DeltaEMode::Type emode, const double efixed)
+    : m_workspace(workspace), m_eventWorkspace(dynamic_cast<EventWorkspace *>(&workspace)),
+      m_spectrumInfo(workspace.mutableSpectrumInfo()), m_l1(m_spectrumInfo.l1()), m_emode(emode), m_efixed(efixed),
+      m_signedTheta(showSignedTheta(workspace)), m_fromUnit(fromUnit.clone()), m_toUnit(toUnit.clone()),
+      m_threadFromUnits(static_cast<size_t>(PARALLEL_GET_MAX_THREADS)),
+      m_threadToUnits(static_cast<size_t>(PARALLEL_GET_MAX_THREADS)) {
+  for (size_t thread = 0; thread < m_threadFromUnits.size(); ++thread) {
+    m_threadFromUnits[thread].reset(fromUnit.clone());
+    m_threadToUnits[thread].reset(toUnit.clone());
+  }
+}
+
+/**
+ * Convert the X values, and the events, of one spectrum.
+ * @param index :: The workspace index of the spectrum
+ * @return False if the spectrum has no usable detector and was cleared and masked instead
+ */
+bool SpectrumUnitConverter::convert(const size_t index) {
+  const auto thread = static_cast<size_t>(PARALLEL_THREAD_NUMBER);
+  auto &localFromUnit = *m_threadFromUnits[thread];
+  auto &localToUnit = *m_threadToUnits[thread];
+
+  /// @todo Don't yet consider hold-off (delta)
+  UnitParametersMap pmap = {{UnitParams::delta, 0.0}};
+  if (m_efixed != EMPTY_DBL()) {
+    pmap[UnitParams::efixed] = m_efixed;
+  }
+  m_spectrumInfo.getDetectorValues(*m_fromUnit, *m_toUnit, m_emode, m_signedTheta, static_cast<int64_t>(index), pmap);
+  try {
+    // Not doing anything with the Y vector in to/fromTOF yet, so just pass an empty vector
+    std::vector<double> emptyVec;
+    localFromUnit.toTOF(m_workspace.dataX(index), emptyVec, m_l1, m_emode, pmap);
+    localToUnit.fromTOF(m_workspace.dataX(index), emptyVec, m_l1, m_emode, pmap);
+    if (m_eventWorkspace)
+      m_eventWorkspace->getSpectrum(index).convertUnitsViaTof(&localFromUnit, &localToUnit);
+  } catch (std::runtime_error &) {
+    // Get to here if exception thrown in unit conversion eg when calculating distance to detector. Since that is
+    // usually because there are no attached detectors, clearing the data is all that is left to do.
+    ++m_numberOfFailedSpectra;
+    m_workspace.getSpectrum(index).clearData();
+    if (m_spectrumInfo.hasDetectors(index))
+      m_spectrumInfo.setMasked(index, true);
+    return false;
+  }
+  return true;
+}
+
+/**
+ * Record the energy mode the units of the workspace were converted with.
+ * @param workspace :: The converted workspace
+ * @param emode :: The energy mode
+ */
+void SpectrumUnitConverter::storeEMode(API::MatrixWorkspace &workspace, const DeltaEMode::Type emode) {
+  const bool overwrite(true);
+  workspace.mutableRun().addProperty("deltaE-mode", DeltaEMode::asString(emode), overwrite);
+}
+
+} // namespace Mantid::DataObjects
@@ -11,6 +11,8 @@
 #include "MantidKernel/SplittingInterval.h"
 #include "MantidKernel/TimeROI.h"
 
+#include <utility>
+
 namespace Mantid {
 using API::EventType;
 using Kernel::SplittingInterval;
@@ -542,10 +544,10 @@ void TimeSplitter::splitEventList(const EventList &events, std::map<int, EventLi
   // split the events
   switch (events.getEventType()) {
   case EventType::TOF:
-    this->splitEventVec(events.getEvents(), partials, pulseTof, tofCorrect, factor, shift);
+    this->splitEventVec(std::as_const(events).getEvents(), partials, pulseTof, tofCorrect, factor, shift);
     break;
   case EventType::WEIGHTED:
-    this->splitEventVec(events.getWeightedEvents(), partials, pulseTof, tofCorrect, factor, shift);
+    this->splitEventVec(std::as_const(events).getWeightedEvents(), partials, pulseTof, tofCorrect, factor, shift);
     break;
   default:
     throw std::runtime_error("Unhandled event type");
@@ -27,12 +27,8 @@ DECLARE_WORKSPACE(Workspace2D)
 /// Constructor
 Workspace2D::Workspace2D() : HistoWorkspace() {}
 
-Workspace2D::Workspace2D(const Workspace2D &other) : HistoWorkspace(other), m_monitorList(other.m_monitorList) {
-  data.resize(other.data.size());
-  for (size_t i = 0; i < data.size(); ++i) {
-    data[i] = std::make_unique<Histogram1D>(*(other.data[i]));
-  }
-}
+Workspace2D::Workspace2D(const Workspace2D &other)
+    : HistoWorkspace(other), m_monitorList(other.m_monitorList), data(other.data) {}
 
 /// Destructor
 Workspace2D::~Workspace2D() = default;
@@ -50,8 +46,6 @@ Workspace2D::~Workspace2D() = default;
  * (must all be the same)
  */
 void Workspace2D::init(const std::size_t &NVectors, const std::size_t &XLength, const std::size_t &YLength) {
-  data.resize(NVectors);
-
   auto x = Kernel::make_cow<HistogramData::HistogramX>(XLength, HistogramData::LinearGenerator(1.0, 1.0));
   HistogramData::Counts y(YLength);
   HistogramData::CountStandardDeviations e(YLength);
@@ -59,10 +53,12 @@ void Workspace2D::init(const std::size_t &NVectors, const std::size_t &XLength,
   spec.setX(x);
   spec.setCounts(y);
   spec.setCountStandardDeviations(e);
+  // All spectra share the X, Y and E data of the initial spectrum until they
+  // are modified
+  data.assign(NVectors, spec);
   for (size_t i = 0; i < data.size(); i++) {
-    data[i] = std::make_unique<Histogram1D>(spec);
     // Default spectrum number = starts at 1, for workspace index 0.
-    data[i]->setSpectrumNo(specnum_t(i + 1));
+    data[i].setSpectrumNo(specnum_t(i + 1));
   }
 
   // Add axes that reference the data
@@ -72,8 +68,6 @@ void Workspace2D::init(const std::size_t &NVectors, const std::size_t &XLength,
 }
 
 void Workspace2D::init(const HistogramData::Histogram &histogram) {
-  data.resize(numberOfDetectorGroups());
-
   HistogramData::Histogram initializedHistogram(histogram);
   if (!histogram.sharedY()) {
     if (histogram.yMode() == HistogramData::Histogram::YMode::Frequencies) {
@@ -87,8 +81,7 @@ void Workspace2D::init(const HistogramData::Histogram &histogram) {
 
   Histogram1D spec(initializedHistogram.xMode(), initializedHistogram.yMode());
   spec.setHistogram(initializedHistogram);
-  std::transform(data.begin(), data.end(), data.begin(),
-                 [&spec](const auto &) { return std::move(std::make_unique<Histogram1D>(spec)); });
+  data.assign(numberOfDetectorGroups(), spec);
 
   // Add axes that reference the data
   m_axes.resize(2);
@@ -103,9 +96,9 @@ bool Workspace2D::isRaggedWorkspace() const {
     throw std::runtime_error("There is no data in the Workspace2D, "
                              "therefore cannot determine if it is ragged.");
   } else {
-    const auto numberOfBins = data[0]->size();
+    const auto numberOfBins = data[0].size();
     return std::any_of(data.cbegin(), data.cend(),
-                       [&numberOfBins](const auto &histogram) { return numberOfBins != histogram->size(); });
+                       [&numberOfBins](const auto &histogram) { return numberOfBins != histogram.size(); });
   }
 }
 
@@ -118,7 +111,7 @@ size_t Workspace2D::getNumberHistograms() const { return getHistogramNumberHelpe
 size_t Workspace2D::size() const {
   return std::accumulate(
       data.begin(), data.end(), static_cast<size_t>(0),
-      [](const size_t value, const std::unique_ptr<Histogram1D> &histo) { return value + histo->size(); });
+      [](const size_t value, const Histogram1D &histo) { return value + histo.size(); });
 }
 
 /// get the size of each vector
@@ -126,9 +119,9 @@ size_t Workspace2D::blocksize() const {
   if (data.empty()) {
     return 0;
   } else {
-    size_t numBins = data[0]->size();
+    size_t numBins = data[0].size();
     const auto it =
-        std::find_if_not(data.cbegin(), data.cend(), [numBins](const auto &iter) { return numBins == iter->size(); });
+        std::find_if_not(data.cbegin(), data.cend(), [numBins](const auto &iter) { return numBins == iter.size(); });
     if (it != data.cend())
       throw std::length_error("blocksize undefined because size of histograms is not equal");
     return numBins;
@@ -141,7 +134,7 @@ size_t Workspace2D::blocksize() const {
  */
 std::size_t Workspace2D::getNumberBins(const std::size_t &index) const {
   if (index < data.size())
-    return data[index]->size();
+    return data[index].size();
 
   throw std::invalid_argument("Could not find number of bins in a histogram at index " + std::to_string(index) +
                               ": index is too large.");
@@ -154,9 +147,9 @@ std::size_t Workspace2D::getMaxNumberBins() const {
   if (data.empty()) {
     return 0;
   } else {
-    auto maxNumberOfBins = data[0]->size();
+    auto maxNumberOfBins = data[0].size();
     for (const auto &iter : data) {
-      const auto numberOfBins = iter->size();
+      const auto numberOfBins = iter.size();
       if (numberOfBins > maxNumberOfBins)
         maxNumberOfBins = numberOfBins;
     }
@@ -243,8 +236,8 @@ void Workspace2D::setImageYAndE(const API::MantidImage &imageY, const API::Manti
       size_t spec = start + static_cast<size_t>(i) * width;
       auto pE = rowE.begin();
       for (auto pY = rowY.begin(); pY != rowY.end() && pE != rowE.end(); ++pY, ++pE, ++spec) {
-        data[spec]->dataY()[0] = *pY;
-        data[spec]->dataE()[0] = *pE;
+        data[spec].dataY()[0] = *pY;
+        data[spec].dataE()[0] = *pE;
       }
     }
   } else {
@@ -268,18 +261,18 @@ void Workspace2D::setImageYAndE(const API::MantidImage &imageY, const API::Manti
 
       const auto &rowY = imageY[i];
       const auto &rowE = imageE[i];
-      data[i]->dataY() = rowY;
-      data[i]->dataE() = rowE;
+      data[i].dataY() = rowY;
+      data[i].dataE() = rowE;
     }
     // X values. Set first spectrum and copy/propagate that one to all the other
     // spectra
     PARALLEL_FOR_IF(parallelExecution)
     for (int i = 0; i < static_cast<int>(width) + 1; ++i) {
-      data[0]->dataX()[i] = i * scale_1;
+      data[0].dataX()[i] = i * scale_1;
     }
     PARALLEL_FOR_IF(parallelExecution)
     for (int i = 1; i < static_cast<int>(height); ++i) {
-      data[i]->setX(data[0]->ptrX());
+      data[i].setX(data[0].ptrX());
     }
   }
 }
@@ -298,7 +291,7 @@ const Histogram1D &Workspace2D::getSpectrum(const size_t index) const {
     ss << "Workspace2D::getSpectrum, histogram number " << index << " out of range " << data.size();
     throw std::range_error(ss.str());
   }
-  return *data[index];
+  return data[index];
 }
 
 //--------------------------------------------------------------------------------------------
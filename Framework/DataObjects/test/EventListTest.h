@@ -21,6 +21,7 @@
 
 #include <boost/scoped_ptr.hpp>
 #include <cmath>
+#include <utility>
 
 using namespace Mantid;
 using namespace Mantid::API;
@@ -169,6 +170,62 @@ public:
     TS_ASSERT_EQUALS(target.getWeightedEventsNoTime(), eventList.getWeightedEventsNoTime());
   }
 
+  void test_copy_shares_events_until_modified() {
+    EventList copy(el);
+    const EventList &constCopy = copy;
+    const EventList &constOriginal = el;
+    TS_ASSERT_EQUALS(&constCopy.getEvents(), &constOriginal.getEvents());
+
+    copy += TofEvent(1.0, 2);
+    TS_ASSERT_DIFFERS(&constCopy.getEvents(), &constOriginal.getEvents());
+    TS_ASSERT_EQUALS(copy.getNumberEvents(), 4);
+    TS_ASSERT_EQUALS(el.getNumberEvents(), 3);
+  }
+
+  void test_sorting_a_copy_does_not_change_the_original() {
+    EventList copy(el);
+    copy.sortTof();
+    TS_ASSERT(copy.isSortedByTof());
+    TS_ASSERT(!el.isSortedByTof());
+    TS_ASSERT_EQUALS(copy.getEvent(0).tof(), 3.5);
+    TS_ASSERT_EQUALS(el.getEvent(0).tof(), 100);
+  }
+
+  void test_converting_a_copy_does_not_change_the_original() {
+    EventList copy(el);
+    copy.switchTo(WEIGHTED);
+    copy.multiply(2.0);
+    TS_ASSERT_EQUALS(copy.getEventType(), WEIGHTED);
+    TS_ASSERT_EQUALS(copy.getEvent(0).weight(), 2.0);
+    TS_ASSERT_EQUALS(el.getEventType(), TOF);
+    TS_ASSERT_EQUALS(el.getEvent(0).weight(), 1.0);
+  }
+
+  void test_clearing_a_copy_keeps_the_events_of_the_original() {
+    EventList copy(el);
+    copy.clear();
+    TS_ASSERT(copy.empty());
+    TS_ASSERT_EQUALS(el.getNumberEvents(), 3);
+  }
+
+  void test_empty_lists_share_their_events_until_filled() {
+    const EventList first;
+    EventList second;
+    TS_ASSERT_EQUALS(&first.getEvents(), &std::as_const(second).getEvents());
+
+    second += TofEvent(1.0, 2);
+    TS_ASSERT_EQUALS(second.getNumberEvents(), 1);
+    TS_ASSERT(first.empty());
+  }
+
+  void test_getMemorySize_counts_shared_events_once() {
+    const auto eventsSize = el.getMemorySize() - sizeof(EventList);
+    TS_ASSERT_LESS_THAN(0, eventsSize);
+
+    const EventList copy(el);
+    TS_ASSERT_EQUALS(el.getMemorySize() + copy.getMemorySize(), eventsSize + 2 * sizeof(EventList));
+  }
+
   void test_EventTypeConstructor() {
     EventList tof;
     TS_ASSERT_EQUALS(tof.getEventType(), TOF);
@@ -1325,6 +1382,35 @@ public:
     }
   }
 
+  //-----------------------------------------------------------------------------------------------
+  void test_cropTof_allTypes() {
+    // Go through each possible EventType as the input
+    for (int this_type = 0; this_type < 3; this_type++) {
+      this->fake_uniform_data();
+      el.switchTo(static_cast<EventType>(this_type));
+      const auto order = el.getSortType();
+
+      // Keep 5-10 milliseconds
+      double min = MAX_TOF * 0.25;
+      double max = MAX_TOF * 0.5;
+      el.cropTof(min, max);
+      TS_ASSERT_LESS_THAN(0, el.getNumberEvents());
+      for (std::size_t i = 0; i < el.getNumberEvents(); i++) {
+        TS_ASSERT((el.getEvent(i).tof() >= min) && (el.getEvent(i).tof() <= max));
+      }
+      TS_ASSERT_EQUALS(el.getSortType(), order);
+    }
+  }
+
+  void test_cropTof_keeps_shared_events_when_nothing_is_removed() {
+    this->fake_uniform_data();
+    const EventList copy(el);
+
+    el.cropTof(0., MAX_TOF);
+
+    TS_ASSERT_EQUALS(&std::as_const(el).getEvents(), &copy.getEvents());
+  }
+
   //-----------------------------------------------------------------------------------------------
   void test_maskCondition_allTypes() {
     // Go through each possible EventType as the input
@@ -2912,6 +2998,69 @@ public:
     TS_ASSERT_DELTA(std::reduce(Y.begin(), Y.end()), 10, 1e-8);
   }
 
+  void test_generateHistogramWithoutSorting_TOF() {
+    const auto e = createLinearTestData();
+    run_generateHistogramWithoutSortingTest(e, {0., 0.1, 50., 1.0, 100.}, 1000.);
+    run_generateHistogramWithoutSortingTest(e, {10., 0.5, 20., 0.1, 30., -0.01, 90.}, 800.);
+  }
+
+  void test_generateHistogramWithoutSorting_WEIGHTED() {
+    auto e = createLinearTestData(WEIGHTED);
+    e.multiply(2.0, 0.5);
+    run_generateHistogramWithoutSortingTest(e, {0., 0.1, 50., 1.0, 100.}, 2000.);
+    run_generateHistogramWithoutSortingTest(e, {10., 0.5, 20., 0.1, 30., -0.01, 90.}, 1600.);
+  }
+
+  void test_generateHistogramWithoutSorting_WEIGHTED_NOTIME() {
+    auto e = createLinearTestData();
+    e.switchTo(WEIGHTED_NOTIME);
+    run_generateHistogramWithoutSortingTest(e, {0., 0.1, 50., 1.0, 100.}, 1000.);
+    run_generateHistogramWithoutSortingTest(e, {10., 0.5, 20., 0.1, 30., -0.01, 90.}, 800.);
+  }
+
+  void test_generateHistogramWithoutSorting_events_on_bin_edges() {
+    EventList e;
+    for (const double tof : {4., 0., 1., 2.5, 2., 3.99, -0.5, 4.5})
+      e += TofEvent(tof);
+    e.setSortOrder(UNSORTED);
+    const MantidVec X{0., 1., 1., 2., 4.};
+    MantidVec Y, E;
+
+    e.generateHistogramWithoutSorting(X, Y, E);
+
+    const MantidVec expected{1., 0., 1., 3.};
+    TS_ASSERT_EQUALS(Y, expected);
+    TS_ASSERT_DELTA(E[3], std::sqrt(3.), 1e-12);
+    TS_ASSERT(!e.isSortedByTof());
+  }
+
+  void run_generateHistogramWithoutSortingTest(EventList e, std::vector<double> rebinParams,
+                                               const double expected_total) {
+    MantidVec X, expected_Y, expected_E, Y, E;
+    VectorHelper::createAxisFromRebinParams(rebinParams, X, true);
+
+    TS_ASSERT(!e.isSortedByTof());
+    // set the values of Y to be one so we can check that the values are zeroed out
+    Y.resize(X.size() - 1, 1.);
+
+    // histogram without sorting then compare and check still unsorted
+    e.generateHistogramWithoutSorting(X, Y, E);
+    TS_ASSERT(!e.isSortedByTof());
+
+    // do sorted method to get expected results
+    e.generateHistogram(X, expected_Y, expected_E);
+    TS_ASSERT(e.isSortedByTof());
+
+    TS_ASSERT_EQUALS(expected_Y.size(), Y.size());
+    TS_ASSERT_EQUALS(expected_E.size(), E.size());
+    for (size_t i = 0; i < Y.size(); i++) {
+      TS_ASSERT_DELTA(expected_Y[i], Y[i], 1e-10);
+      TS_ASSERT_DELTA(expected_E[i], E[i], 1e-10);
+    }
+
+    TS_ASSERT_DELTA(std::reduce(Y.begin(), Y.end()), expected_total, 1e-8);
+  }
+
   void run_generateHistogramUnsortedTest(EventList e, std::vector<double> rebinParams,
                                          const double expected_total = 0) {
     MantidVec X, expected_Y, expected_E, Y, E;
@@ -3091,6 +3240,16 @@ public:
     el_sorted_weighted.generateHistogram(coarseX, Y, E);
   }
 
+  void test_histogram_without_sorting_fine() {
+    MantidVec Y, E;
+    el_random.generateHistogramWithoutSorting(fineX, Y, E);
+  }
+
+  void test_histogram_without_sorting_coarse() {
+    MantidVec Y, E;
+    el_random.generateHistogramWithoutSorting(coarseX, Y, E);
+  }
+
   void test_maskTof() {
     TS_ASSERT_EQUALS(el_sorted.getNumberEvents(), 10000000);
     el_sorted.maskTof(25e3, 75e3);
@@ -136,6 +136,21 @@ public:
     TS_ASSERT(el.hasDetectorID(1));
   }
 
+  void test_clone_shares_events_until_modified() {
+    EventWorkspace_sptr cloned(ew->clone());
+    TS_ASSERT_EQUALS(cloned->getNumberEvents(), ew->getNumberEvents());
+    const EventWorkspace &constClone = *cloned;
+    const EventWorkspace &constOriginal = *ew;
+    TS_ASSERT_EQUALS(&constClone.getSpectrum(0).getEvents(), &constOriginal.getSpectrum(0).getEvents());
+
+    const auto numberOfEvents = ew->getSpectrum(0).getNumberEvents();
+    cloned->getSpectrum(0) += TofEvent(1.0, 2);
+    TS_ASSERT_DIFFERS(&constClone.getSpectrum(0).getEvents(), &constOriginal.getSpectrum(0).getEvents());
+    TS_ASSERT_EQUALS(cloned->getSpectrum(0).getNumberEvents(), numberOfEvents + 1);
+    TS_ASSERT_EQUALS(ew->getSpectrum(0).getNumberEvents(), numberOfEvents);
+    TS_ASSERT_EQUALS(&constClone.getSpectrum(1).getEvents(), &constOriginal.getSpectrum(1).getEvents());
+  }
+
   void test_getMemorySize() {
     // Because of the way vectors allocate, we can only know the minimum amount
     // of memory that can be used.
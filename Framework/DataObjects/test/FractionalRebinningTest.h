@@ -0,0 +1,82 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2024 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidDataObjects/FractionalRebinning.h"
+#include "MantidDataObjects/Workspace2D.h"
+#include "MantidFrameworkTestHelpers/WorkspaceCreationHelper.h"
+#include "MantidGeometry/Math/Quadrilateral.h"
+#include "MantidKernel/MultiThreaded.h"
+
+#include <limits>
+
+using namespace Mantid::API;
+using namespace Mantid::DataObjects;
+using Mantid::Geometry::Quadrilateral;
+
+class FractionalRebinningTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static FractionalRebinningTest *createSuite() { return new FractionalRebinningTest(); }
+  static void destroySuite(FractionalRebinningTest *suite) { delete suite; }
+
+  void test_PartialOutputs_without_memory_limit_uses_a_grid_per_thread() {
+    auto outputWS = emptyOutput();
+    FractionalRebinning::PartialOutputs outputs(*outputWS, std::numeric_limits<size_t>::max());
+    TS_ASSERT_EQUALS(outputs.perThread(), PARALLEL_GET_MAX_THREADS > 1)
+    rebinAndCheck(outputs, *outputWS);
+  }
+
+  void test_PartialOutputs_over_memory_limit_writes_to_the_output_workspace() {
+    auto outputWS = emptyOutput();
+    // Not even one grid fits
+    FractionalRebinning::PartialOutputs outputs(*outputWS, 5 * 5 * sizeof(double));
+    TS_ASSERT(!outputs.perThread())
+    TS_ASSERT_THROWS(outputs.local(), const std::logic_error &)
+    rebinAndCheck(outputs, *outputWS);
+  }
+
+private:
+  /// 5x5 bins of width 2, holding no counts
+  Workspace2D_sptr emptyOutput() {
+    auto outputWS = WorkspaceCreationHelper::create2DWorkspaceBinned(5, 5, 0., 2.);
+    for (size_t i = 0; i < outputWS->getNumberHistograms(); ++i) {
+      outputWS->mutableY(i) = 0.;
+      outputWS->mutableE(i) = 0.;
+    }
+    return outputWS;
+  }
+
+  /// Rebin a 10x10 grid of unit bins holding 2 counts each to the 5x5 grid of
+  /// bins of width 2 of outputWS, so that each output bin gets 8 counts
+  void rebinAndCheck(FractionalRebinning::PartialOutputs &outputs, MatrixWorkspace &outputWS) {
+    MatrixWorkspace_const_sptr inputWS = WorkspaceCreationHelper::create2DWorkspaceBinned(10, 10, 0., 1.);
+    const std::vector<double> verticalAxis{0., 2., 4., 6., 8., 10.};
+
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int64_t i = 0; i < 10; ++i) {
+      const auto vlo = static_cast<double>(i);
+      for (size_t j = 0; j < 10; ++j) {
+        const auto x = static_cast<double>(j);
+        FractionalRebinning::rebinToOutput(Quadrilateral(x, x + 1., vlo, vlo + 1.), inputWS, i, j, outputs,
+                                           verticalAxis);
+      }
+    }
+    outputs.addTo(outputWS);
+
+    for (size_t i = 0; i < outputWS.getNumberHistograms(); ++i) {
+      for (size_t j = 0; j < outputWS.blocksize(); ++j) {
+        TS_ASSERT_DELTA(outputWS.y(i)[j], 8., 1e-12)
+        // variances are accumulated in place of the errors
+        TS_ASSERT_DELTA(outputWS.e(i)[j], 8., 1e-12)
+      }
+    }
+  }
+};
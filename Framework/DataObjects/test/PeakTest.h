@@ -274,6 +274,25 @@ public:
     TS_ASSERT_THROWS_ANYTHING(p.setGoniometerMatrix(mat2));
   }
 
+  void test_shareGoniometerMatrix() {
+    Matrix<double> rotation(3, 3);
+    rotation[0][0] = 1.0;
+    rotation[1][2] = 1.0;
+    rotation[2][1] = 1.0;
+    Peak p1(inst, 10000, 2.0);
+    Peak p2(inst, 10001, 3.0);
+    p1.setGoniometerMatrix(rotation);
+    TSM_ASSERT("Different goniometers cannot be shared", !p2.shareGoniometerMatrix(p1));
+    TS_ASSERT_EQUALS(p2.getGoniometerMatrix(), Matrix<double>(3, 3, true));
+    p2.setGoniometerMatrix(rotation);
+    TS_ASSERT(p2.shareGoniometerMatrix(p1));
+    TS_ASSERT_EQUALS(p2.getGoniometerMatrix(), rotation);
+    TS_ASSERT_EQUALS(p2.getInverseGoniometerMatrix(), p1.getInverseGoniometerMatrix());
+    // Changing one peak must not affect the other
+    p1.setGoniometerMatrix(Matrix<double>(3, 3, true));
+    TS_ASSERT_EQUALS(p2.getGoniometerMatrix(), rotation);
+  }
+
   void test_HKL() {
     Peak p(inst, 10000, 2.0);
     p.setHKL(1.0, 2.0, 3.0);
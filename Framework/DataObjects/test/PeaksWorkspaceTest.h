@@ -573,6 +573,20 @@ public:
     TS_ASSERT_EQUALS(pw->getNumberPeaks(), 1);
   }
 
+  void test_removePeaks_keeps_order_and_ignores_invalid_indices() {
+    auto pw = buildPW();
+    Instrument_const_sptr inst = pw->getInstrument();
+    pw->addPeak(Peak(inst, 1, 4.0));
+    pw->addPeak(Peak(inst, 2, 5.0));
+    pw->addPeak(Peak(inst, 3, 6.0));
+
+    pw->removePeaks({1, 1, -1, 10});
+    TS_ASSERT_EQUALS(pw->getNumberPeaks(), 3);
+    TS_ASSERT_DELTA(pw->getPeak(0).getWavelength(), 3.0, 1e-5);
+    TS_ASSERT_DELTA(pw->getPeak(1).getWavelength(), 5.0, 1e-5);
+    TS_ASSERT_DELTA(pw->getPeak(2).getWavelength(), 6.0, 1e-5);
+  }
+
 private:
   struct PeakParameters {
     Instrument_const_sptr instrument;
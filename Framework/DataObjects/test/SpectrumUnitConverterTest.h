@@ -0,0 +1,74 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2024 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidAPI/Run.h"
+#include "MantidAPI/SpectrumInfo.h"
+#include "MantidDataObjects/EventWorkspace.h"
+#include "MantidDataObjects/SpectrumUnitConverter.h"
+#include "MantidFrameworkTestHelpers/WorkspaceCreationHelper.h"
+#include "MantidKernel/UnitFactory.h"
+
+using namespace Mantid::DataObjects;
+using namespace Mantid::Kernel;
+
+class SpectrumUnitConverterTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static SpectrumUnitConverterTest *createSuite() { return new SpectrumUnitConverterTest(); }
+  static void destroySuite(SpectrumUnitConverterTest *suite) { delete suite; }
+
+  SpectrumUnitConverterTest()
+      : m_tof(UnitFactory::Instance().create("TOF")), m_dSpacing(UnitFactory::Instance().create("dSpacing")) {}
+
+  void test_convert_changes_x_and_events_of_only_that_spectrum() {
+    auto ws = WorkspaceCreationHelper::createEventWorkspaceWithFullInstrument(1, 2, false);
+    const auto tofs = ws->getSpectrum(0).getTofs();
+    const std::vector<double> x(ws->x(0).cbegin(), ws->x(0).cend());
+    const auto untouchedTofs = ws->getSpectrum(1).getTofs();
+    const double difc = ws->spectrumInfo().difcUncalibrated(0);
+
+    SpectrumUnitConverter converter(*ws, *m_tof, *m_dSpacing, DeltaEMode::Elastic);
+    TS_ASSERT(converter.convert(0));
+
+    const auto dSpacings = ws->getSpectrum(0).getTofs();
+    TS_ASSERT_EQUALS(dSpacings.size(), tofs.size());
+    for (size_t i = 0; i < tofs.size(); ++i)
+      TS_ASSERT_DELTA(dSpacings[i], tofs[i] / difc, 1e-10);
+    for (size_t i = 0; i < x.size(); ++i)
+      TS_ASSERT_DELTA(ws->x(0)[i], x[i] / difc, 1e-10);
+    TS_ASSERT_EQUALS(ws->getSpectrum(1).getTofs(), untouchedTofs);
+    TS_ASSERT_EQUALS(converter.numberOfFailedSpectra(), 0);
+  }
+
+  void test_convert_clears_spectrum_without_detector() {
+    auto ws = WorkspaceCreationHelper::createEventWorkspaceWithFullInstrument(1, 2, false);
+    ws->getSpectrum(0).clearDetectorIDs();
+
+    SpectrumUnitConverter converter(*ws, *m_tof, *m_dSpacing, DeltaEMode::Elastic);
+    TS_ASSERT(!converter.convert(0));
+    TS_ASSERT(converter.convert(1));
+
+    TS_ASSERT_EQUALS(ws->getSpectrum(0).getNumberEvents(), 0);
+    TS_ASSERT_EQUALS(converter.numberOfFailedSpectra(), 1);
+  }
+
+  void test_storeEMode() {
+    auto ws = WorkspaceCreationHelper::createEventWorkspaceWithFullInstrument(1, 2);
+
+    SpectrumUnitConverter::storeEMode(*ws, DeltaEMode::Direct);
+
+    TS_ASSERT_EQUALS(ws->run().getPropertyValueAsType<std::string>("deltaE-mode"), "Direct");
+  }
+
+private:
+  Unit_sptr m_tof;
+  Unit_sptr m_dSpacing;
+};
@@ -80,6 +80,33 @@ public:
     }
   }
 
+  void test_init_shares_data_between_spectra_until_modified() {
+    Workspace2D workspace;
+    workspace.initialize(3, 6, 5);
+    TS_ASSERT_EQUALS(workspace.sharedY(0), workspace.sharedY(2));
+    TS_ASSERT_EQUALS(workspace.sharedE(0), workspace.sharedE(2));
+
+    workspace.mutableY(1)[0] = 1.0;
+    TS_ASSERT_DIFFERS(workspace.sharedY(1), workspace.sharedY(0));
+    TS_ASSERT_EQUALS(workspace.sharedY(0), workspace.sharedY(2));
+    TS_ASSERT_EQUALS(workspace.y(0)[0], 0.0);
+    TS_ASSERT_EQUALS(workspace.y(1)[0], 1.0);
+    TS_ASSERT_EQUALS(workspace.getSpectrum(2).getSpectrumNo(), 3);
+  }
+
+  void test_clone_shares_data_with_the_original() {
+    auto original = create2DWorkspaceBinned(nhist, nbins);
+    original->mutableY(0)[0] = 3.0;
+    Workspace2D_sptr cloned(original->clone());
+    for (int i = 0; i < nhist; ++i) {
+      TS_ASSERT_EQUALS(cloned->sharedY(i), original->sharedY(i));
+      TS_ASSERT_EQUALS(cloned->getSpectrum(i).getSpectrumNo(), original->getSpectrum(i).getSpectrumNo());
+    }
+    cloned->mutableY(0)[0] = 4.0;
+    TS_ASSERT_EQUALS(original->y(0)[0], 3.0);
+    TS_ASSERT_EQUALS(cloned->y(0)[0], 4.0);
+  }
+
   void test_that_isRaggedWorkspace_returns_false_for_a_non_ragged_Workspace2D() {
     TS_ASSERT(!ws->isRaggedWorkspace());
     TS_ASSERT_EQUALS(ws->blocksize(), 5);
@@ -351,4 +378,11 @@ public:
     std::cout << tim << " to set all detector IDs for " << nhist
               << " spectra, using the ISpectrum method (in parallel).\n";
   }
+
+  void test_create_and_clone() {
+    Workspace2D workspace;
+    workspace.initialize(nhist, 6, 5);
+    Workspace2D_sptr cloned(workspace.clone());
+    TS_ASSERT_EQUALS(cloned->getNumberHistograms(), nhist);
+  }
 };
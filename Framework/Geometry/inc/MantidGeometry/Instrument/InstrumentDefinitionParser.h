@@ -157,6 +157,9 @@ private:
                                 const Poco::XML::Element *pCompElem, const std::string &filename,
                                 const Poco::XML::Element *pType);
 
+  /// Apply default facing to, and register, all pixels of a detector bank
+  void markBankPixelsAsDetectors(const Geometry::ICompAssembly &bank);
+
   /// Append \<locations\> in a locations element
   void appendLocations(Geometry::ICompAssembly *parent, const Poco::XML::Element *pLocElems,
                        const Poco::XML::Element *pCompElem, IdList &idList);
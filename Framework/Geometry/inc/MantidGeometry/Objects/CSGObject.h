@@ -11,6 +11,7 @@
 //----------------------------------------------------------------------
 #include "MantidGeometry/DllConfig.h"
 #include "MantidGeometry/Objects/BoundingBox.h"
+#include "MantidGeometry/Objects/CompiledRule.h"
 #include "MantidGeometry/Objects/IObject.h"
 #include "MantidGeometry/Objects/Track.h"
 #include "MantidGeometry/Rendering/ShapeInfo.h"
@@ -32,6 +33,7 @@ class V3D;
 namespace Geometry {
 class CompGrp;
 class GeometryHandler;
+class LineIntersectVisit;
 class Rule;
 class Surface;
 class Track;
@@ -123,6 +125,7 @@ public:
 
   // INTERSECTION
   int interceptSurface(Geometry::Track &track) const override;
+  int interceptSurfaces(std::vector<Geometry::Track> &tracks) const override;
   double distance(const Track &track) const override;
 
   // Solid angle - uses triangleSolidAngle unless many (>30000) triangles
@@ -184,6 +187,7 @@ private:
   int procPair(std::string &lineStr, std::map<int, std::unique_ptr<Rule>> &ruleMap, int &compUnit) const;
   std::unique_ptr<CompGrp> procComp(std::unique_ptr<Rule>) const;
   int checkSurfaceValid(const Kernel::V3D &, const Kernel::V3D &) const;
+  int addIntercepts(LineIntersectVisit &LI, Geometry::Track &track) const;
 
   /// Calculate bounding box using Rule system
   void calcBoundingBoxByRule();
@@ -202,6 +206,8 @@ private:
   double singleShotMonteCarloVolume(const int shotSize, const size_t seed) const;
   /// Top rule [ Geometric scope of object]
   std::unique_ptr<Rule> m_topRule;
+  /// m_topRule flattened for fast point evaluation. Rebuilt with m_surList
+  CompiledRule m_compiledRule;
   /// Object's bounding box
   BoundingBox m_boundingBox;
   // -- DEPRECATED --
@@ -0,0 +1,79 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2024 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidGeometry/DllConfig.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace Mantid {
+namespace Kernel {
+class V3D;
+}
+namespace Geometry {
+class CSGObject;
+class Rule;
+class Surface;
+
+/**
+\class CompiledRule
+\brief A Rule tree flattened into a linear program
+
+Evaluates whether a point lies inside a CSG object without walking the
+Rule tree. Each surface referenced by the tree is stored once in a
+contiguous array and the boolean operators become conditional jumps over
+a single result register, which keeps the short-circuiting of the tree.
+
+The program holds non-owning pointers to the surfaces of the tree it was
+compiled from and must be rebuilt whenever that tree changes.
+*/
+class MANTID_GEOMETRY_DLL CompiledRule {
+public:
+  /// Construct an empty program
+  CompiledRule() = default;
+  /// Compile the tree below the given rule
+  explicit CompiledRule(const Rule *rule);
+
+  /// True if there is no program, e.g. the tree contained an unknown rule
+  bool empty() const { return m_instructions.empty(); }
+  /// Number of instructions in the program
+  size_t size() const { return m_instructions.size(); }
+  /// Number of distinct surfaces referenced by the program
+  size_t numberOfSurfaces() const { return m_surfaces.size(); }
+
+  bool isValid(const Kernel::V3D &point) const;
+
+private:
+  enum class OpCode : uint8_t {
+    Surface,          ///< result = side of surface[operand] matches sign
+    Constant,         ///< result = sign > 0
+    ObjectComplement, ///< result = point is not in object[operand]
+    JumpIfFalse,      ///< skip to instruction operand if result is false
+    JumpIfTrue,       ///< skip to instruction operand if result is true
+    Not               ///< result = !result
+  };
+  struct Instruction {
+    OpCode op;
+    int sign;
+    uint32_t operand;
+  };
+
+  bool compile(const Rule *rule);
+  uint32_t surfaceIndex(const Surface *surface);
+  void emit(OpCode op, int sign, uint32_t operand);
+
+  /// The program
+  std::vector<Instruction> m_instructions;
+  /// Distinct surfaces referenced by Surface instructions
+  std::vector<const Surface *> m_surfaces;
+  /// Objects referenced by ObjectComplement instructions
+  std::vector<const CSGObject *> m_objects;
+};
+
+} // namespace Geometry
+} // namespace Mantid
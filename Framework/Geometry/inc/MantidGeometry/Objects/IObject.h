@@ -53,6 +53,8 @@ public:
   virtual int getName() const = 0;
 
   virtual int interceptSurface(Geometry::Track &) const = 0;
+  /// Intercept a batch of tracks, returning the total number of segments added
+  virtual int interceptSurfaces(std::vector<Geometry::Track> &tracks) const;
   virtual double distance(const Geometry::Track &) const = 0;
   // Solid angle
   virtual double solidAngle(const SolidAngleParams &params) const = 0;
@@ -16,6 +16,7 @@
 #include "MantidGeometry/Rendering/ShapeInfo.h"
 #include "MantidKernel/Material.h"
 #include "MantidKernel/Matrix.h"
+#include "MantidKernel/V3D.h"
 #include <map>
 #include <memory>
 
@@ -149,6 +150,13 @@ private:
   bool getTriangle(const size_t index, Kernel::V3D &v1, Kernel::V3D &v2, Kernel::V3D &v3) const;
   /// Search object for valid point
   bool searchForObject(Kernel::V3D &point) const;
+  /// Build the bounding volume hierarchy over the triangles
+  void buildBoundingVolumeHierarchy();
+  /// Build one node of the bounding volume hierarchy and its children
+  void buildBoundingVolumeNode(uint32_t begin, uint32_t end, const std::vector<Kernel::V3D> &centroids);
+  /// Get the indices, in ascending order, of triangles a ray may intersect
+  void getCandidateTriangles(const Kernel::V3D &start, const Kernel::V3D &direction,
+                             std::vector<uint32_t> &candidates) const;
 
   /// Cache for object's bounding box
   mutable BoundingBox m_boundingBox;
@@ -174,6 +182,21 @@ private:
   /// Triangles are specified by indices into a list of vertices.
   std::vector<uint32_t> m_triangles;
   std::vector<Kernel::V3D> m_vertices;
+
+  /// Node of the bounding volume hierarchy. The first child of an internal
+  /// node immediately follows it in m_bvhNodes.
+  struct BoundingVolumeNode {
+    Kernel::V3D minPoint;
+    Kernel::V3D maxPoint;
+    /// Leaf: first entry in m_bvhTriangles. Internal: index of second child
+    uint32_t offset = 0;
+    /// Number of triangles in a leaf, zero for an internal node
+    uint32_t count = 0;
+  };
+  /// Bounding volume hierarchy used to accelerate ray queries
+  std::vector<BoundingVolumeNode> m_bvhNodes;
+  /// Triangle indices ordered so that each leaf owns a contiguous range
+  std::vector<uint32_t> m_bvhTriangles;
   /// material composition
   Kernel::Material m_material;
 };
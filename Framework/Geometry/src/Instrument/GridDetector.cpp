@@ -18,6 +18,7 @@
 #include "MantidKernel/Exception.h"
 #include "MantidKernel/Material.h"
 #include "MantidKernel/Matrix.h"
+#include "MantidKernel/MultiThreaded.h"
 #include <algorithm>
 #include <boost/regex.hpp>
 #include <memory>
@@ -435,7 +436,15 @@ V3D GridDetector::getRelativePosAtXYZ(int x, int y, int z) const {
 }
 
 void GridDetector::createLayer(const std::string &name, CompAssembly *parent, int iz, int &minDetID, int &maxDetID) {
+  // Each x-column is independent of the others so they are built concurrently
+  // without a parent and attached in order afterwards. The resulting tree, and
+  // therefore the detector ordering, is identical to a serial expansion.
+  std::vector<CompAssembly *> xColumns(m_xpixels, nullptr);
+  std::vector<int> columnMinDetID(m_xpixels, minDetID);
+  std::vector<int> columnMaxDetID(m_xpixels, maxDetID);
+
   // Loop and create all detectors in this layer.
+  PARALLEL_FOR_IF(m_xpixels > 1)
   for (int ix = 0; ix < m_xpixels; ++ix) {
     // Create an ICompAssembly for each x-column
     std::ostringstream oss_col;
@@ -445,7 +454,7 @@ void GridDetector::createLayer(const std::string &name, CompAssembly *parent, in
     else
       oss_col << name << "(x=" << ix << ")";
 
-    auto *xColumn = new CompAssembly(oss_col.str(), parent);
+    auto *xColumn = new CompAssembly(oss_col.str(), nullptr);
 
     for (int iy = 0; iy < m_ypixels; ++iy) {
       // Make the name
@@ -459,12 +468,12 @@ void GridDetector::createLayer(const std::string &name, CompAssembly *parent, in
       auto id = this->getDetectorIDAtXYZ(ix, iy, iz);
 
       // minimum grid detector id
-      if (id < minDetID) {
-        minDetID = id;
+      if (id < columnMinDetID[ix]) {
+        columnMinDetID[ix] = id;
       }
       // maximum grid detector id
-      if (id > maxDetID) {
-        maxDetID = id;
+      if (id > columnMaxDetID[ix]) {
+        columnMaxDetID[ix] = id;
       }
       // Create the detector from the given id & shape and with xColumn as the
       // parent.
@@ -482,6 +491,14 @@ void GridDetector::createLayer(const std::string &name, CompAssembly *parent, in
       // Add it to the x-column
       xColumn->add(detector);
     }
+    xColumns[ix] = xColumn;
+  }
+
+  // Attach the columns in order and combine the id range
+  for (int ix = 0; ix < m_xpixels; ++ix) {
+    parent->add(xColumns[ix]);
+    minDetID = std::min(minDetID, columnMinDetID[ix]);
+    maxDetID = std::max(maxDetID, columnMaxDetID[ix]);
   }
 }
 
@@ -20,6 +20,7 @@
 #include "MantidKernel/ChecksumHelper.h"
 #include "MantidKernel/ConfigService.h"
 #include "MantidKernel/Logger.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/ProgressBase.h"
 #include "MantidKernel/Strings.h"
 #include "MantidKernel/UnitFactory.h"
@@ -58,6 +59,17 @@ namespace Mantid::Geometry {
 namespace {
 // initialize the static logger
 Kernel::Logger g_log("InstrumentDefinitionParser");
+
+/// Collect the detectors of an assembly in depth-first tree order
+void collectDetectors(const Geometry::ICompAssembly &assembly, std::vector<Geometry::Detector *> &detectors) {
+  for (int i = 0; i < assembly.nelements(); ++i) {
+    auto child = assembly.getChild(i);
+    if (auto detector = std::dynamic_pointer_cast<Geometry::Detector>(child))
+      detectors.emplace_back(detector.get());
+    else if (auto subAssembly = std::dynamic_pointer_cast<Geometry::ICompAssembly>(child))
+      collectDetectors(*subAssembly, detectors);
+  }
+}
 } // namespace
 //----------------------------------------------------------------------------------------------
 /** Default Constructor - not very functional in this state
@@ -1394,26 +1406,9 @@ void InstrumentDefinitionParser::createGridDetector(Geometry::ICompAssembly *par
   bank->initialize(shape, xpixels, xstart, xstep, ypixels, ystart, ystep, zpixels, zstart, zstep, idstart, idfillorder,
                    idstepbyrow, idstep);
 
-  // Loop through all detectors in the newly created bank and mark those in
-  // the instrument.
+  // Mark all detectors in the newly created bank in the instrument.
   try {
-    for (int z = 0; z < bank->nelements(); ++z) {
-      auto zLayer = std::dynamic_pointer_cast<Geometry::ICompAssembly>((*bank)[z]);
-      for (int x = 0; x < zLayer->nelements(); ++x) {
-        auto xColumn = std::dynamic_pointer_cast<Geometry::ICompAssembly>((*zLayer)[x]);
-        for (int y = 0; y < xColumn->nelements(); ++y) {
-          std::shared_ptr<Geometry::Detector> detector = std::dynamic_pointer_cast<Geometry::Detector>((*xColumn)[y]);
-          if (detector) {
-            // Make default facing for the pixel
-            auto *comp = static_cast<IComponent *>(detector.get());
-            if (m_haveDefaultFacing)
-              makeXYplaneFaceComponent(comp, m_defaultFacing);
-            // Mark it as a detector (add to the instrument cache)
-            m_instrument->markAsDetectorIncomplete(detector.get());
-          }
-        }
-      }
-    }
+    markBankPixelsAsDetectors(*bank);
   } catch (Kernel::Exception::ExistsError &) {
     throw Kernel::Exception::InstrumentDefinitionError("Duplicate detector ID found when adding GridDetector " + name +
                                                        " in XML instrument file" + filename);
@@ -1491,23 +1486,9 @@ void InstrumentDefinitionParser::createRectangularDetector(Geometry::ICompAssemb
   bank->initialize(shape, xpixels, xstart, xstep, ypixels, ystart, ystep, idstart, idfillbyfirst_y, idstepbyrow,
                    idstep);
 
-  // Loop through all detectors in the newly created bank and mark those in
-  // the instrument.
+  // Mark all detectors in the newly created bank in the instrument.
   try {
-    for (int x = 0; x < bank->nelements(); x++) {
-      std::shared_ptr<Geometry::ICompAssembly> xColumn = std::dynamic_pointer_cast<Geometry::ICompAssembly>((*bank)[x]);
-      for (int y = 0; y < xColumn->nelements(); y++) {
-        std::shared_ptr<Geometry::Detector> detector = std::dynamic_pointer_cast<Geometry::Detector>((*xColumn)[y]);
-        if (detector) {
-          // Make default facing for the pixel
-          auto *comp = static_cast<IComponent *>(detector.get());
-          if (m_haveDefaultFacing)
-            makeXYplaneFaceComponent(comp, m_defaultFacing);
-          // Mark it as a detector (add to the instrument cache)
-          m_instrument->markAsDetectorIncomplete(detector.get());
-        }
-      }
-    }
+    markBankPixelsAsDetectors(*bank);
   } catch (Kernel::Exception::ExistsError &) {
     throw Kernel::Exception::InstrumentDefinitionError("Duplicate detector ID found when adding RectangularDetector " +
                                                        name + " in XML instrument file" + filename);
@@ -1625,29 +1606,43 @@ void InstrumentDefinitionParser::createStructuredDetector(Geometry::ICompAssembl
   bank->initialize(xpixels, ypixels, std::move(xValues), std::move(yValues), isZBeam, idstart, idfillbyfirst_y,
                    idstepbyrow, idstep);
 
-  // Loop through all detectors in the newly created bank and mark those in
-  // the instrument.
+  // Mark all detectors in the newly created bank in the instrument.
   try {
-    for (int x = 0; x < bank->nelements(); x++) {
-      std::shared_ptr<Geometry::ICompAssembly> xColumn = std::dynamic_pointer_cast<Geometry::ICompAssembly>((*bank)[x]);
-      for (int y = 0; y < xColumn->nelements(); y++) {
-        std::shared_ptr<Geometry::Detector> detector = std::dynamic_pointer_cast<Geometry::Detector>((*xColumn)[y]);
-        if (detector) {
-          // Make default facing for the pixel
-          auto *comp = static_cast<IComponent *>(detector.get());
-          if (m_haveDefaultFacing)
-            makeXYplaneFaceComponent(comp, m_defaultFacing);
-          // Mark it as a detector (add to the instrument cache)
-          m_instrument->markAsDetectorIncomplete(detector.get());
-        }
-      }
-    }
+    markBankPixelsAsDetectors(*bank);
   } catch (Kernel::Exception::ExistsError &) {
     throw Kernel::Exception::InstrumentDefinitionError("Duplicate detector ID found when adding StructuredDetector " +
                                                        name + " in XML instrument file" + filename);
   }
 }
 
+//-----------------------------------------------------------------------------------------------------------------------
+/** Mark every pixel of a freshly expanded detector bank as a detector.
+ *
+ *  Applying the default facing only rotates the pixel itself, so it is done
+ *  concurrently for all pixels of the bank. The pixels are then added to the
+ *  instrument cache serially in tree order, which keeps the detector ordering
+ *  identical to that of a serial parse.
+ *
+ *  @param bank :: The bank (e.g. a RectangularDetector) whose pixels to mark
+ *  @throw ExistsError if a pixel's detector ID is already in use
+ */
+void InstrumentDefinitionParser::markBankPixelsAsDetectors(const Geometry::ICompAssembly &bank) {
+  std::vector<Geometry::Detector *> pixels;
+  collectDetectors(bank, pixels);
+
+  if (m_haveDefaultFacing) {
+    const auto numPixels = static_cast<int64_t>(pixels.size());
+    PARALLEL_FOR_IF(numPixels > 1)
+    for (int64_t i = 0; i < numPixels; ++i) {
+      auto *comp = static_cast<IComponent *>(pixels[i]);
+      makeXYplaneFaceComponent(comp, m_defaultFacing);
+    }
+  }
+
+  for (auto *pixel : pixels)
+    m_instrument->markAsDetectorIncomplete(pixel);
+}
+
 //-----------------------------------------------------------------------------------------------------------------------
 /** Assumes second argument is pointing to a leaf, which here means the
  *location
@@ -428,6 +428,7 @@ CSGObject &CSGObject::operator=(const CSGObject &A) {
     m_id = A.m_id;
     m_material = std::make_unique<Material>(A.material());
 
+    m_compiledRule = CompiledRule();
     if (m_topRule)
       createSurfaceList();
   }
@@ -781,6 +782,8 @@ int CSGObject::checkSurfaceValid(const Kernel::V3D &point, const Kernel::V3D &di
  * @returns 1 if true and 0 if false
  */
 bool CSGObject::isValid(const Kernel::V3D &point) const {
+  if (!m_compiledRule.empty())
+    return m_compiledRule.isValid(point);
   if (!m_topRule)
     return false;
   return m_topRule->isValid(point);
@@ -845,6 +848,7 @@ int CSGObject::createSurfaceList(const int outFlag) {
       logger.debug() << (*vc)->getName() << '\n';
     }
   }
+  m_compiledRule = CompiledRule(m_topRule.get());
   return 1;
 }
 
@@ -936,6 +940,7 @@ void CSGObject::print() const {
 void CSGObject::makeComplement() {
   std::unique_ptr<Rule> NCG = procComp(std::move(m_topRule));
   m_topRule = std::move(NCG);
+  m_compiledRule = CompiledRule(m_topRule.get());
 }
 
 /**
@@ -992,6 +997,7 @@ void CSGObject::write(std::ostream &outStream) const {
  */
 int CSGObject::procString(const std::string &lineStr) {
   m_topRule = nullptr;
+  m_compiledRule = CompiledRule();
   std::map<int, std::unique_ptr<Rule>> RuleList; // List for the rules
   int Ridx = 0;                                  // Current index (not necessary size of RuleList
   // SURFACE REPLACEMENT
@@ -1073,13 +1079,41 @@ int CSGObject::procString(const std::string &lineStr) {
  * @return Number of segments added
  */
 int CSGObject::interceptSurface(Geometry::Track &track) const {
+  LineIntersectVisit LI(track.startPoint(), track.direction());
+  return addIntercepts(LI, track);
+}
+
+/**
+ * Given a batch of tracks, fill each with its valid sections. The line
+ * intersection buffers are shared between the tracks.
+ * @param tracks :: Initial tracks
+ * @return Total number of segments added
+ */
+int CSGObject::interceptSurfaces(std::vector<Geometry::Track> &tracks) const {
+  if (tracks.empty())
+    return 0;
+  LineIntersectVisit LI(tracks.front().startPoint(), tracks.front().direction());
+  int segmentsAdded(0);
+  for (auto &track : tracks) {
+    LI.setLine(track.startPoint(), track.direction());
+    segmentsAdded += addIntercepts(LI, track);
+  }
+  return segmentsAdded;
+}
+
+/**
+ * Intersect the surfaces with the line held by a visitor and add the points
+ * where the track enters or leaves the object to the track
+ * @param LI :: Visitor holding the line of the track, with no points yet
+ * @param track :: Track to fill
+ * @return Number of segments added
+ */
+int CSGObject::addIntercepts(LineIntersectVisit &LI, Geometry::Track &track) const {
   // Number of intersections original track
   int originalCount = track.count();
 
   // Loop over all the surfaces to get the intercepts, i.e. populating
   // points into LI
-  LineIntersectVisit LI(track.startPoint(), track.direction());
-
   for (auto &surface : m_surList) {
     surface->acceptVisitor(LI);
   }
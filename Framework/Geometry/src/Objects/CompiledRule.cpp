@@ -0,0 +1,162 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2024 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidGeometry/Objects/CompiledRule.h"
+#include "MantidGeometry/Objects/CSGObject.h"
+#include "MantidGeometry/Objects/Rules.h"
+#include "MantidGeometry/Surfaces/Surface.h"
+#include "MantidKernel/V3D.h"
+
+#include <algorithm>
+
+namespace Mantid::Geometry {
+
+/**
+ * Compile a Rule tree. If the tree contains a rule type that cannot be
+ * compiled the program is left empty.
+ * @param rule :: The top of the tree
+ */
+CompiledRule::CompiledRule(const Rule *rule) {
+  if (!rule || !compile(rule)) {
+    m_instructions.clear();
+    m_surfaces.clear();
+    m_objects.clear();
+  }
+}
+
+/**
+ * Determines if a point is valid, giving the same answer as calling
+ * Rule::isValid on the tree this program was compiled from
+ * @param point :: Point to test
+ * @returns true if the point is within the object or on its surface
+ */
+bool CompiledRule::isValid(const Kernel::V3D &point) const {
+  bool result(false);
+  const size_t nInstructions = m_instructions.size();
+  size_t next = 0;
+  while (next < nInstructions) {
+    const auto &instruction = m_instructions[next++];
+    switch (instruction.op) {
+    case OpCode::Surface:
+      result = (m_surfaces[instruction.operand]->side(point) * instruction.sign) >= 0;
+      break;
+    case OpCode::Constant:
+      result = instruction.sign > 0;
+      break;
+    case OpCode::ObjectComplement:
+      result = !m_objects[instruction.operand]->isValid(point);
+      break;
+    case OpCode::JumpIfFalse:
+      if (!result)
+        next = instruction.operand;
+      break;
+    case OpCode::JumpIfTrue:
+      if (result)
+        next = instruction.operand;
+      break;
+    case OpCode::Not:
+      result = !result;
+      break;
+    }
+  }
+  return result;
+}
+
+/**
+ * Append the instructions for a rule and its children to the program.
+ * Null children are treated as Rule::isValid treats them.
+ * @param rule :: Rule to compile
+ * @returns false if the rule, or one of its children, cannot be compiled
+ */
+bool CompiledRule::compile(const Rule *rule) {
+  if (const auto *surfPoint = dynamic_cast<const SurfPoint *>(rule)) {
+    if (surfPoint->getKey())
+      emit(OpCode::Surface, surfPoint->getSign(), surfaceIndex(surfPoint->getKey()));
+    else
+      emit(OpCode::Constant, 0, 0);
+    return true;
+  }
+
+  const bool isUnion = dynamic_cast<const Union *>(rule) != nullptr;
+  if (isUnion || dynamic_cast<const Intersection *>(rule)) {
+    const Rule *left = rule->leaf(0);
+    const Rule *right = rule->leaf(1);
+    if (!left || !right) {
+      // An intersection with a missing side is never valid, a union is
+      // valid if its remaining side is
+      const Rule *remaining = left ? left : right;
+      if (!isUnion || !remaining) {
+        emit(OpCode::Constant, 0, 0);
+        return true;
+      }
+      return compile(remaining);
+    }
+    if (!compile(left))
+      return false;
+    // the result of the left side decides the whole rule when it is false
+    // for an intersection or true for a union
+    const size_t jump = m_instructions.size();
+    emit(isUnion ? OpCode::JumpIfTrue : OpCode::JumpIfFalse, 0, 0);
+    if (!compile(right))
+      return false;
+    m_instructions[jump].operand = static_cast<uint32_t>(m_instructions.size());
+    return true;
+  }
+
+  if (const auto *group = dynamic_cast<const CompGrp *>(rule)) {
+    const Rule *child = group->leaf(0);
+    if (!child) {
+      emit(OpCode::Constant, 1, 0);
+      return true;
+    }
+    if (!compile(child))
+      return false;
+    emit(OpCode::Not, 0, 0);
+    return true;
+  }
+
+  if (const auto *compObj = dynamic_cast<const CompObj *>(rule)) {
+    if (compObj->getObj()) {
+      m_objects.emplace_back(compObj->getObj());
+      emit(OpCode::ObjectComplement, 0, static_cast<uint32_t>(m_objects.size() - 1));
+    } else {
+      emit(OpCode::Constant, 1, 0);
+    }
+    return true;
+  }
+
+  if (dynamic_cast<const BoolValue *>(rule)) {
+    // The status of a BoolValue does not depend on the point
+    emit(OpCode::Constant, rule->isValid(Kernel::V3D()) ? 1 : 0, 0);
+    return true;
+  }
+  return false;
+}
+
+/**
+ * @param surface :: A surface referenced by the tree
+ * @returns The index of the surface in the program's surface array, adding
+ * it if it has not been seen before
+ */
+uint32_t CompiledRule::surfaceIndex(const Surface *surface) {
+  const auto found = std::find(m_surfaces.cbegin(), m_surfaces.cend(), surface);
+  if (found != m_surfaces.cend())
+    return static_cast<uint32_t>(std::distance(m_surfaces.cbegin(), found));
+  m_surfaces.emplace_back(surface);
+  return static_cast<uint32_t>(m_surfaces.size() - 1);
+}
+
+/**
+ * Append an instruction to the program
+ * @param op :: The operation
+ * @param sign :: Surface sign or constant value
+ * @param operand :: Surface/object index or jump target
+ */
+void CompiledRule::emit(const OpCode op, const int sign, const uint32_t operand) {
+  m_instructions.emplace_back(Instruction{op, sign, operand});
+}
+
+} // namespace Mantid::Geometry
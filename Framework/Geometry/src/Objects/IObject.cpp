@@ -0,0 +1,25 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2024 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#include "MantidGeometry/Objects/IObject.h"
+#include "MantidGeometry/Objects/Track.h"
+
+#include <numeric>
+
+namespace Mantid::Geometry {
+
+/**
+ * Fill each of a batch of tracks with its valid sections. Objects that can
+ * share work between tracks override this.
+ * @param tracks :: Tracks to intercept
+ * @return Total number of segments added
+ */
+int IObject::interceptSurfaces(std::vector<Track> &tracks) const {
+  return std::accumulate(tracks.begin(), tracks.end(), 0,
+                         [this](int sum, Track &track) { return sum + interceptSurface(track); });
+}
+
+} // namespace Mantid::Geometry
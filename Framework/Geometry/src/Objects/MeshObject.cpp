@@ -15,11 +15,85 @@
 #include "MantidKernel/Material.h"
 
 #include <algorithm>
+#include <array>
+#include <limits>
 #include <memory>
+#include <numeric>
 #include <utility>
 
 namespace Mantid::Geometry {
 
+namespace {
+/// Maximum number of triangles held in a leaf of the bounding volume hierarchy
+constexpr uint32_t BVH_LEAF_SIZE = 4;
+/// Splitting at the median keeps the hierarchy balanced, so its depth is
+/// bounded by the number of bits in a triangle index
+constexpr size_t BVH_MAX_DEPTH = 64;
+
+/**
+ * Test whether a forward ray passes through an axis aligned box
+ * @param start :: Start point of ray
+ * @param direction :: Direction of ray
+ * @param minPoint :: Minimum corner of box
+ * @param maxPoint :: Maximum corner of box
+ * @param tolerance :: Distance by which the box is grown on every side
+ * @returns true if the ray touches the box at or beyond its start point
+ */
+bool rayIntersectsBox(const Kernel::V3D &start, const Kernel::V3D &direction, const Kernel::V3D &minPoint,
+                      const Kernel::V3D &maxPoint, const double tolerance) {
+  double tNear = std::numeric_limits<double>::lowest();
+  double tFar = std::numeric_limits<double>::max();
+  for (size_t axis = 0; axis < 3; ++axis) {
+    const double low = minPoint[axis] - tolerance;
+    const double high = maxPoint[axis] + tolerance;
+    if (direction[axis] == 0.0) {
+      // Parallel to this pair of planes so must start between them
+      if (start[axis] < low || start[axis] > high)
+        return false;
+      continue;
+    }
+    double t1 = (low - start[axis]) / direction[axis];
+    double t2 = (high - start[axis]) / direction[axis];
+    if (t1 > t2)
+      std::swap(t1, t2);
+    tNear = std::max(tNear, t1);
+    tFar = std::min(tFar, t2);
+    if (tNear > tFar)
+      return false;
+  }
+  return tFar >= 0.0;
+}
+
+/**
+ * Find the solid angle subtended by a closed triangular mesh
+ * @param triangles :: Triangles specified by indices into vertices
+ * @param vertices :: Vertices of the mesh
+ * @param observer :: Point to measure solid angle from
+ * @return :: estimate of solid angle of the mesh
+ */
+double meshSolidAngle(const std::vector<uint32_t> &triangles, const std::vector<Kernel::V3D> &vertices,
+                      const Kernel::V3D &observer) {
+  double solidAngleSum(0), solidAngleNegativeSum(0);
+  for (size_t i = 0; i + 2 < triangles.size(); i += 3) {
+    double sa = MeshObjectCommon::getTriangleSolidAngle(vertices[triangles[i]], vertices[triangles[i + 1]],
+                                                        vertices[triangles[i + 2]], observer);
+    if (sa > 0.0) {
+      solidAngleSum += sa;
+    } else {
+      solidAngleNegativeSum += sa;
+    }
+  }
+  /*
+    Same implementation as CSGObject. Assumes a convex closed mesh with
+    solidAngleSum == -solidAngleNegativeSum
+
+    Average is used to bypass issues with winding order. Surface normal
+    affects magnitude of solid angle. See CSGObject.
+  */
+  return 0.5 * (solidAngleSum - solidAngleNegativeSum);
+}
+} // namespace
+
 MeshObject::MeshObject(std::vector<uint32_t> faces, std::vector<Kernel::V3D> vertices, const Kernel::Material &material)
     : m_boundingBox(), m_id("MeshObject"), m_triangles(std::move(faces)), m_vertices(std::move(vertices)),
       m_material(material) {
@@ -40,6 +114,77 @@ void MeshObject::initialize() {
 
   MeshObjectCommon::checkVertexLimit(m_vertices.size());
   m_handler = std::make_shared<GeometryHandler>(*this);
+  buildBoundingVolumeHierarchy();
+}
+
+/**
+ * Build a bounding volume hierarchy over the triangles so that ray queries
+ * only test the triangles in boxes the ray passes through. Must be called
+ * again whenever the vertices move.
+ */
+void MeshObject::buildBoundingVolumeHierarchy() {
+  const auto nTriangles = static_cast<uint32_t>(numberOfTriangles());
+  m_bvhNodes.clear();
+  m_bvhTriangles.resize(nTriangles);
+  std::iota(m_bvhTriangles.begin(), m_bvhTriangles.end(), 0);
+  if (nTriangles == 0)
+    return;
+
+  std::vector<Kernel::V3D> centroids(nTriangles);
+  Kernel::V3D vertex1, vertex2, vertex3;
+  for (uint32_t i = 0; getTriangle(i, vertex1, vertex2, vertex3); ++i) {
+    centroids[i] = (vertex1 + vertex2 + vertex3) / 3.0;
+  }
+  m_bvhNodes.reserve(2 * (nTriangles / BVH_LEAF_SIZE + 1));
+  buildBoundingVolumeNode(0, nTriangles, centroids);
+}
+
+/**
+ * Add a node covering m_bvhTriangles[begin, end) to the hierarchy, splitting
+ * it at the median centroid along its longest axis until the leaves are small
+ * @param begin :: First entry of m_bvhTriangles covered by the node
+ * @param end :: One past the last entry of m_bvhTriangles covered by the node
+ * @param centroids :: Centroid of each triangle
+ */
+void MeshObject::buildBoundingVolumeNode(const uint32_t begin, const uint32_t end,
+                                         const std::vector<Kernel::V3D> &centroids) {
+  constexpr double maxValue = std::numeric_limits<double>::max();
+  Kernel::V3D minPoint(maxValue, maxValue, maxValue), maxPoint(-maxValue, -maxValue, -maxValue);
+  Kernel::V3D centroidMin(minPoint), centroidMax(maxPoint);
+  for (auto i = begin; i < end; ++i) {
+    const auto triangle = m_bvhTriangles[i];
+    for (size_t axis = 0; axis < 3; ++axis) {
+      for (size_t corner = 0; corner < 3; ++corner) {
+        const double value = m_vertices[m_triangles[3 * triangle + corner]][axis];
+        minPoint[axis] = std::min(minPoint[axis], value);
+        maxPoint[axis] = std::max(maxPoint[axis], value);
+      }
+      centroidMin[axis] = std::min(centroidMin[axis], centroids[triangle][axis]);
+      centroidMax[axis] = std::max(centroidMax[axis], centroids[triangle][axis]);
+    }
+  }
+
+  const auto nodeIndex = m_bvhNodes.size();
+  m_bvhNodes.emplace_back(BoundingVolumeNode{minPoint, maxPoint, begin, end - begin});
+  if (end - begin <= BVH_LEAF_SIZE)
+    return;
+
+  const auto extent = centroidMax - centroidMin;
+  size_t axis = 0;
+  if (extent[1] > extent[axis])
+    axis = 1;
+  if (extent[2] > extent[axis])
+    axis = 2;
+  const auto middle = begin + (end - begin) / 2;
+  std::nth_element(m_bvhTriangles.begin() + begin, m_bvhTriangles.begin() + middle, m_bvhTriangles.begin() + end,
+                   [&centroids, axis](const uint32_t lhs, const uint32_t rhs) {
+                     return centroids[lhs][axis] < centroids[rhs][axis];
+                   });
+
+  m_bvhNodes[nodeIndex].count = 0;
+  buildBoundingVolumeNode(begin, middle, centroids);
+  m_bvhNodes[nodeIndex].offset = static_cast<uint32_t>(m_bvhNodes.size());
+  buildBoundingVolumeNode(middle, end, centroids);
 }
 
 /**
@@ -176,7 +321,10 @@ int MeshObject::interceptSurface(Geometry::Track &UT) const {
 double MeshObject::distance(const Track &track) const {
   Kernel::V3D vertex1, vertex2, vertex3, intersection;
   TrackDirection unused;
-  for (size_t i = 0; getTriangle(i, vertex1, vertex2, vertex3); ++i) {
+  std::vector<uint32_t> candidates;
+  getCandidateTriangles(track.startPoint(), track.direction(), candidates);
+  for (const auto i : candidates) {
+    getTriangle(i, vertex1, vertex2, vertex3);
     if (MeshObjectCommon::rayIntersectsTriangle(track.startPoint(), track.direction(), vertex1, vertex2, vertex3,
                                                 intersection, unused)) {
       return track.startPoint().distance(intersection);
@@ -201,7 +349,10 @@ void MeshObject::getIntersections(const Kernel::V3D &start, const Kernel::V3D &d
 
   Kernel::V3D vertex1, vertex2, vertex3, intersection;
   TrackDirection entryExit;
-  for (size_t i = 0; getTriangle(i, vertex1, vertex2, vertex3); ++i) {
+  std::vector<uint32_t> candidates;
+  getCandidateTriangles(start, direction, candidates);
+  for (const auto i : candidates) {
+    getTriangle(i, vertex1, vertex2, vertex3);
     if (MeshObjectCommon::rayIntersectsTriangle(start, direction, vertex1, vertex2, vertex3, intersection, entryExit)) {
       intersectionPoints.emplace_back(intersection);
       entryExitFlags.emplace_back(entryExit);
@@ -210,6 +361,39 @@ void MeshObject::getIntersections(const Kernel::V3D &start, const Kernel::V3D &d
   // still need to deal with edge cases
 }
 
+/**
+ * Walk the bounding volume hierarchy to find the triangles whose boxes a ray
+ * passes through. They are returned in ascending order so that results are
+ * identical to testing every triangle in turn.
+ * @param start :: Start point of ray
+ * @param direction :: Direction of ray
+ * @param candidates :: Filled with the indices of the candidate triangles
+ */
+void MeshObject::getCandidateTriangles(const Kernel::V3D &start, const Kernel::V3D &direction,
+                                       std::vector<uint32_t> &candidates) const {
+  candidates.clear();
+  if (m_bvhNodes.empty())
+    return;
+
+  std::array<uint32_t, BVH_MAX_DEPTH + 1> stack;
+  size_t stackSize = 0;
+  stack[stackSize++] = 0;
+  while (stackSize > 0) {
+    const auto nodeIndex = stack[--stackSize];
+    const auto &node = m_bvhNodes[nodeIndex];
+    if (!rayIntersectsBox(start, direction, node.minPoint, node.maxPoint, M_TOLERANCE))
+      continue;
+    if (node.count > 0) {
+      const auto first = m_bvhTriangles.cbegin() + node.offset;
+      candidates.insert(candidates.end(), first, first + node.count);
+    } else {
+      stack[stackSize++] = node.offset;
+      stack[stackSize++] = nodeIndex + 1;
+    }
+  }
+  std::sort(candidates.begin(), candidates.end());
+}
+
 /*
  * Get a triangle - useful for iterating over triangles
  * @param index :: Index of triangle in MeshObject
@@ -271,24 +455,7 @@ void MeshObject::getBoundingBox(double &xmax, double &ymax, double &zmax, double
  * @return :: estimate of solid angle of object.
  */
 double MeshObject::solidAngle(const SolidAngleParams &params) const {
-  double solidAngleSum(0), solidAngleNegativeSum(0);
-  Kernel::V3D vertex1, vertex2, vertex3;
-  for (size_t i = 0; this->getTriangle(i, vertex1, vertex2, vertex3); ++i) {
-    double sa = MeshObjectCommon::getTriangleSolidAngle(vertex1, vertex2, vertex3, params.observer());
-    if (sa > 0.0) {
-      solidAngleSum += sa;
-    } else {
-      solidAngleNegativeSum += sa;
-    }
-  }
-  /*
-    Same implementation as CSGObject. Assumes a convex closed mesh with
-    solidAngleSum == -solidAngleNegativeSum
-
-    Average is used to bypass issues with winding order. Surface normal
-    affects magnitude of solid angle. See CSGObject.
-  */
-  return 0.5 * (solidAngleSum - solidAngleNegativeSum);
+  return meshSolidAngle(m_triangles, m_vertices, params.observer());
 }
 
 /**
@@ -303,8 +470,7 @@ double MeshObject::solidAngle(const SolidAngleParams &params, const Kernel::V3D
   scaledVertices.reserve(m_vertices.size());
   std::transform(m_vertices.cbegin(), m_vertices.cend(), std::back_inserter(scaledVertices),
                  [&scaleFactor](const auto &vertex) { return scaleFactor * vertex; });
-  MeshObject meshScaled(m_triangles, scaledVertices, m_material);
-  return meshScaled.solidAngle(params);
+  return meshSolidAngle(m_triangles, scaledVertices, params.observer());
 }
 
 /**
@@ -476,6 +642,7 @@ std::shared_ptr<GeometryHandler> MeshObject::getGeometryHandler() const {
 void MeshObject::rotate(const Kernel::Matrix<double> &rotationMatrix) {
   std::for_each(m_vertices.begin(), m_vertices.end(),
                 [&rotationMatrix](auto &vertex) { vertex.rotate(rotationMatrix); });
+  buildBoundingVolumeHierarchy();
 }
 
 /**
@@ -485,6 +652,7 @@ void MeshObject::rotate(const Kernel::Matrix<double> &rotationMatrix) {
 void MeshObject::translate(const Kernel::V3D &translationVector) {
   std::transform(m_vertices.cbegin(), m_vertices.cend(), m_vertices.begin(),
                  [&translationVector](const auto &vertex) { return vertex + translationVector; });
+  buildBoundingVolumeHierarchy();
 }
 
 /**
@@ -494,6 +662,7 @@ void MeshObject::translate(const Kernel::V3D &translationVector) {
 void MeshObject::scale(const double scaleFactor) {
   std::transform(m_vertices.cbegin(), m_vertices.cend(), m_vertices.begin(),
                  [&scaleFactor](const auto &vertex) { return vertex * scaleFactor; });
+  buildBoundingVolumeHierarchy();
 }
 
 /**
@@ -519,6 +688,7 @@ void MeshObject::multiply(const Kernel::Matrix<double> &matrix) {
     Kernel::V3D newvertex(vertexout[0], vertexout[1], vertexout[2]);
     vertex = newvertex;
   }
+  buildBoundingVolumeHierarchy();
 }
 
 /**
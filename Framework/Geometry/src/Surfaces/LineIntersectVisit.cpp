@@ -92,6 +92,18 @@ void LineIntersectVisit::Accept(const General &Surf)
   m_line.intersect(m_intersectionPointsOut, Surf);
 }
 
+void LineIntersectVisit::setLine(const Kernel::V3D &point, const Kernel::V3D &unitVector)
+/**
+  Re-set the line and discard the intersections with the previous line
+  @param point :: Start of the line
+  @param unitVector :: Direction of the line
+*/
+{
+  m_line.setLine(point, unitVector);
+  m_intersectionPointsOut.clear();
+  m_distancesOut.clear();
+}
+
 /**
  * @brief Prune duplicated interception points in the point list
  *
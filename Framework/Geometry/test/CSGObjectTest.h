@@ -591,6 +591,37 @@ public:
     TS_ASSERT_DELTA(1.0, distanceInside, 1e-10);
   }
 
+  void testInterceptSurfacesMatchesInterceptSurfaceForEachTrack() {
+    auto shell = ComponentCreationHelper::createHollowShell(0.5, 1.0);
+    std::vector<Track> batch, single;
+    for (int i = 0; i < 10; ++i) {
+      const V3D start(-2.0, 0.1 * i, 0.05 * i);
+      batch.emplace_back(start, V3D(1, 0, 0));
+      single.emplace_back(start, V3D(1, 0, 0));
+    }
+
+    int expectedSegments(0);
+    for (auto &track : single) {
+      expectedSegments += shell->interceptSurface(track);
+    }
+    TS_ASSERT_EQUALS(expectedSegments, shell->interceptSurfaces(batch));
+    for (size_t i = 0; i < batch.size(); ++i) {
+      TS_ASSERT_EQUALS(single[i].count(), batch[i].count());
+      TS_ASSERT_DELTA(single[i].totalDistInsideObject(), batch[i].totalDistInsideObject(), 1e-10);
+    }
+  }
+
+  void testIsValidFollowsMakeComplement() {
+    auto sphere_ptr = ComponentCreationHelper::createSphere(1.0);
+    CSGObject sphere(*sphere_ptr);
+    TS_ASSERT(sphere.isValid(V3D(0, 0, 0)));
+    TS_ASSERT(!sphere.isValid(V3D(2, 0, 0)));
+
+    sphere.makeComplement();
+    TS_ASSERT(!sphere.isValid(V3D(0, 0, 0)));
+    TS_ASSERT(sphere.isValid(V3D(2, 0, 0)));
+  }
+
   void testFindPointInCube()
   /**
   Test find point in cube
@@ -2167,6 +2198,16 @@ public:
         m_sphere(ComponentCreationHelper::createSphere(0.1)),
         m_sphericalShell(ComponentCreationHelper::createHollowShell(0.009, 0.01)) {}
 
+  void test_interceptSurfaces_Cylinder() {
+    std::vector<Track> tracks;
+    tracks.reserve(m_npoints / 10);
+    for (size_t i = 0; i < m_npoints / 10; ++i) {
+      const double offset = 0.2 * static_cast<double>(i % 100) / 100. - 0.1;
+      tracks.emplace_back(V3D(-1.0, offset, 0.5 * offset), V3D(1, 0, 0));
+    }
+    m_cylinder->interceptSurfaces(tracks);
+  }
+
   void test_generatePointInside_Cuboid_With_ActiveRegion() {
     constexpr size_t maxAttempts{500};
     for (size_t i{0}; i < m_npoints; ++i) {
@@ -0,0 +1,93 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2024 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include "MantidFrameworkTestHelpers/ComponentCreationHelper.h"
+#include "MantidGeometry/Objects/CSGObject.h"
+#include "MantidGeometry/Objects/CompiledRule.h"
+#include "MantidGeometry/Objects/Rules.h"
+#include "MantidGeometry/Objects/ShapeFactory.h"
+#include "MantidKernel/V3D.h"
+
+#include <cxxtest/TestSuite.h>
+
+using namespace Mantid::Geometry;
+using Mantid::Kernel::V3D;
+
+class CompiledRuleTest : public CxxTest::TestSuite {
+public:
+  void test_null_rule_gives_empty_program() {
+    CompiledRule program(nullptr);
+    TS_ASSERT(program.empty());
+    TS_ASSERT_EQUALS(0, program.numberOfSurfaces());
+  }
+
+  void test_capped_cylinder_matches_rule_tree() {
+    auto cylinder = ComponentCreationHelper::createCappedCylinder(0.5, 1.5, V3D(0, -0.75, 0), V3D(0, 1, 0), "cyl");
+    CompiledRule program(cylinder->topRule());
+    TS_ASSERT(!program.empty());
+    TS_ASSERT_EQUALS(3, program.numberOfSurfaces());
+    checkMatchesRuleTree(program, *cylinder->topRule(), 1.0);
+  }
+
+  void test_hollow_shell_complement_matches_rule_tree() {
+    auto shell = ComponentCreationHelper::createHollowShell(0.5, 1.0);
+    CompiledRule program(shell->topRule());
+    TS_ASSERT(!program.empty());
+    TS_ASSERT_EQUALS(2, program.numberOfSurfaces());
+    TS_ASSERT(!program.isValid(V3D(0, 0, 0)));
+    TS_ASSERT(program.isValid(V3D(0.75, 0, 0)));
+    checkMatchesRuleTree(program, *shell->topRule(), 1.2);
+  }
+
+  void test_union_of_spheres_matches_rule_tree() {
+    std::string xmlShape = "<sphere id=\"shape1\"> ";
+    xmlShape += R"(<centre x="0.4"  y="0.0" z="0.0" /> )";
+    xmlShape += "<radius val=\"0.5\" /> ";
+    xmlShape += "</sphere>";
+    xmlShape += "<sphere id=\"shape2\"> ";
+    xmlShape += R"(<centre x="-0.4"  y="0.0" z="0.0" /> )";
+    xmlShape += "<radius val=\"0.5\" /> ";
+    xmlShape += "</sphere>";
+    xmlShape += "<algebra val=\"shape1 : shape2\" /> ";
+    auto shape = ShapeFactory().createShape(xmlShape);
+
+    CompiledRule program(shape->topRule());
+    TS_ASSERT(!program.empty());
+    TS_ASSERT(program.isValid(V3D(0.8, 0, 0)));
+    TS_ASSERT(program.isValid(V3D(-0.8, 0, 0)));
+    TS_ASSERT(!program.isValid(V3D(0, 0.45, 0)));
+    checkMatchesRuleTree(program, *shape->topRule(), 1.0);
+  }
+
+  void test_shared_surface_is_stored_once() {
+    auto sphere = ComponentCreationHelper::createSphere(1.0);
+    // sphere intersected with itself
+    auto left = sphere->topRule()->clone();
+    auto right = sphere->topRule()->clone();
+    Intersection twice(std::move(left), std::move(right));
+
+    CompiledRule program(&twice);
+    TS_ASSERT_EQUALS(1, program.numberOfSurfaces());
+    TS_ASSERT(program.isValid(V3D(0.5, 0, 0)));
+    TS_ASSERT(!program.isValid(V3D(1.5, 0, 0)));
+  }
+
+private:
+  void checkMatchesRuleTree(const CompiledRule &program, const Rule &rule, const double halfWidth) {
+    constexpr int nSteps = 12;
+    const double step = 2.0 * halfWidth / nSteps;
+    for (int i = 0; i <= nSteps; ++i) {
+      for (int j = 0; j <= nSteps; ++j) {
+        for (int k = 0; k <= nSteps; ++k) {
+          const V3D point(-halfWidth + i * step, -halfWidth + j * step, -halfWidth + k * step);
+          TS_ASSERT_EQUALS(rule.isValid(point), program.isValid(point));
+        }
+      }
+    }
+  }
+};
@@ -102,6 +102,33 @@ public:
     do_test_on(*parDet);
   }
 
+  void testPixelTreeIsOrderedAndParented() {
+    auto cuboidShape = ComponentCreationHelper::createCuboid(0.5);
+
+    auto det = std::make_unique<GridDetector>("MyGrid");
+    det->initialize(cuboidShape, 5, -2.5, 1.0, 7, -3.5, 1.0, 3, -1.5, 1.0, 1000000, "zyx", 3, 1);
+
+    TS_ASSERT_EQUALS(det->minDetectorID(), 1000000);
+    TS_ASSERT_EQUALS(det->maxDetectorID(), 1000000 + 5 * 7 * 3 - 1);
+
+    TS_ASSERT_EQUALS(det->nelements(), 3);
+    for (int z = 0; z < det->nelements(); ++z) {
+      auto layer = std::dynamic_pointer_cast<ICompAssembly>(det->getChild(z));
+      TS_ASSERT_EQUALS(layer->nelements(), 5);
+      for (int x = 0; x < layer->nelements(); ++x) {
+        auto column = std::dynamic_pointer_cast<ICompAssembly>(layer->getChild(x));
+        TS_ASSERT_EQUALS(column->getName(), "MyGrid(z=" + std::to_string(z) + ",x=" + std::to_string(x) + ")");
+        TS_ASSERT_EQUALS(column->getParent()->getComponentID(), layer->getComponentID());
+        TS_ASSERT_EQUALS(column->nelements(), 7);
+        for (int y = 0; y < column->nelements(); ++y) {
+          auto pixel = std::dynamic_pointer_cast<IDetector>(column->getChild(y));
+          TS_ASSERT_EQUALS(pixel->getID(), det->getDetectorIDAtXYZ(x, y, z));
+          TS_ASSERT_EQUALS(pixel->getParent()->getComponentID(), column->getComponentID());
+        }
+      }
+    }
+  }
+
   /** Create a parametrized GridDetector with a parameter that
    * resizes it.
    */
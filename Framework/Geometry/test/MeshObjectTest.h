@@ -17,6 +17,7 @@
 #include "MantidKernel/MersenneTwister.h"
 #include "MockRNG.h"
 
+#include <array>
 #include <optional>
 
 #include <cxxtest/TestSuite.h>
@@ -172,6 +173,40 @@ std::unique_ptr<MeshObject> createLShape() {
       std::make_unique<MeshObject>(std::move(triangles), std::move(vertices), Mantid::Kernel::Material());
   return retVal;
 }
+std::unique_ptr<MeshObject> createTessellatedCube(const double size, const size_t divisions) {
+  /**
+   * Create a cube of side length size occupying [0, size] on each axis, each
+   * face being split into divisions x divisions squares of two triangles.
+   */
+  // origin and in-plane axes of each face, ordered so that the triangles
+  // are anticlockwise when viewed from outside
+  const std::vector<std::array<V3D, 3>> faces = {
+      {V3D(0, 0, size), V3D(1, 0, 0), V3D(0, 1, 0)}, {V3D(0, 0, 0), V3D(0, 1, 0), V3D(1, 0, 0)},
+      {V3D(size, 0, 0), V3D(0, 1, 0), V3D(0, 0, 1)}, {V3D(0, 0, 0), V3D(0, 0, 1), V3D(0, 1, 0)},
+      {V3D(0, size, 0), V3D(0, 0, 1), V3D(1, 0, 0)}, {V3D(0, 0, 0), V3D(1, 0, 0), V3D(0, 0, 1)}};
+  const double step = size / static_cast<double>(divisions);
+  const auto rowLength = static_cast<uint32_t>(divisions + 1);
+
+  std::vector<V3D> vertices;
+  std::vector<uint32_t> triangles;
+  for (const auto &face : faces) {
+    const auto first = static_cast<uint32_t>(vertices.size());
+    for (size_t j = 0; j <= divisions; ++j) {
+      for (size_t i = 0; i <= divisions; ++i) {
+        vertices.emplace_back(face[0] + face[1] * (step * static_cast<double>(i)) +
+                              face[2] * (step * static_cast<double>(j)));
+      }
+    }
+    for (uint32_t j = 0; j < divisions; ++j) {
+      for (uint32_t i = 0; i < divisions; ++i) {
+        const uint32_t corner = first + j * rowLength + i;
+        triangles.insert(triangles.end(), {corner, corner + 1, corner + rowLength + 1});
+        triangles.insert(triangles.end(), {corner, corner + rowLength + 1, corner + rowLength});
+      }
+    }
+  }
+  return std::make_unique<MeshObject>(std::move(triangles), std::move(vertices), Mantid::Kernel::Material());
+}
 } // namespace
 
 class MeshObjectTest : public CxxTest::TestSuite {
@@ -366,6 +401,46 @@ public:
     checkTrackIntercept(std::move(geom_obj), track, expectedResults);
   }
 
+  void testInterceptTessellatedCubeMatchesCube() {
+    // A ray crossing the tessellated cube obliquely should see the same
+    // entry and exit points as the 12 triangle cube
+    const V3D start(-1.0, 0.3613, 0.6171);
+    V3D direction(1.0, 0.13, -0.07);
+    direction.normalize();
+    Track coarseTrack(start, direction);
+    Track fineTrack(start, direction);
+    auto coarse = createCube(1.0);
+    auto fine = createTessellatedCube(1.0, 20);
+
+    TS_ASSERT_EQUALS(coarse->interceptSurface(coarseTrack), 1);
+    TS_ASSERT_EQUALS(fine->interceptSurface(fineTrack), 1);
+    TS_ASSERT_DELTA(fineTrack.front().distFromStart, coarseTrack.front().distFromStart, 1e-10);
+    TS_ASSERT_DELTA(fineTrack.front().distInsideObject, coarseTrack.front().distInsideObject, 1e-10);
+    TS_ASSERT_DELTA(fine->distance(fineTrack), coarse->distance(coarseTrack), 1e-10);
+  }
+
+  void testIsValidTessellatedCube() {
+    auto geom_obj = createTessellatedCube(1.0, 20);
+    TS_ASSERT_EQUALS(geom_obj->isValid(V3D(0.512, 0.537, 0.5)), true);
+    TS_ASSERT_EQUALS(geom_obj->isValid(V3D(0.013, 0.987, 0.501)), true);
+    TS_ASSERT_EQUALS(geom_obj->isValid(V3D(1.013, 0.5, 0.5)), false);
+    TS_ASSERT_EQUALS(geom_obj->isValid(V3D(0.5, -0.013, 0.5)), false);
+    TS_ASSERT_EQUALS(geom_obj->isOnSide(V3D(0.33, 1.0, 0.77)), true);
+    TS_ASSERT_EQUALS(geom_obj->isOnSide(V3D(0.33, 0.52, 0.77)), false);
+  }
+
+  void testInterceptAfterTranslationUsesMovedTriangles() {
+    auto geom_obj = createTessellatedCube(1.0, 10);
+    geom_obj->translate(V3D(3.0, 0.0, 0.0));
+    TS_ASSERT_EQUALS(geom_obj->isValid(V3D(0.51, 0.52, 0.53)), false);
+    TS_ASSERT_EQUALS(geom_obj->isValid(V3D(3.51, 0.52, 0.53)), true);
+
+    Track track(V3D(0.0, 0.52, 0.53), V3D(1, 0, 0));
+    TS_ASSERT_EQUALS(geom_obj->interceptSurface(track), 1);
+    TS_ASSERT_DELTA(track.front().entryPoint.X(), 3.0, 1e-10);
+    TS_ASSERT_DELTA(track.front().exitPoint.X(), 4.0, 1e-10);
+  }
+
   void testDistanceWithIntersectionReturnsResult() {
     auto geom_obj = createCube(3);
     V3D dir(0., 1., 0.);
@@ -912,7 +987,8 @@ public:
   static void destroySuite(MeshObjectTestPerformance *suite) { delete suite; }
 
   MeshObjectTestPerformance()
-      : rng(200000), octahedron(createOctahedron()), lShape(createLShape()), smallCube(createCube(0.2)) {
+      : rng(200000), octahedron(createOctahedron()), lShape(createLShape()), smallCube(createCube(0.2)),
+        largeMesh(createTessellatedCube(1.0, 130)) {
     testPoints = create_test_points();
     testRays = create_test_rays();
     translation = create_translation_vector();
@@ -963,6 +1039,22 @@ public:
     }
   }
 
+  void test_interceptSurface_large_mesh() {
+    // Roughly 200k triangles, the size of a typical STL sample environment
+    const size_t number(10000);
+    for (size_t i = 0; i < number; ++i) {
+      Track ray(testRays[i % testRays.size()]);
+      largeMesh->interceptSurface(ray);
+    }
+  }
+
+  void test_isValid_large_mesh() {
+    const size_t number(10000);
+    for (size_t i = 0; i < number; ++i) {
+      largeMesh->isValid(testPoints[i % testPoints.size()]);
+    }
+  }
+
   void test_solid_angle() {
     const size_t number(10000);
     for (size_t i = 0; i < number; ++i) {
@@ -1087,6 +1179,7 @@ private:
   std::unique_ptr<MeshObject> octahedron;
   std::unique_ptr<MeshObject> lShape;
   std::unique_ptr<MeshObject> smallCube;
+  std::unique_ptr<MeshObject> largeMesh;
   std::vector<V3D> testPoints;
   std::vector<Track> testRays;
   V3D translation;
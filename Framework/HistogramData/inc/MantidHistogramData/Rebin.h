@@ -6,12 +6,43 @@
 // SPDX - License - Identifier: GPL - 3.0 +
 #pragma once
 
+#include "MantidHistogramData/BinEdges.h"
 #include "MantidHistogramData/DllConfig.h"
+
+#include <vector>
+
 namespace Mantid {
 namespace HistogramData {
 class Histogram;
-class BinEdges;
 
 MANTID_HISTOGRAMDATA_DLL Histogram rebin(const Histogram &input, const BinEdges &binEdges);
+
+/** RebinWeights : The overlaps between a fixed set of input bin edges and a
+  set of output bin edges, stored as a sparse matrix with one row per output
+  bin. Rebinning the many histograms of a workspace that share their bin edges
+  then reduces to a sparse matrix-vector product per histogram instead of a
+  walk over both sets of edges.
+*/
+class MANTID_HISTOGRAMDATA_DLL RebinWeights {
+public:
+  RebinWeights(const BinEdges &oldEdges, const BinEdges &binEdges);
+
+  bool appliesTo(const Histogram &input) const;
+  Histogram apply(const Histogram &input) const;
+
+private:
+  BinEdges m_oldEdges;
+  BinEdges m_binEdges;
+  /// Index of the first overlap of each output bin, plus the total count
+  std::vector<size_t> m_rowStart;
+  /// Input bin of each overlap
+  std::vector<size_t> m_oldIndex;
+  /// Overlap as a fraction of the input bin width, used for counts
+  std::vector<double> m_fraction;
+  /// Overlap width, used for frequencies
+  std::vector<double> m_overlap;
+  /// Overlap width times input bin width, used for frequency errors
+  std::vector<double> m_overlapTimesWidth;
+};
 } // namespace HistogramData
 } // namespace Mantid
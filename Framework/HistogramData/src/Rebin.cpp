@@ -21,19 +21,17 @@ using Mantid::HistogramData::Histogram;
 using Mantid::HistogramData::Exception::InvalidBinEdgesError;
 
 namespace {
-Histogram rebinCounts(const Histogram &input, const BinEdges &binEdges) {
-  const auto &xold = input.x();
-  const auto &yold = input.y();
-  const auto &eold = input.e();
-
-  const auto &xnew = binEdges.rawData();
-  Counts newCounts(xnew.size() - 1);
-  CountVariances newCountVariances(xnew.size() - 1);
-  auto &ynew = newCounts.mutableData();
-  auto &enew = newCountVariances.mutableData();
-
-  const auto size_yold = yold.size();
-  const auto size_ynew = ynew.size();
+/**
+ * Walk the overlapping parts of an old and a new set of bin edges, calling
+ * onOverlap(iold, inew, delta, owidth) for each pair of bins that overlap
+ * with delta the width of the overlap and owidth the width of the old bin.
+ * Overlaps are visited in order of increasing new bin index.
+ * @throws InvalidBinEdgesError for non-positive bin widths
+ */
+template <class OverlapFunction>
+void forEachOverlap(const std::vector<double> &xold, const std::vector<double> &xnew, OverlapFunction &&onOverlap) {
+  const auto size_yold = xold.size() < 2 ? 0 : xold.size() - 1;
+  const auto size_ynew = xnew.size() < 2 ? 0 : xnew.size() - 1;
   size_t iold = 0;
   size_t inew = 0;
 
@@ -65,8 +63,7 @@ Histogram rebinCounts(const Histogram &input, const BinEdges &binEdges) {
       auto delta = xo_high < xn_high ? xo_high : xn_high;
       delta -= xo_low > xn_low ? xo_low : xn_low;
 
-      ynew[inew] += yold[iold] * delta / owidth;
-      enew[inew] += eold[iold] * eold[iold] * delta / owidth;
+      onOverlap(iold, inew, delta, owidth);
 
       if (xn_high > xo_high) {
         iold++;
@@ -75,12 +72,28 @@ Histogram rebinCounts(const Histogram &input, const BinEdges &binEdges) {
       }
     }
   }
+}
+
+Histogram rebinCounts(const Histogram &input, const BinEdges &binEdges) {
+  const auto &yold = input.y();
+  const auto &eold = input.e();
+
+  const auto &xnew = binEdges.rawData();
+  Counts newCounts(xnew.size() - 1);
+  CountVariances newCountVariances(xnew.size() - 1);
+  auto &ynew = newCounts.mutableData();
+  auto &enew = newCountVariances.mutableData();
+
+  forEachOverlap(input.x().rawData(), xnew,
+                 [&](const size_t iold, const size_t inew, const double delta, const double owidth) {
+                   ynew[inew] += yold[iold] * delta / owidth;
+                   enew[inew] += eold[iold] * eold[iold] * delta / owidth;
+                 });
 
   return Histogram(binEdges, newCounts, CountStandardDeviations(std::move(newCountVariances)));
 }
 
 Histogram rebinFrequencies(const Histogram &input, const BinEdges &binEdges) {
-  const auto &xold = input.x();
   const auto &yold = input.y();
   const auto &eold = input.e();
 
@@ -90,44 +103,13 @@ Histogram rebinFrequencies(const Histogram &input, const BinEdges &binEdges) {
   auto &ynew = newFrequencies.mutableData();
   auto &enew = newFrequencyStdDev.mutableData();
 
-  const auto size_yold = yold.size();
-  const auto size_ynew = ynew.size();
-  size_t iold = 0;
-  size_t inew = 0;
-
-  while ((inew < size_ynew) && (iold < size_yold)) {
-    const auto xo_low = xold[iold];
-    const auto xo_high = xold[iold + 1];
-    const auto xn_low = xnew[inew];
-    const auto xn_high = xnew[inew + 1];
-
-    const auto owidth = xo_high - xo_low;
-    const auto nwidth = xn_high - xn_low;
-
-    if (owidth <= 0.0 || nwidth <= 0.0)
-      throw InvalidBinEdgesError("Negative or zero bin widths not allowed.");
-
-    if (xn_high <= xo_low)
-      inew++; /* old and new bins do not overlap */
-    else if (xo_high <= xn_low)
-      iold++; /* old and new bins do not overlap */
-    else {
-      //        delta is the overlap of the bins on the x axis
-      auto delta = xo_high < xn_high ? xo_high : xn_high;
-      delta -= xo_low > xn_low ? xo_low : xn_low;
-
-      ynew[inew] += yold[iold] * delta;
-      enew[inew] += eold[iold] * eold[iold] * delta * owidth;
-
-      if (xn_high > xo_high) {
-        iold++;
-      } else {
-        inew++;
-      }
-    }
-  }
+  forEachOverlap(input.x().rawData(), xnew,
+                 [&](const size_t iold, const size_t inew, const double delta, const double owidth) {
+                   ynew[inew] += yold[iold] * delta;
+                   enew[inew] += eold[iold] * eold[iold] * delta * owidth;
+                 });
 
-  for (size_t i = 0; i < size_ynew; ++i) {
+  for (size_t i = 0; i < ynew.size(); ++i) {
     const auto width = xnew[i + 1] - xnew[i];
     const auto factor = 1 / width;
     ynew[i] *= factor;
@@ -136,6 +118,13 @@ Histogram rebinFrequencies(const Histogram &input, const BinEdges &binEdges) {
 
   return Histogram(binEdges, newFrequencies, newFrequencyStdDev);
 }
+
+void checkRebinnable(const Histogram &input) {
+  if (input.xMode() != Histogram::XMode::BinEdges)
+    throw std::runtime_error("XMode must be Histogram::XMode::BinEdges for input histogram");
+  if (input.yMode() != Histogram::YMode::Counts && input.yMode() != Histogram::YMode::Frequencies)
+    throw std::runtime_error("YMode must be defined for input histogram.");
+}
 } // anonymous namespace
 
 namespace Mantid::HistogramData {
@@ -148,14 +137,100 @@ namespace Mantid::HistogramData {
  * the input yMode is undefined, or for non-positive input/output bin widths
  */
 Histogram rebin(const Histogram &input, const BinEdges &binEdges) {
-  if (input.xMode() != Histogram::XMode::BinEdges)
-    throw std::runtime_error("XMode must be Histogram::XMode::BinEdges for input histogram");
+  checkRebinnable(input);
   if (input.yMode() == Histogram::YMode::Counts)
     return rebinCounts(input, binEdges);
-  else if (input.yMode() == Histogram::YMode::Frequencies)
-    return rebinFrequencies(input, binEdges);
   else
-    throw std::runtime_error("YMode must be defined for input histogram.");
+    return rebinFrequencies(input, binEdges);
+}
+
+/** Computes the overlaps of each bin in oldEdges with the bins in binEdges.
+ * @param oldEdges :: bin edges of the histograms that will be rebinned.
+ * @param binEdges :: the histograms will be rebinned according to this set of
+ * bin edges.
+ * @throws InvalidBinEdgesError for non-positive input/output bin widths
+ */
+RebinWeights::RebinWeights(const BinEdges &oldEdges, const BinEdges &binEdges)
+    : m_oldEdges(oldEdges), m_binEdges(binEdges), m_rowStart(binEdges.size() < 2 ? 1 : binEdges.size(), 0) {
+  const auto &xnew = binEdges.rawData();
+  forEachOverlap(oldEdges.rawData(), xnew,
+                 [this](const size_t iold, const size_t inew, const double delta, const double owidth) {
+                   m_rowStart[inew + 1] = m_oldIndex.size() + 1;
+                   m_oldIndex.emplace_back(iold);
+                   m_fraction.emplace_back(delta / owidth);
+                   m_overlap.emplace_back(delta);
+                   m_overlapTimesWidth.emplace_back(delta * owidth);
+                 });
+  // New bins without any overlap start where the previous one ended
+  for (size_t i = 1; i < m_rowStart.size(); ++i)
+    m_rowStart[i] = std::max(m_rowStart[i], m_rowStart[i - 1]);
+}
+
+/** Checks whether a histogram has the bin edges these weights were computed
+ * for, either by sharing them or by having identical values.
+ * @param input :: a histogram to rebin.
+ * @returns True if apply() can be used on the histogram.
+ */
+bool RebinWeights::appliesTo(const Histogram &input) const {
+  const auto inputX = input.sharedX();
+  if (inputX == m_oldEdges.cowData())
+    return true;
+  return input.xMode() == Histogram::XMode::BinEdges && inputX->rawData() == m_oldEdges.rawData();
+}
+
+/** Rebins a histogram using the precomputed weights. The result is the same,
+ * up to rounding, as calling rebin(input, binEdges).
+ * @param input :: input histogram data to be rebinned. It must have the bin
+ * edges the weights were computed for, see appliesTo().
+ * @returns The rebinned histogram.
+ * @throws std::runtime_error if the input histogram xmode is not BinEdges,
+ * the input yMode is undefined, or the input has a different number of bins
+ */
+Histogram RebinWeights::apply(const Histogram &input) const {
+  checkRebinnable(input);
+  if (input.x().size() != m_oldEdges.size())
+    throw std::runtime_error("Input histogram does not have the bin edges the rebin weights were computed for.");
+  const auto &yold = input.y().rawData();
+  const auto &eold = input.e().rawData();
+  const size_t nBins = m_rowStart.size() - 1;
+
+  if (input.yMode() == Histogram::YMode::Counts) {
+    Counts newCounts(nBins);
+    CountVariances newCountVariances(nBins);
+    auto &ynew = newCounts.mutableRawData();
+    auto &enew = newCountVariances.mutableRawData();
+    for (size_t inew = 0; inew < nBins; ++inew) {
+      double y = 0.;
+      double e = 0.;
+      for (size_t k = m_rowStart[inew]; k < m_rowStart[inew + 1]; ++k) {
+        const auto iold = m_oldIndex[k];
+        y += yold[iold] * m_fraction[k];
+        e += eold[iold] * eold[iold] * m_fraction[k];
+      }
+      ynew[inew] = y;
+      enew[inew] = e;
+    }
+    return Histogram(m_binEdges, newCounts, CountStandardDeviations(std::move(newCountVariances)));
+  }
+
+  Frequencies newFrequencies(nBins);
+  FrequencyStandardDeviations newFrequencyStdDev(nBins);
+  auto &ynew = newFrequencies.mutableRawData();
+  auto &enew = newFrequencyStdDev.mutableRawData();
+  const auto &xnew = m_binEdges.rawData();
+  for (size_t inew = 0; inew < nBins; ++inew) {
+    double y = 0.;
+    double e = 0.;
+    for (size_t k = m_rowStart[inew]; k < m_rowStart[inew + 1]; ++k) {
+      const auto iold = m_oldIndex[k];
+      y += yold[iold] * m_overlap[k];
+      e += eold[iold] * eold[iold] * m_overlapTimesWidth[k];
+    }
+    const auto factor = 1 / (xnew[inew + 1] - xnew[inew]);
+    ynew[inew] = y * factor;
+    enew[inew] = sqrt(e) * factor;
+  }
+  return Histogram(m_binEdges, newFrequencies, newFrequencyStdDev);
 }
 
 } // namespace Mantid::HistogramData
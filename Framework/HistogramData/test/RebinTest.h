@@ -11,6 +11,7 @@
 #include "MantidHistogramData/Exception.h"
 #include "MantidHistogramData/Histogram.h"
 #include "MantidHistogramData/LinearGenerator.h"
+#include "MantidHistogramData/LogarithmicGenerator.h"
 #include "MantidHistogramData/Rebin.h"
 
 #include <algorithm>
@@ -353,7 +354,60 @@ public:
     TS_ASSERT_EQUALS(outFreq.e()[2], 0);
   }
 
+  void testRebinWeightsMatchRebinLinearBins() {
+    const BinEdges edges{0.5, 1.5, 2.25, 2.75, 4, 7.5, 8, 12};
+    checkRebinWeightsMatchRebin(getCountsHistogram(), edges);
+    checkRebinWeightsMatchRebin(getFrequencyHistogram(), edges);
+  }
+
+  void testRebinWeightsMatchRebinLogarithmicBins() {
+    const BinEdges edges(12, LogarithmicGenerator(0.1, 0.5));
+    checkRebinWeightsMatchRebin(getCountsHistogram(), edges);
+    checkRebinWeightsMatchRebin(getFrequencyHistogram(), edges);
+  }
+
+  void testRebinWeightsMatchRebinWithEmptyOutputBins() {
+    const BinEdges edges{-3, -2, -1, 0.5, 0.6, 0.7, 20, 21};
+    checkRebinWeightsMatchRebin(getCountsHistogram(), edges);
+    checkRebinWeightsMatchRebin(getFrequencyHistogram(), edges);
+  }
+
+  void testRebinWeightsAppliesToHistogramsWithSameBinEdges() {
+    const auto hist = getCountsHistogram();
+    const RebinWeights weights(hist.binEdges(), BinEdges(10, LinearGenerator(0, 0.5)));
+    TS_ASSERT(weights.appliesTo(hist));
+    // Same values but not shared
+    TS_ASSERT(weights.appliesTo(Histogram(BinEdges(10, LinearGenerator(0, 1)), Counts(9, 1.))));
+    TS_ASSERT(!weights.appliesTo(Histogram(BinEdges(10, LinearGenerator(0, 1.5)), Counts(9, 1.))));
+    TS_ASSERT(!weights.appliesTo(Histogram(BinEdges(11, LinearGenerator(0, 1)), Counts(10, 1.))));
+  }
+
+  void testRebinWeightsFailsForWrongNumberOfBins() {
+    const RebinWeights weights(BinEdges{0, 1, 2}, BinEdges{0, 2});
+    TS_ASSERT_THROWS(weights.apply(getCountsHistogram()), const std::runtime_error &);
+  }
+
+  void testRebinWeightsFailsBinEdgesInvalid() {
+    const BinEdges edges{1, 2, 3, 3, 5, 7};
+    TS_ASSERT_THROWS(RebinWeights(getCountsHistogram().binEdges(), edges), const InvalidBinEdgesError &);
+    const BinEdges oldEdges{0, 1, 1, 2};
+    TS_ASSERT_THROWS(RebinWeights(oldEdges, BinEdges{0, 2}), const InvalidBinEdgesError &);
+  }
+
 private:
+  void checkRebinWeightsMatchRebin(const Histogram &hist, const BinEdges &edges) {
+    const auto expected = rebin(hist, edges);
+    const RebinWeights weights(hist.binEdges(), edges);
+    const auto result = weights.apply(hist);
+    TS_ASSERT_EQUALS(result.yMode(), expected.yMode());
+    TS_ASSERT_EQUALS(result.x().rawData(), expected.x().rawData());
+    TS_ASSERT_EQUALS(result.y().size(), expected.y().size());
+    for (size_t i = 0; i < expected.y().size(); ++i) {
+      TS_ASSERT_DELTA(result.y()[i], expected.y()[i], 1e-12);
+      TS_ASSERT_DELTA(result.e()[i], expected.e()[i], 1e-12);
+    }
+  }
+
   Histogram getCountsHistogram() {
     return Histogram(BinEdges(10, LinearGenerator(0, 1)), Counts{10.5, 11.2, 19.3, 25.4, 36.8, 40.3, 17.7, 9.3, 4.6},
                      CountStandardDeviations{3.2404, 3.3466, 4.3932, 5.0398, 6.0663, 6.3482, 4.2071, 3.0496, 2.1448});
@@ -399,6 +453,18 @@ public:
       rebin(histFreq, lgBins);
   }
 
+  void testRebinWeightsCountsSmallerBins() {
+    const RebinWeights weights(hist.binEdges(), smBins);
+    for (size_t i = 0; i < nIters; i++)
+      weights.apply(hist);
+  }
+
+  void testRebinWeightsCountsLargerBins() {
+    const RebinWeights weights(hist.binEdges(), lgBins);
+    for (size_t i = 0; i < nIters; i++)
+      weights.apply(hist);
+  }
+
 private:
   const size_t binSize = 10000;
   const size_t nIters = 10000;
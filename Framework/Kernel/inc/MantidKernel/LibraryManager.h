@@ -9,6 +9,8 @@
 //----------------------------------------------------------------------
 // Includes
 //----------------------------------------------------------------------
+#include <map>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -35,6 +37,20 @@ public:
   enum LoadLibraries { Recursive, NonRecursive };
   int openLibraries(const std::string &libpath, LoadLibraries loadingBehaviour,
                     const std::vector<std::string> &excludes);
+  /// Register the libraries listed in a plugin manifest to be opened on first use
+  std::vector<std::string> deferLibraries(const std::string &manifestPath, const std::vector<std::string> &excludes);
+  /// Open the deferred library providing the named object of the given kind
+  bool openDeferredLibrary(const std::string &kind, const std::string &name);
+  /// Open all deferred libraries, optionally only those providing the given kind
+  int openDeferredLibraries(const std::string &kind = "");
+  /// Open the deferred libraries providing one kind of object but not listing another
+  int openDeferredLibraries(const std::string &kind, const std::string &unlessKind);
+  /// The names and details of the objects of a kind that deferred libraries provide
+  std::vector<std::pair<std::string, std::string>> deferredEntries(const std::string &kind) const;
+  /// Returns true if there are libraries waiting to be opened on first use
+  bool hasDeferredLibraries() const;
+  /// Returns true if the named library is waiting to be opened on first use
+  bool isDeferred(const std::string &filename) const;
   LibraryManagerImpl(const LibraryManagerImpl &) = delete;
   LibraryManagerImpl &operator=(const LibraryManagerImpl &) = delete;
 
@@ -59,8 +75,29 @@ private:
   /// Load a given library
   int openLibrary(const Poco::File &filepath, const std::string &cacheKey);
 
+  /// Open a single deferred library
+  int openDeferred(const std::string &filename);
+  /// Open several deferred libraries
+  int openDeferred(const std::vector<std::string> &filenames);
+
   /// Storage for the LibraryWrappers.
   std::unordered_map<std::string, LibraryWrapper> m_openedLibs;
+
+  /// A library listed in a plugin manifest that has not been opened yet
+  struct DeferredLibrary {
+    /// Full path to the library
+    std::string path;
+    /// The name and details of each object the library provides, by kind
+    /// (Algorithm, Function, ...)
+    std::map<std::string, std::vector<std::pair<std::string, std::string>>> entries;
+  };
+  /// Deferred libraries keyed by their filename
+  std::unordered_map<std::string, DeferredLibrary> m_deferredLibs;
+  /// Map of "kind/name" to the filename of the library providing it
+  std::unordered_map<std::string, std::string> m_providers;
+  /// Guards the deferred library state. Recursive as opening a library runs
+  /// static registrations that may query the factories again.
+  mutable std::recursive_mutex m_mutex;
 };
 
 EXTERN_MANTID_KERNEL template class MANTID_KERNEL_DLL Mantid::Kernel::SingletonHolder<LibraryManagerImpl>;
@@ -16,6 +16,7 @@
 #include <vector>
 #ifndef Q_MOC_RUN
 #include <memory>
+#include <span>
 #endif
 
 #include "tbb/concurrent_unordered_map.h"
@@ -137,6 +138,19 @@ public:
    */
   virtual double singleFromTOF(const double tof) const = 0;
 
+  /** Convert a block of X values to TOF in place. The unit must have been
+   * initialized. Units with a closed-form conversion override this so that
+   * the whole block is converted without a virtual call per value.
+   * @param values :: the values to convert
+   */
+  virtual void convertToTOF(std::span<double> values) const;
+
+  /** Convert a block of tof values to this unit in place. The unit must have
+   * been initialized.
+   * @param values :: the values to convert
+   */
+  virtual void convertFromTOF(std::span<double> values) const;
+
   /// @return true if the unit was initialized and so can use singleToTOF()
   bool isInitialized() const { return initialized; }
 
@@ -255,6 +269,8 @@ public:
   void init() override;
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  void convertToTOF(std::span<double> values) const override;
+  void convertFromTOF(std::span<double> values) const override;
   Unit *clone() const override;
   ///@return -DBL_MAX as ToF convertible to TOF for in any time range
   double conversionTOFMin() const override;
@@ -272,6 +288,8 @@ public:
 
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  void convertToTOF(std::span<double> values) const override;
+  void convertFromTOF(std::span<double> values) const override;
   void init() override;
   Unit *clone() const override;
 
@@ -355,6 +373,8 @@ public:
   const UnitLabel label() const override;
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  void convertToTOF(std::span<double> values) const override;
+  void convertFromTOF(std::span<double> values) const override;
   void init() override;
   Unit *clone() const override;
   double conversionTOFMin() const override;
@@ -410,6 +430,8 @@ public:
 
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  void convertToTOF(std::span<double> values) const override;
+  void convertFromTOF(std::span<double> values) const override;
   void init() override;
   Unit *clone() const override;
   double conversionTOFMin() const override;
@@ -432,6 +454,8 @@ public:
 
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  void convertToTOF(std::span<double> values) const override;
+  void convertFromTOF(std::span<double> values) const override;
   Unit *clone() const override;
   double conversionTOFMin() const override;
   double conversionTOFMax() const override;
@@ -450,6 +474,8 @@ public:
 
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  void convertToTOF(std::span<double> values) const override;
+  void convertFromTOF(std::span<double> values) const override;
   void init() override;
   Unit *clone() const override;
 
@@ -539,6 +565,8 @@ public:
 
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  void convertToTOF(std::span<double> values) const override;
+  void convertFromTOF(std::span<double> values) const override;
   void init() override;
   Unit *clone() const override;
   double conversionTOFMin() const override;
@@ -561,6 +589,8 @@ public:
 
   double singleToTOF(const double x) const override;
   double singleFromTOF(const double tof) const override;
+  void convertToTOF(std::span<double> values) const override;
+  void convertFromTOF(std::span<double> values) const override;
   void init() override;
   Unit *clone() const override;
   double conversionTOFMin() const override;
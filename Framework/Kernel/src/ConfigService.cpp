@@ -131,6 +131,7 @@ ConfigServiceImpl::ConfigServiceImpl()
   setBaseDirectory();
 
   m_configPaths.insert("framework.plugins.directory");
+  m_configPaths.insert("framework.plugins.manifest");
   m_configPaths.insert("mantidqt.plugins.directory");
   m_configPaths.insert("instrumentDefinition.directory");
   m_configPaths.insert("instrumentDefinition.vtpDirectory");
@@ -15,10 +15,16 @@
 #include <Poco/Path.h>
 #include <boost/algorithm/string.hpp>
 
+#include <fstream>
+#include <sstream>
+
 namespace Mantid::Kernel {
 namespace {
 /// static logger
 Logger g_log("LibraryManager");
+
+/// Key identifying an object provided by a deferred library
+std::string providerKey(const std::string &kind, const std::string &name) { return kind + "/" + name; }
 } // namespace
 
 /// Constructor
@@ -36,6 +42,7 @@ LibraryManagerImpl::LibraryManagerImpl() : m_openedLibs() { g_log.debug("Library
 int LibraryManagerImpl::openLibraries(const std::string &filepath, LoadLibraries loadingBehaviour,
                                       const std::vector<std::string> &excludes) {
   g_log.debug("Opening all libraries in " + filepath + "\n");
+  std::lock_guard<std::recursive_mutex> lock(m_mutex);
   try {
     return openLibraries(Poco::File(filepath), loadingBehaviour, excludes);
   } catch (std::exception &exc) {
@@ -47,6 +54,148 @@ int LibraryManagerImpl::openLibraries(const std::string &filepath, LoadLibraries
   }
 }
 
+/**
+ * Register the libraries listed in a plugin manifest so that they are opened
+ * on first use rather than immediately. Each line of the manifest has the form
+ * "<library filename> <kind> <name>", e.g. "libMantidAlgorithms.so Algorithm
+ * Rebin", stating that opening the library registers the named object with the
+ * factory for that kind. Anything after the name is kept as the details of the
+ * entry, e.g. what a factory needs to list the object without opening the
+ * library, see deferredEntries. Library filenames are relative to the
+ * directory containing the manifest. Blank lines and lines starting with # are
+ * ignored.
+ *  @param manifestPath The full path to the manifest file
+ *  @param excludes If not empty then each string is considered as a substring
+ * to search within each library listed. If the substring is found then
+ * the library is not registered.
+ *  @return The filenames of the libraries that will be opened on first use
+ */
+std::vector<std::string> LibraryManagerImpl::deferLibraries(const std::string &manifestPath,
+                                                            const std::vector<std::string> &excludes) {
+  std::ifstream manifest(manifestPath);
+  if (!manifest) {
+    g_log.debug("Unable to read plugin manifest " + manifestPath + "\n");
+    return {};
+  }
+  const Poco::Path libDir = Poco::Path(manifestPath).parent();
+
+  std::lock_guard<std::recursive_mutex> lock(m_mutex);
+  std::vector<std::string> deferred;
+  std::string line;
+  while (std::getline(manifest, line)) {
+    boost::trim(line);
+    if (line.empty() || line.front() == '#')
+      continue;
+    std::istringstream entry(line);
+    std::string filename, kind, name, details;
+    if (!(entry >> filename >> kind >> name)) {
+      g_log.warning("Ignoring malformed line in plugin manifest " + manifestPath + ": '" + line + "'\n");
+      continue;
+    }
+    auto lib = m_deferredLibs.find(filename);
+    if (lib == m_deferredLibs.end()) {
+      if (!shouldBeLoaded(filename, excludes))
+        continue;
+      const std::string path = Poco::Path(libDir, filename).toString();
+      if (!Poco::File(path).exists())
+        continue;
+      lib = m_deferredLibs.emplace(filename, DeferredLibrary{path, {}}).first;
+      deferred.emplace_back(filename);
+    }
+    std::getline(entry, details);
+    boost::trim(details);
+    lib->second.entries[kind].emplace_back(name, details);
+    m_providers.emplace(providerKey(kind, name), filename);
+  }
+  g_log.debug() << "Deferred loading of " << deferred.size() << " libraries listed in " << manifestPath << "\n";
+  return deferred;
+}
+
+/**
+ * Open the deferred library that provides the named object. If no deferred
+ * library is known to provide it, e.g. the name is an alias, all deferred
+ * libraries are opened so that the caller sees the complete set of objects.
+ *  @param kind The kind of object, e.g. Algorithm or Function
+ *  @param name The name the object is registered under in its factory
+ *  @return True if any library was opened
+ */
+bool LibraryManagerImpl::openDeferredLibrary(const std::string &kind, const std::string &name) {
+  std::lock_guard<std::recursive_mutex> lock(m_mutex);
+  if (m_deferredLibs.empty())
+    return false;
+  const auto provider = m_providers.find(providerKey(kind, name));
+  if (provider != m_providers.end() && m_deferredLibs.count(provider->second) > 0)
+    return openDeferred(provider->second) > 0;
+  return openDeferredLibraries() > 0;
+}
+
+/**
+ * Open all of the deferred libraries.
+ *  @param kind If not empty only the libraries that provide objects of this
+ * kind are opened
+ *  @return The number of libraries opened
+ */
+int LibraryManagerImpl::openDeferredLibraries(const std::string &kind) {
+  std::lock_guard<std::recursive_mutex> lock(m_mutex);
+  std::vector<std::string> filenames;
+  for (const auto &lib : m_deferredLibs) {
+    if (kind.empty() || lib.second.entries.count(kind) > 0)
+      filenames.emplace_back(lib.first);
+  }
+  return openDeferred(filenames);
+}
+
+/**
+ * Open the deferred libraries that provide objects of one kind but list no
+ * entries of another, e.g. the libraries providing algorithms whose manifest
+ * entries do not carry what is needed to list them.
+ *  @param kind Only the libraries that provide objects of this kind are opened
+ *  @param unlessKind Libraries that list entries of this kind are not opened
+ *  @return The number of libraries opened
+ */
+int LibraryManagerImpl::openDeferredLibraries(const std::string &kind, const std::string &unlessKind) {
+  std::lock_guard<std::recursive_mutex> lock(m_mutex);
+  std::vector<std::string> filenames;
+  for (const auto &lib : m_deferredLibs) {
+    if (lib.second.entries.count(kind) > 0 && lib.second.entries.count(unlessKind) == 0)
+      filenames.emplace_back(lib.first);
+  }
+  return openDeferred(filenames);
+}
+
+/**
+ * @param kind The kind of object, e.g. Algorithm
+ * @return The name and details, see deferLibraries, of each object of the
+ * given kind provided by a library that has not been opened yet
+ */
+std::vector<std::pair<std::string, std::string>> LibraryManagerImpl::deferredEntries(const std::string &kind) const {
+  std::lock_guard<std::recursive_mutex> lock(m_mutex);
+  std::vector<std::pair<std::string, std::string>> entries;
+  for (const auto &lib : m_deferredLibs) {
+    const auto ofKind = lib.second.entries.find(kind);
+    if (ofKind != lib.second.entries.cend())
+      entries.insert(entries.end(), ofKind->second.cbegin(), ofKind->second.cend());
+  }
+  return entries;
+}
+
+/**
+ * @return True if there are libraries waiting to be opened on first use
+ */
+bool LibraryManagerImpl::hasDeferredLibraries() const {
+  std::lock_guard<std::recursive_mutex> lock(m_mutex);
+  return !m_deferredLibs.empty();
+}
+
+/**
+ * @param filename The filename of a library, i.e no directory
+ * @return True if the library is waiting to be opened on first use
+ */
+bool LibraryManagerImpl::isDeferred(const std::string &filename) const {
+  std::lock_guard<std::recursive_mutex> lock(m_mutex);
+  return m_deferredLibs.count(filename) > 0;
+}
+
 //-------------------------------------------------------------------------
 // Private members
 //-------------------------------------------------------------------------
@@ -120,6 +269,35 @@ bool LibraryManagerImpl::isExcluded(const std::string &filename, const std::vect
                      [&filename](const auto exclude) { return filename.find(exclude) != std::string::npos; });
 }
 
+/**
+ * Open a deferred library. It is removed from the deferred set before opening
+ * so that registrations run while opening cannot request it again.
+ * @param filename The filename of the deferred library
+ * @return 1 if the file loaded successfully, 0 otherwise
+ */
+int LibraryManagerImpl::openDeferred(const std::string &filename) {
+  auto lib = m_deferredLibs.find(filename);
+  const std::string path = lib->second.path;
+  m_deferredLibs.erase(lib);
+  g_log.debug("Opening deferred library " + path + "\n");
+  return openLibrary(Poco::File(path), filename);
+}
+
+/**
+ * Open several deferred libraries.
+ * @param filenames The filenames of deferred libraries
+ * @return The number of libraries opened
+ */
+int LibraryManagerImpl::openDeferred(const std::vector<std::string> &filenames) {
+  int libCount(0);
+  for (const auto &filename : filenames) {
+    // opening a library may already have opened others
+    if (m_deferredLibs.count(filename) > 0)
+      libCount += openDeferred(filename);
+  }
+  return libCount;
+}
+
 /**
  * Load a library
  * @param filepath :: A Poco::File The full path to a library as a string
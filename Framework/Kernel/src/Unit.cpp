@@ -12,6 +12,7 @@
 #include "MantidKernel/PhysicalConstants.h"
 #include "MantidKernel/UnitFactory.h"
 #include "MantidKernel/UnitLabelTypes.h"
+#include <algorithm>
 #include <cfloat>
 #include <limits>
 #include <math.h>
@@ -34,6 +35,14 @@ bool ParamPresentAndSet(const UnitParametersMap *params, UnitParams param, doubl
     return false;
   }
 }
+
+/** Apply a conversion to a block of values in place. The conversion is a
+ * template parameter so that it is inlined into the loop, allowing the
+ * compiler to vectorise it rather than making a virtual call per value.
+ */
+template <typename Conversion> void applyConversion(std::span<double> values, const Conversion &conversion) {
+  std::transform(values.begin(), values.end(), values.begin(), conversion);
+}
 } // namespace
 
 /**
@@ -155,9 +164,11 @@ void Unit::toTOF(std::vector<double> &xdata, std::vector<double> &ydata, const d
                  const UnitParametersMap &params) {
   UNUSED_ARG(ydata);
   this->initialize(_l1, _emode, params);
-  size_t numX = xdata.size();
-  for (size_t i = 0; i < numX; i++)
-    xdata[i] = this->singleToTOF(xdata[i]);
+  this->convertToTOF(xdata);
+}
+
+void Unit::convertToTOF(std::span<double> values) const {
+  applyConversion(values, [this](const double x) { return this->singleToTOF(x); });
 }
 
 /** Convert a single value to TOF
@@ -185,9 +196,11 @@ void Unit::fromTOF(std::vector<double> &xdata, std::vector<double> &ydata, const
                    const UnitParametersMap &params) {
   UNUSED_ARG(ydata);
   this->initialize(_l1, _emode, params);
-  size_t numX = xdata.size();
-  for (size_t i = 0; i < numX; i++)
-    xdata[i] = this->singleFromTOF(xdata[i]);
+  this->convertFromTOF(xdata);
+}
+
+void Unit::convertFromTOF(std::span<double> values) const {
+  applyConversion(values, [this](const double tof) { return this->singleFromTOF(tof); });
 }
 
 /** Convert a single value from TOF
@@ -291,6 +304,14 @@ double TOF::singleFromTOF(const double tof) const {
   return tof;
 }
 
+void TOF::convertToTOF(std::span<double>) const {
+  // Nothing to do
+}
+
+void TOF::convertFromTOF(std::span<double>) const {
+  // Nothing to do
+}
+
 Unit *TOF::clone() const { return new TOF(*this); }
 double TOF::conversionTOFMin() const { return -DBL_MAX; }
 ///@return DBL_MAX as ToF convetanble to TOF for in any time range
@@ -398,6 +419,26 @@ double Wavelength::singleFromTOF(const double tof) const {
   x *= factorFrom;
   return x;
 }
+
+void Wavelength::convertToTOF(std::span<double> values) const {
+  const double factor = factorTo;
+  if (emode == 1 || emode == 2) {
+    const double sfp = sfpTo;
+    applyConversion(values, [factor, sfp](const double x) { return x * factor + sfp; });
+  } else {
+    applyConversion(values, [factor](const double x) { return x * factor; });
+  }
+}
+
+void Wavelength::convertFromTOF(std::span<double> values) const {
+  const double factor = factorFrom;
+  if (do_sfpFrom) {
+    const double sfp = sfpFrom;
+    applyConversion(values, [factor, sfp](const double tof) { return (tof - sfp) * factor; });
+  } else {
+    applyConversion(values, [factor](const double tof) { return tof * factor; });
+  }
+}
 ///@return  Minimal time of flight, which can be reversively converted into
 /// wavelength
 double Wavelength::conversionTOFMin() const {
@@ -743,6 +784,36 @@ double dSpacing::singleFromTOF(const double tof) const {
     return negativeConstantTerm / (0.5 * difc * (1 + sqrt(sqrtTerm)));
 }
 
+void dSpacing::convertToTOF(std::span<double> values) const {
+  if (!isInitialized())
+    throw std::runtime_error("dSpacingBase::convertToTOF called before object "
+                             "has been initialized.");
+  const double c = difc;
+  const double t0 = tzero;
+  if (difa == 0.) {
+    applyConversion(values, [c, t0](const double x) { return c * x + t0; });
+  } else {
+    const double a = difa;
+    applyConversion(values, [a, c, t0](const double x) { return a * x * x + c * x + t0; });
+  }
+}
+
+void dSpacing::convertFromTOF(std::span<double> values) const {
+  if (!isInitialized())
+    throw std::runtime_error("dSpacingBase::convertFromTOF called before object "
+                             "has been initialized.");
+  if (!toDSpacingError.empty())
+    throw std::runtime_error(toDSpacingError);
+  if (difa == 0.) {
+    const double c = difc;
+    const double t0 = tzero;
+    applyConversion(values, [c, t0](const double tof) { return (tof - t0) / c; });
+  } else {
+    // the quadratic has edge cases which are checked per value
+    applyConversion(values, [this](const double tof) { return dSpacing::singleFromTOF(tof); });
+  }
+}
+
 double dSpacing::conversionTOFMin() const {
   // quadratic only has a min if difa is positive
   if (difa > 0) {
@@ -893,6 +964,16 @@ double MomentumTransfer::singleToTOF(const double x) const { return 2. * M_PI *
 //
 double MomentumTransfer::singleFromTOF(const double tof) const { return 2. * M_PI * difc / tof; }
 
+void MomentumTransfer::convertToTOF(std::span<double> values) const {
+  const double factor = 2. * M_PI * difc;
+  applyConversion(values, [factor](const double x) { return factor / x; });
+}
+
+void MomentumTransfer::convertFromTOF(std::span<double> values) const {
+  const double factor = 2. * M_PI * difc;
+  applyConversion(values, [factor](const double tof) { return factor / tof; });
+}
+
 double MomentumTransfer::conversionTOFMin() const { return 2. * M_PI * difc / DBL_MAX; }
 double MomentumTransfer::conversionTOFMax() const { return DBL_MAX; }
 
@@ -915,6 +996,19 @@ QSquared::QSquared() : MomentumTransfer() {
 double QSquared::singleToTOF(const double x) const { return MomentumTransfer::singleToTOF(sqrt(x)); }
 double QSquared::singleFromTOF(const double tof) const { return pow(MomentumTransfer::singleFromTOF(tof), 2); }
 
+void QSquared::convertToTOF(std::span<double> values) const {
+  const double factor = 2. * M_PI * difc;
+  applyConversion(values, [factor](const double x) { return factor / sqrt(x); });
+}
+
+void QSquared::convertFromTOF(std::span<double> values) const {
+  const double factor = 2. * M_PI * difc;
+  applyConversion(values, [factor](const double tof) {
+    const double q = factor / tof;
+    return q * q;
+  });
+}
+
 double QSquared::conversionTOFMin() const { return 2 * M_PI * difc / sqrt(DBL_MAX); }
 double QSquared::conversionTOFMax() const {
   double tofmax = 2 * M_PI * difc / sqrt(DBL_MIN);
@@ -1042,6 +1136,47 @@ double DeltaE::singleFromTOF(const double tof) const {
     return DBL_MAX;
 }
 
+void DeltaE::convertToTOF(std::span<double> values) const {
+  const double factor = factorTo;
+  const double t = t_other;
+  const double e = efixed;
+  const double scaling = unitScaling;
+  const double tofMax = DeltaE::conversionTOFMax();
+  if (emode == 1) {
+    applyConversion(values, [=](const double x) {
+      const double e2 = e - x / scaling;
+      return e2 <= 0.0 ? tofMax : factor / sqrt(e2) + t;
+    });
+  } else if (emode == 2) {
+    applyConversion(values, [=](const double x) {
+      const double e1 = e + x / scaling;
+      return e1 <= 0.0 ? tofMax : factor / sqrt(e1) + t;
+    });
+  } else {
+    std::fill(values.begin(), values.end(), tofMax);
+  }
+}
+
+void DeltaE::convertFromTOF(std::span<double> values) const {
+  const double factor = factorFrom;
+  const double t = t_otherFrom;
+  const double e = efixed;
+  const double scaling = unitScaling;
+  if (emode == 1) {
+    applyConversion(values, [=](const double tof) {
+      const double this_t = tof - t;
+      return this_t <= 0.0 ? -DBL_MAX : (e - factor / (this_t * this_t)) * scaling;
+    });
+  } else if (emode == 2) {
+    applyConversion(values, [=](const double tof) {
+      const double this_t = tof - t;
+      return this_t <= 0.0 ? DBL_MAX : (factor / (this_t * this_t) - e) * scaling;
+    });
+  } else {
+    std::fill(values.begin(), values.end(), DBL_MAX);
+  }
+}
+
 double DeltaE::conversionTOFMin() const {
   double time(DBL_MAX); // impossible for elastic, this units do not work for elastic
   if (emode == 1 || emode == 2)
@@ -1281,6 +1416,11 @@ double SpinEchoLength::singleFromTOF(const double tof) const {
   return x;
 }
 
+// The Wavelength kernels do not apply to the derived spin echo units
+void SpinEchoLength::convertToTOF(std::span<double> values) const { Unit::convertToTOF(values); }
+
+void SpinEchoLength::convertFromTOF(std::span<double> values) const { Unit::convertFromTOF(values); }
+
 Unit *SpinEchoLength::clone() const { return new SpinEchoLength(*this); }
 
 // ============================================================================================
@@ -1325,6 +1465,11 @@ double SpinEchoTime::singleFromTOF(const double tof) const {
   return x;
 }
 
+// The Wavelength kernels do not apply to the derived spin echo units
+void SpinEchoTime::convertToTOF(std::span<double> values) const { Unit::convertToTOF(values); }
+
+void SpinEchoTime::convertFromTOF(std::span<double> values) const { Unit::convertFromTOF(values); }
+
 Unit *SpinEchoTime::clone() const { return new SpinEchoTime(*this); }
 
 // ================================================================================
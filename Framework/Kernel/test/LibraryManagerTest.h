@@ -0,0 +1,148 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2024 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+#pragma once
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidFrameworkTestHelpers/DeferredLibraryHelper.h"
+#include "MantidKernel/LibraryManager.h"
+
+using namespace Mantid::Kernel;
+using DeferredLibraryHelper::libraryFilename;
+using DeferredLibraryHelper::ScopedManifest;
+
+class LibraryManagerTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static LibraryManagerTest *createSuite() { return new LibraryManagerTest(); }
+  static void destroySuite(LibraryManagerTest *suite) { delete suite; }
+
+  void test_deferLibraries_returns_nothing_for_missing_manifest() {
+    TS_ASSERT(LibraryManager::Instance().deferLibraries("/not/a/real/plugins.manifest", {}).empty());
+  }
+
+  void test_deferLibraries_skips_comments_blank_and_malformed_lines() {
+    ScopedManifest manifest("LibraryManagerTest_lines",
+                            {"# " + libraryFilename("DeferredAlgorithms") + " Algorithm Commented", "",
+                             "   ", libraryFilename("DeferredMalformed") + " Algorithm",
+                             "  " + libraryFilename("DeferredAlgorithms") + "  Algorithm   Rebin  "},
+                            {"DeferredAlgorithms", "DeferredMalformed"});
+
+    const auto deferred = manifest.defer();
+
+    TS_ASSERT_EQUALS(deferred, std::vector<std::string>{libraryFilename("DeferredAlgorithms")});
+    auto &libraries = LibraryManager::Instance();
+    TS_ASSERT(libraries.isDeferred(libraryFilename("DeferredAlgorithms")));
+    TS_ASSERT(!libraries.isDeferred(libraryFilename("DeferredMalformed")));
+  }
+
+  void test_deferLibraries_skips_excluded_and_missing_libraries() {
+    ScopedManifest manifest("LibraryManagerTest_excludes",
+                            {libraryFilename("DeferredAlgorithms") + " Algorithm Rebin",
+                             libraryFilename("DeferredExcluded") + " Algorithm Excluded",
+                             libraryFilename("DeferredMissing") + " Algorithm Missing"},
+                            {"DeferredAlgorithms", "DeferredExcluded"});
+
+    const auto deferred = manifest.defer({"Excluded"});
+
+    TS_ASSERT_EQUALS(deferred, std::vector<std::string>{libraryFilename("DeferredAlgorithms")});
+    auto &libraries = LibraryManager::Instance();
+    TS_ASSERT(!libraries.isDeferred(libraryFilename("DeferredExcluded")));
+    TS_ASSERT(!libraries.isDeferred(libraryFilename("DeferredMissing")));
+  }
+
+  void test_openDeferredLibrary_opens_only_the_provider() {
+    ScopedManifest manifest("LibraryManagerTest_provider",
+                            {libraryFilename("DeferredAlgorithms") + " Algorithm Rebin",
+                             libraryFilename("DeferredAlgorithms") + " Algorithm RebinAlias",
+                             libraryFilename("DeferredFunctions") + " Function Gaussian"},
+                            {"DeferredAlgorithms", "DeferredFunctions"});
+    manifest.defer();
+    auto &libraries = LibraryManager::Instance();
+
+    // the placeholder cannot be opened but it is no longer deferred either way
+    libraries.openDeferredLibrary("Algorithm", "RebinAlias");
+
+    TS_ASSERT(!libraries.isDeferred(libraryFilename("DeferredAlgorithms")));
+    TS_ASSERT(libraries.isDeferred(libraryFilename("DeferredFunctions")));
+    // already opened so nothing else is touched
+    TS_ASSERT(!libraries.openDeferredLibrary("Algorithm", "Rebin"));
+    TS_ASSERT(libraries.isDeferred(libraryFilename("DeferredFunctions")));
+  }
+
+  void test_openDeferredLibrary_opens_everything_for_an_unknown_name() {
+    ScopedManifest manifest("LibraryManagerTest_unknown",
+                            {libraryFilename("DeferredAlgorithms") + " Algorithm Rebin",
+                             libraryFilename("DeferredFunctions") + " Function Gaussian"},
+                            {"DeferredAlgorithms", "DeferredFunctions"});
+    manifest.defer();
+    auto &libraries = LibraryManager::Instance();
+
+    libraries.openDeferredLibrary("Algorithm", "NotInTheManifest");
+
+    TS_ASSERT(!libraries.isDeferred(libraryFilename("DeferredAlgorithms")));
+    TS_ASSERT(!libraries.isDeferred(libraryFilename("DeferredFunctions")));
+    TS_ASSERT(!libraries.hasDeferredLibraries());
+  }
+
+  void test_openDeferredLibraries_opens_only_libraries_of_the_given_kind() {
+    ScopedManifest manifest("LibraryManagerTest_kind",
+                            {libraryFilename("DeferredLoaders") + " Algorithm LoadSomething",
+                             libraryFilename("DeferredLoaders") + " FileLoader LoadSomething",
+                             libraryFilename("DeferredAlgorithms") + " Algorithm Rebin"},
+                            {"DeferredLoaders", "DeferredAlgorithms"});
+    manifest.defer();
+    auto &libraries = LibraryManager::Instance();
+
+    libraries.openDeferredLibraries("FileLoader");
+
+    TS_ASSERT(!libraries.isDeferred(libraryFilename("DeferredLoaders")));
+    TS_ASSERT(libraries.isDeferred(libraryFilename("DeferredAlgorithms")));
+    TS_ASSERT(libraries.hasDeferredLibraries());
+
+    libraries.openDeferredLibraries();
+
+    TS_ASSERT(!libraries.hasDeferredLibraries());
+  }
+
+  void test_deferredEntries_returns_the_details_of_libraries_not_yet_opened() {
+    ScopedManifest manifest("LibraryManagerTest_entries",
+                            {libraryFilename("DeferredAlgorithms") + " AlgorithmVersion Rebin|1 - Transforms\\Rebin",
+                             libraryFilename("DeferredAlgorithms") + " Algorithm Rebin",
+                             libraryFilename("DeferredFunctions") + " Function Gaussian"},
+                            {"DeferredAlgorithms", "DeferredFunctions"});
+    manifest.defer();
+    auto &libraries = LibraryManager::Instance();
+
+    const auto entries = libraries.deferredEntries("AlgorithmVersion");
+
+    using Entries = std::vector<std::pair<std::string, std::string>>;
+    TS_ASSERT_EQUALS(entries, (Entries{{"Rebin|1", "- Transforms\\Rebin"}}));
+    TS_ASSERT_EQUALS(libraries.deferredEntries("Algorithm"), (Entries{{"Rebin", ""}}));
+    TS_ASSERT(libraries.isDeferred(libraryFilename("DeferredAlgorithms")));
+
+    libraries.openDeferredLibraries("Algorithm");
+
+    TS_ASSERT(libraries.deferredEntries("AlgorithmVersion").empty());
+  }
+
+  void test_openDeferredLibraries_skips_libraries_listing_the_other_kind() {
+    ScopedManifest manifest("LibraryManagerTest_unlessKind",
+                            {libraryFilename("DeferredListed") + " Algorithm Rebin",
+                             libraryFilename("DeferredListed") + " AlgorithmVersion Rebin|1 - Transforms",
+                             libraryFilename("DeferredScanned") + " Algorithm Scale"},
+                            {"DeferredListed", "DeferredScanned"});
+    manifest.defer();
+    auto &libraries = LibraryManager::Instance();
+
+    libraries.openDeferredLibraries("Algorithm", "AlgorithmVersion");
+
+    TS_ASSERT(libraries.isDeferred(libraryFilename("DeferredListed")));
+    TS_ASSERT(!libraries.isDeferred(libraryFilename("DeferredScanned")));
+  }
+};
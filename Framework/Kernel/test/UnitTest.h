@@ -15,6 +15,7 @@
 #include <boost/lexical_cast.hpp>
 #include <cfloat>
 #include <limits>
+#include <tuple>
 
 using namespace Mantid::Kernel;
 using namespace Mantid::Kernel::Units;
@@ -1606,6 +1607,29 @@ public:
     TS_ASSERT_EQUALS(timeConversionValue("microsecond", "ns"), 1.0e3);
   }
 
+  void test_block_conversion_matches_single_value_conversion() {
+    const std::vector<double> tofs{1000., 2500., 5000., 10000., 20000.};
+    const UnitParametersMap elastic{{UnitParams::l2, 1.1}, {UnitParams::twoTheta, 1.2}};
+    const UnitParametersMap withDifa{{UnitParams::difc, DIFC}, {UnitParams::difa, DIFA1}, {UnitParams::tzero, TZERO}};
+    const UnitParametersMap inelastic{{UnitParams::l2, 1.1}, {UnitParams::efixed, 99.}};
+    const UnitParametersMap spinEcho{{UnitParams::l2, 1.1}, {UnitParams::efixed, 4.}};
+    const std::vector<std::tuple<Unit *, int, const UnitParametersMap *>> cases{
+        {&tof, 0, &elastic},   {&lambda, 0, &elastic},  {&lambda, 1, &inelastic}, {&d, 0, &elastic},
+        {&d, 0, &withDifa},    {&q, 0, &elastic},       {&q2, 0, &elastic},       {&dE, 1, &inelastic},
+        {&dE, 2, &inelastic},  {&dEk, 1, &inelastic},   {&delta, 0, &spinEcho},   {&energy, 0, &elastic}};
+    for (const auto &[unit, emode, params] : cases) {
+      unit->initialize(69.0, emode, *params);
+      std::vector<double> converted(tofs);
+      unit->convertFromTOF(converted);
+      std::vector<double> roundTrip(converted);
+      unit->convertToTOF(roundTrip);
+      for (size_t i = 0; i < tofs.size(); ++i) {
+        TS_ASSERT_DELTA(converted[i], unit->singleFromTOF(tofs[i]), 1e-10);
+        TS_ASSERT_DELTA(roundTrip[i], unit->singleToTOF(converted[i]), 1e-10);
+      }
+    }
+  }
+
   bool check_vector_conversion(std::vector<double> &vec, double factor) {
     std::vector<double> ref({1.0, 2.0, 3.0, 4.0, 5.0});
     std::transform(ref.begin(), ref.end(), ref.begin(), [factor](double x) -> double { return x * factor; });
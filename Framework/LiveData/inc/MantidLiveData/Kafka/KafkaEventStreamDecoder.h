@@ -78,8 +78,13 @@ private:
   std::vector<BufferedPulse> m_receivedPulseBuffer;
   /// Mutex protecting intermediate buffers
   mutable std::mutex m_intermediateBufferMutex;
-  /// The number of events above which the intermediate buffer will be flushed
+  /// The number of events above which the intermediate buffer will be
+  /// flushed. If zero, events are added to m_localEvents straight from each
+  /// message without going through the intermediate buffer.
   const std::size_t m_intermediateBufferFlushThreshold;
+  /// Workspace index of each event in the message being decoded, only used
+  /// when there is no intermediate buffer
+  std::vector<size_t> m_messageWorkspaceIndices;
 };
 
 DLLExport std::vector<size_t>
@@ -25,6 +25,13 @@ namespace LiveData {
 */
 class MANTID_LIVEDATA_DLL LiveDataAlgorithm : public API::Algorithm {
 public:
+  /// The processing algorithms that are kept between chunks when
+  /// ReuseProcessingAlgorithms is set
+  struct ProcessingAlgorithms {
+    Mantid::API::IAlgorithm_sptr chunk;
+    Mantid::API::IAlgorithm_sptr post;
+  };
+
   const std::string category() const override;
 
   void copyPropertyValuesFrom(const LiveDataAlgorithm &other);
@@ -33,6 +40,9 @@ public:
   Mantid::API::ILiveListener_sptr createLiveListener(bool connect = false);
   void setLiveListener(Mantid::API::ILiveListener_sptr listener);
 
+  const std::shared_ptr<ProcessingAlgorithms> &processingAlgorithms() const;
+  void setProcessingAlgorithms(std::shared_ptr<ProcessingAlgorithms> algorithms);
+
   std::map<std::string, std::string> validateInputs() override;
 
 protected:
@@ -42,11 +52,15 @@ protected:
   Mantid::Types::Core::DateAndTime getStartTime() const;
 
   Mantid::API::IAlgorithm_sptr makeAlgorithm(bool postProcessing);
+  Mantid::API::IAlgorithm_sptr getProcessingAlgorithm(bool postProcessing);
 
   bool hasPostProcessing() const;
 
   /// Live listener
   Mantid::API::ILiveListener_sptr m_listener;
+
+  /// Processing algorithms shared with the other live data algorithms
+  std::shared_ptr<ProcessingAlgorithms> m_processingAlgorithms{std::make_shared<ProcessingAlgorithms>()};
 };
 
 } // namespace LiveData
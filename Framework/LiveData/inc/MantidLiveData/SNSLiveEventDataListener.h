@@ -12,11 +12,15 @@
 #include "MantidAPI/LiveListener.h"
 #include "MantidDataObjects/EventWorkspace.h"
 #include "MantidLiveData/ADARA/ADARAParser.h"
+#include "MantidLiveData/DllConfig.h"
 
 #include <Poco/Net/StreamSocket.h>
 #include <Poco/Runnable.h>
 #include <Poco/Timer.h>
 
+#include <utility>
+#include <vector>
+
 namespace Mantid {
 namespace LiveData {
 
@@ -24,7 +28,9 @@ namespace LiveData {
    Management
     Service and receives events from it.
  */
-class SNSLiveEventDataListener : public API::LiveListener, public Poco::Runnable, public ADARA::Parser {
+class MANTID_LIVEDATA_DLL SNSLiveEventDataListener : public API::LiveListener,
+                                                     public Poco::Runnable,
+                                                     public ADARA::Parser {
 public:
   SNSLiveEventDataListener();
   ~SNSLiveEventDataListener() override;
@@ -97,7 +103,7 @@ private:
   // Returns true if we've got a value for every log listed in m_requiredLogs
   bool haveRequiredLogs();
 
-  void appendEvent(const uint32_t pixelId, const double tof, const Mantid::Types::Core::DateAndTime pulseTime);
+  void stageEvent(const uint32_t pixelId, const double tof, const Mantid::Types::Core::DateAndTime pulseTime);
   // tof is "Time Of Flight" and is in units of microsecondss relative to the
   // start of the pulse
   // (There's some documentation that says nanoseconds, but Russell Taylor
@@ -106,6 +112,9 @@ private:
   // Both values are designed to be passed straight into the TofEvent
   // constructor.
 
+  // Moves the staged events into m_eventBuffer. The mutex must be held.
+  void appendStagedEvents();
+
   ILiveListener::RunStatus m_status{RunStatus::NoRun};
   int m_runNumber{0};
   DataObjects::EventWorkspace_sptr m_eventBuffer;
@@ -113,7 +122,8 @@ private:
 
   bool m_workspaceInitialized{false};
   std::string m_wsName;
-  detid2index_map m_indexMap;        // maps pixel id's to workspace indexes
+  std::vector<size_t> m_indexVector; // maps pixel id's (+ m_indexOffset) to workspace indexes
+  detid_t m_indexOffset{0};
   detid2index_map m_monitorIndexMap; // Same as above for the monitor workspace
 
   // We need these 2 strings to initialize m_buffer
@@ -133,6 +143,12 @@ private:
 
   Poco::Thread m_thread;
   std::mutex m_mutex; // protects m_buffer & m_status
+
+  // Holds the events of the packet being parsed: they are decoded without
+  // holding m_mutex and then appended to m_eventBuffer in one go. Only the
+  // background thread touches this.
+  std::vector<std::pair<size_t, Types::Event::TofEvent>> m_stagedEvents;
+
   bool m_pauseNetRead{false};
   bool m_stopThread{false}; // background thread checks this periodically.
                             // If true, the thread exits
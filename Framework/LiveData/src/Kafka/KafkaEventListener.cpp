@@ -24,7 +24,9 @@ DECLARE_LISTENER(KafkaEventListener)
 KafkaEventListener::KafkaEventListener() : API::LiveListener() {
   declareProperty("BufferThreshold", static_cast<uint64_t>(1000000),
                   "Threshold number of events at which the intermediate event "
-                  "buffer will be flushed to the buffered EventWorkspace.");
+                  "buffer will be flushed to the buffered EventWorkspace. If 0, "
+                  "events are added to the buffered EventWorkspace directly from "
+                  "each message without an intermediate buffer.");
 }
 
 void KafkaEventListener::setAlgorithm(const Mantid::API::IAlgorithm &callingAlgorithm) {
@@ -29,6 +29,7 @@ GNU_DIAG_OFF("conversion")
 #include "private/Schema/is84_isis_events_generated.h"
 GNU_DIAG_ON("conversion")
 
+#include <algorithm>
 #include <chrono>
 #include <json/json.h>
 #include <numeric>
@@ -99,6 +100,58 @@ void sortIntermediateEventBuffer(
                                   : lhs.wsIdx < rhs.wsIdx;
                      });
 }
+
+/**
+ * Add the events of a single message straight into an EventWorkspace. The
+ * spectra are split into contiguous ranges, one per thread. The events are
+ * bucketed by range once, keeping their order within the message, so each
+ * thread only visits its own events and no two threads append to the same
+ * EventList. The events themselves are never copied to an intermediate buffer.
+ *
+ * @param eventWs : The workspace to add the events to
+ * @param tofData : Message buffer of time-of-flights in nanoseconds
+ * @param wsIndices : Workspace index of each event in the message
+ * @param pulseTime : Pulse time of all of the events in the message
+ */
+void addMessageEvents(Mantid::DataObjects::EventWorkspace &eventWs, const flatbuffers::Vector<uint32_t> &tofData,
+                      const std::vector<size_t> &wsIndices, const Mantid::Types::Core::DateAndTime &pulseTime) {
+  auto addEvent = [&](const size_t idx) {
+    // nanoseconds to microseconds
+    const auto tof = static_cast<double>(tofData[static_cast<uint32_t>(idx)]) * 1e-3;
+    eventWs.getSpectrumUnsafe(wsIndices[idx])->addEventQuickly(Mantid::Types::Event::TofEvent(tof, pulseTime));
+  };
+
+  // Don't pay for a parallel region unless each thread has enough to do
+  constexpr size_t minEventsPerRange = 10000;
+  const auto numberOfSpectra = eventWs.getNumberHistograms();
+  const auto maxRanges = std::max<size_t>(1, std::min<size_t>(PARALLEL_GET_MAX_THREADS, numberOfSpectra));
+  const auto numberOfRanges = std::clamp<size_t>(wsIndices.size() / minEventsPerRange, 1, maxRanges);
+  if (numberOfRanges == 1) {
+    for (size_t idx = 0; idx < wsIndices.size(); ++idx)
+      addEvent(idx);
+    return;
+  }
+  const auto spectraPerRange = (numberOfSpectra + numberOfRanges - 1) / numberOfRanges;
+
+  // Count the events of each range, then place the message index of each
+  // event after those of the earlier ranges
+  std::vector<size_t> rangeStart(numberOfRanges + 1, 0);
+  for (const auto wsIdx : wsIndices)
+    ++rangeStart[wsIdx / spectraPerRange + 1];
+  std::partial_sum(rangeStart.cbegin(), rangeStart.cend(), rangeStart.begin());
+  std::vector<uint32_t> eventsByRange(wsIndices.size());
+  auto nextInRange = rangeStart;
+  for (size_t idx = 0; idx < wsIndices.size(); ++idx)
+    eventsByRange[nextInRange[wsIndices[idx] / spectraPerRange]++] = static_cast<uint32_t>(idx);
+
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int range = 0; range < static_cast<int>(numberOfRanges); ++range) {
+    const auto first = rangeStart[static_cast<size_t>(range)];
+    const auto last = rangeStart[static_cast<size_t>(range) + 1];
+    for (auto i = first; i < last; ++i)
+      addEvent(eventsByRange[i]);
+  }
+}
 } // namespace
 
 namespace Mantid::LiveData {
@@ -385,11 +438,47 @@ void KafkaEventStreamDecoder::eventDataFromMessage(const std::string &buffer, si
   /* Create buffered pulse */
   BufferedPulse pulse{pulseTime, 0};
 
+  const auto ISISMsg = eventMsg->facility_specific_data_type() == FacilityData::ISISData
+                           ? static_cast<const ISISData *>(eventMsg->facility_specific_data())
+                           : nullptr;
+  if (ISISMsg) {
+    pulse.periodNumber = static_cast<int>(ISISMsg->period_number());
+  }
+
+  if (m_intermediateBufferFlushThreshold == 0) {
+    /* No intermediate buffer, so the events go straight from the message into
+     * the workspace of their period */
+    const auto starttime = std::chrono::system_clock::now();
+
+    m_messageWorkspaceIndices.resize(nEvents);
+    const auto nEventsSigned = static_cast<int64_t>(nEvents);
+    PARALLEL_FOR_IF(nEvents > 100000)
+    for (int64_t i = 0; i < nEventsSigned; ++i) {
+      m_messageWorkspaceIndices[i] = m_eventIdToWkspIdx(detData[static_cast<uint32_t>(i)]);
+    }
+
+    {
+      std::lock_guard<std::mutex> workspaceLock(m_mutex);
+      auto &periodWs = *m_localEvents[pulse.periodNumber];
+      if (ISISMsg) {
+        periodWs.mutableRun()
+            .getTimeSeriesProperty<double>(PROTON_CHARGE_PROPERTY)
+            ->addValue(pulseTime, ISISMsg->proton_charge());
+      }
+      periodWs.invalidateCommonBinsFlag();
+      addMessageEvents(periodWs, tofData, m_messageWorkspaceIndices, pulseTime);
+    }
+
+    const auto endTime = std::chrono::system_clock::now();
+    const std::chrono::duration<double> dur = endTime - starttime;
+    totalPopulateWorkspaceDuration += dur.count();
+    numPopulateWorkspaceCalls += 1;
+    return;
+  }
+
   /* Perform facility specific operations */
-  if (eventMsg->facility_specific_data_type() == FacilityData::ISISData) {
+  if (ISISMsg) {
     std::lock_guard<std::mutex> workspaceLock(m_mutex);
-    const auto ISISMsg = static_cast<const ISISData *>(eventMsg->facility_specific_data());
-    pulse.periodNumber = static_cast<int>(ISISMsg->period_number());
     auto periodWs = m_localEvents[pulse.periodNumber];
     auto &mutableRunInfo = periodWs->mutableRun();
     mutableRunInfo.getTimeSeriesProperty<double>(PROTON_CHARGE_PROPERTY)->addValue(pulseTime, ISISMsg->proton_charge());
@@ -118,6 +118,16 @@ void LiveDataAlgorithm::initProps() {
   declareProperty(std::make_unique<FileProperty>("PostProcessingScriptFilename", "", FileProperty::OptionalLoad, "py"),
                   " Python script that will be run to process the accumulated data.");
 
+  declareProperty("ReuseProcessingAlgorithms", false,
+                  "Create the processing and post-processing algorithms once and "
+                  "run the same instances on every chunk, instead of creating "
+                  "them again for each update.\n"
+                  "This saves creating the algorithms and parsing their "
+                  "properties, and lets them keep what they read from their "
+                  "inputs, e.g. AlignDetectors keeps its calibration and "
+                  "DiffractionFocussing its grouping. The algorithms are "
+                  "created again when the data is reset at a run transition.");
+
   std::vector<std::string> runOptions{"Restart", "Stop", "Rename"};
   declareProperty("RunTransitionBehavior", "Restart", std::make_shared<StringListValidator>(runOptions),
                   "What to do at run start/end boundaries?\n"
@@ -231,6 +241,22 @@ ILiveListener_sptr LiveDataAlgorithm::createLiveListener(bool connect) {
  */
 void LiveDataAlgorithm::setLiveListener(Mantid::API::ILiveListener_sptr listener) { m_listener = std::move(listener); }
 
+//----------------------------------------------------------------------------------------------
+/// @return the processing algorithms kept between chunks by this algorithm
+const std::shared_ptr<LiveDataAlgorithm::ProcessingAlgorithms> &LiveDataAlgorithm::processingAlgorithms() const {
+  return m_processingAlgorithms;
+}
+
+//----------------------------------------------------------------------------------------------
+/** Share the processing algorithms of another live data algorithm, so that the
+ * instances are reused across chunks when ReuseProcessingAlgorithms is set.
+ *
+ * @param algorithms :: processing algorithms to share
+ */
+void LiveDataAlgorithm::setProcessingAlgorithms(std::shared_ptr<ProcessingAlgorithms> algorithms) {
+  m_processingAlgorithms = std::move(algorithms);
+}
+
 //----------------------------------------------------------------------------------------------
 /** @return the value of the StartTime property */
 Mantid::Types::Core::DateAndTime LiveDataAlgorithm::getStartTime() const {
@@ -306,6 +332,29 @@ IAlgorithm_sptr LiveDataAlgorithm::makeAlgorithm(bool postProcessing) {
   }
 }
 
+//----------------------------------------------------------------------------------------------
+/** Return the algorithm for the chunk or post-processing step.
+ *
+ * If ReuseProcessingAlgorithms is set, the algorithm is only created the first
+ * time and the same instance is returned for every later chunk. Otherwise
+ * this is the same as makeAlgorithm().
+ *
+ * @param postProcessing :: true to get the post-processing algorithm
+ * @return shared pointer to the algorithm, or null if there is no processing
+ */
+IAlgorithm_sptr LiveDataAlgorithm::getProcessingAlgorithm(bool postProcessing) {
+  const bool reuse = this->getProperty("ReuseProcessingAlgorithms");
+  if (!reuse)
+    return this->makeAlgorithm(postProcessing);
+
+  auto &alg = postProcessing ? m_processingAlgorithms->post : m_processingAlgorithms->chunk;
+  if (!alg)
+    alg = this->makeAlgorithm(postProcessing);
+  else
+    g_log.debug() << "Reusing the " << alg->name() << " algorithm from the previous chunk\n";
+  return alg;
+}
+
 //----------------------------------------------------------------------------------------------
 /** Validate the properties together */
 std::map<std::string, std::string> LiveDataAlgorithm::validateInputs() {
@@ -64,6 +64,23 @@ void copyInstrument(const API::Workspace *source, API::Workspace *target) {
     }
   }
 }
+
+/**
+ * Drop the chunk workspaces held by a processing algorithm that is kept for
+ * the next chunk, so that it does not keep the last chunk alive in the
+ * meantime. Other workspace properties, e.g. a grouping workspace given in
+ * the processing properties, keep their workspaces for the next chunk.
+ *
+ * @param alg : The processing algorithm
+ * @param inputPropName : The name of the property the chunk was passed in
+ * @param outputPropName : The name of the property the result was taken from
+ */
+void releaseWorkspaces(const IAlgorithm &alg, const std::string &inputPropName, const std::string &outputPropName) {
+  for (const auto &name : {inputPropName, outputPropName}) {
+    if (auto *wsProp = dynamic_cast<IWorkspaceProperty *>(alg.getPointerToProperty(name)))
+      wsProp->clear();
+  }
+}
 } // namespace
 
 // Register the algorithm into the AlgorithmFactory
@@ -98,8 +115,8 @@ Mantid::API::Workspace_sptr LoadLiveData::runProcessing(Mantid::API::Workspace_s
   // Prevent others writing to the workspace while we run.
   ReadLock _lock(*inputWS);
 
-  // Make algorithm and set the properties
-  auto alg = this->makeAlgorithm(PostProcess);
+  // Make algorithm and set the properties, or get the one from the last chunk
+  auto alg = this->getProcessingAlgorithm(PostProcess);
   if (alg) {
     if (PostProcess)
       g_log.notice() << "Performing post-processing";
@@ -166,6 +183,9 @@ Mantid::API::Workspace_sptr LoadLiveData::runProcessing(Mantid::API::Workspace_s
       throw std::runtime_error("The " + alg->name() +
                                " Algorithm's OutputWorkspace property is not a WorkspaceProperty!");
     Workspace_sptr temp = wsProp->getWorkspace();
+    const bool reused = this->getProperty("ReuseProcessingAlgorithms");
+    if (reused)
+      releaseWorkspaces(*alg, algoInputWSName, algoOutputWSName);
 
     if (!PostProcess) {
       if (!temp) {
@@ -469,6 +489,11 @@ void LoadLiveData::exec() {
 
   // Do we need to reset the data?
   bool dataReset = listener->dataReset();
+  if (dataReset) {
+    // Anything the processing algorithms kept may belong to the old run
+    m_processingAlgorithms->chunk.reset();
+    m_processingAlgorithms->post.reset();
+  }
 
   // The listener returns a MatrixWorkspace containing the chunk of live data.
   Workspace_sptr chunkWS;
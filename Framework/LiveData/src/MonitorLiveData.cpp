@@ -168,6 +168,8 @@ void MonitorLiveData::exec() {
       loadAlg->copyPropertyValuesFrom(*this);
       // Give the listener directly to LoadLiveData (don't re-create it)
       loadAlg->setLiveListener(listener);
+      // Keep using the same processing algorithms, if they are reused
+      loadAlg->setProcessingAlgorithms(processingAlgorithms());
       // Override the AccumulationMethod when a run ends.
       loadAlg->setPropertyValue("AccumulationMethod", NextAccumulationMethod);
 
@@ -6,6 +6,7 @@
 // SPDX - License - Identifier: GPL - 3.0 +
 #include <ctime>
 #include <exception>
+#include <limits>
 #include <sstream> // for ostringstream
 #include <string>
 
@@ -390,47 +391,53 @@ bool SNSLiveEventDataListener::rxPacket(const ADARA::BankedEventPkt &pkt) {
 
   // Append the events
   g_log.debug() << "----- Pulse ID: " << pkt.pulseId() << " -----\n";
+
+  // Timestamp for the events
+  Mantid::Types::Core::DateAndTime eventTime = timeFromPacket(pkt);
+
+  // Decode the events before taking the lock. The staging buffer keeps its
+  // capacity between packets, so this doesn't allocate once it has grown.
+  m_stagedEvents.clear();
+  // Iterate through each event
+  const ADARA::Event *event = pkt.firstEvent();
+  unsigned lastBankID = pkt.curBankId();
+  // A counter that we use for logging purposes
+  unsigned eventsPerBank = 0;
+  while (event != nullptr) {
+    eventsPerBank++;
+    totalEvents++;
+    if (lastBankID < 0xFFFFFFFE) // Bank ID -1 & -2 are special cases and are
+                                 // not valid pixels
+    {
+      // stageEvent needs tof to be in units of microseconds, but it comes
+      // from the ADARA stream in units of 100ns.
+      if (pkt.getSourceCORFlag()) {
+        stageEvent(event->pixel, event->tof / 10.0, eventTime);
+      } else {
+        stageEvent(event->pixel, (event->tof + pkt.getSourceTOFOffset()) / 10.0, eventTime);
+      }
+    }
+
+    event = pkt.nextEvent();
+    if (pkt.curBankId() != lastBankID) {
+      g_log.debug() << "BankID " << lastBankID << " had " << eventsPerBank << " events\n";
+
+      lastBankID = pkt.curBankId();
+      eventsPerBank = 0;
+    }
+  }
+
   // Scope braces
   {
     std::lock_guard<std::mutex> scopedLock(m_mutex);
 
-    // Timestamp for the events
-    Mantid::Types::Core::DateAndTime eventTime = timeFromPacket(pkt);
-
     // Save the pulse charge in the logs (*10 because we want the units to be
     // picoCulombs, and ADARA sends them out in units of 10pC)
     m_eventBuffer->mutableRun()
         .getTimeSeriesProperty<double>(PROTON_CHARGE_PROPERTY)
         ->addValue(eventTime, pkt.pulseCharge() * 10);
 
-    // Iterate through each event
-    const ADARA::Event *event = pkt.firstEvent();
-    unsigned lastBankID = pkt.curBankId();
-    // A counter that we use for logging purposes
-    unsigned eventsPerBank = 0;
-    while (event != nullptr) {
-      eventsPerBank++;
-      totalEvents++;
-      if (lastBankID < 0xFFFFFFFE) // Bank ID -1 & -2 are special cases and are
-                                   // not valid pixels
-      {
-        // appendEvent needs tof to be in units of microseconds, but it comes
-        // from the ADARA stream in units of 100ns.
-        if (pkt.getSourceCORFlag()) {
-          appendEvent(event->pixel, event->tof / 10.0, eventTime);
-        } else {
-          appendEvent(event->pixel, (event->tof + pkt.getSourceTOFOffset()) / 10.0, eventTime);
-        }
-      }
-
-      event = pkt.nextEvent();
-      if (pkt.curBankId() != lastBankID) {
-        g_log.debug() << "BankID " << lastBankID << " had " << eventsPerBank << " events\n";
-
-        lastBankID = pkt.curBankId();
-        eventsPerBank = 0;
-      }
-    }
+    appendStagedEvents();
   } // mutex automatically unlocks here
 
   g_log.debug() << "Total Events: " << totalEvents << "\n";
@@ -1298,7 +1305,7 @@ void SNSLiveEventDataListener::initWorkspacePart2() {
   m_eventBuffer->getAxis(0)->unit() = UnitFactory::Instance().create("TOF");
   m_eventBuffer->setYUnit("Counts");
 
-  m_indexMap = m_eventBuffer->getDetectorIDToWorkspaceIndexMap(true /* bool throwIfMultipleDets */);
+  m_indexVector = m_eventBuffer->getDetectorIDToWorkspaceIndexVector(m_indexOffset, true /* throwIfMultipleDets */);
 
   // We always want to have at least one value for the scan index time
   // series.  We may have already gotten a scan start packet by the time we
@@ -1356,22 +1363,28 @@ bool SNSLiveEventDataListener::haveRequiredLogs() {
   return allFound;
 }
 
-/// Adds an event to the workspace
-void SNSLiveEventDataListener::appendEvent(const uint32_t pixelId, const double tof,
-                                           const Mantid::Types::Core::DateAndTime pulseTime)
+/// Adds an event to the events waiting to go into the workspace
+void SNSLiveEventDataListener::stageEvent(const uint32_t pixelId, const double tof,
+                                          const Mantid::Types::Core::DateAndTime pulseTime) {
+  // Pixel ids are dense, so they are looked up in a vector rather than a map
+  const auto index = static_cast<int64_t>(pixelId) + m_indexOffset;
+  if (index >= 0 && index < static_cast<int64_t>(m_indexVector.size()) &&
+      m_indexVector[index] != std::numeric_limits<size_t>::max()) {
+    m_stagedEvents.emplace_back(m_indexVector[index], Types::Event::TofEvent(tof, pulseTime));
+  } else {
+    g_log.warning() << "Invalid pixel ID: " << pixelId << " (TofF: " << tof << " microseconds)\n";
+  }
+}
+
+/// Adds the staged events to the workspace
+void SNSLiveEventDataListener::appendStagedEvents()
 // NOTE: This function does NOT lock the mutex!  Make sure you do that
 // before calling this function!
 {
-  // It'd be nice to use operator[], but we might end up inserting a value....
-  // Have to use find() instead.
-  const auto it = m_indexMap.find(pixelId);
-  if (it != m_indexMap.end()) {
-    const std::size_t workspaceIndex = it->second;
-    Types::Event::TofEvent event(tof, pulseTime);
-    m_eventBuffer->getSpectrum(workspaceIndex).addEventQuickly(event);
-  } else {
-    g_log.warning() << "Invalid pixel ID: " << pixelId << " (TofF: " << tof << " microseconds)\n";
+  for (const auto &stagedEvent : m_stagedEvents) {
+    m_eventBuffer->getSpectrum(stagedEvent.first).addEventQuickly(stagedEvent.second);
   }
+  m_stagedEvents.clear();
 }
 
 /// Retrieve buffered data
@@ -195,6 +195,7 @@ void StartLiveData::exec() {
   loadAlg->setPropertyValue("AccumulationMethod", "Replace");
   // Give the listener directly to LoadLiveData (don't re-create it)
   loadAlg->setLiveListener(listener);
+  loadAlg->setProcessingAlgorithms(processingAlgorithms());
 
   // Run the LoadLiveData for the first time.
   loadAlg->executeAsChildAlg();
@@ -221,6 +222,8 @@ void StartLiveData::exec() {
 
     // Give the listener directly to LoadLiveData (don't re-create it)
     monitorAlg->setLiveListener(listener);
+    // ...and the processing algorithms created by the first LoadLiveData
+    monitorAlg->setProcessingAlgorithms(processingAlgorithms());
 
     // Check for possible cancellation
     interruption_point();
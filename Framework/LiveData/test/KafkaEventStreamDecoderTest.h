@@ -130,6 +130,105 @@ public:
     }
   }
 
+  void test_Single_Period_Event_Stream_Through_Intermediate_Buffer() {
+    using namespace ::testing;
+    using namespace KafkaTesting;
+    using Mantid::API::Workspace_sptr;
+    using Mantid::DataObjects::EventWorkspace;
+    using namespace Mantid::LiveData;
+
+    auto mockBroker = std::make_shared<MockKafkaBroker>();
+    EXPECT_CALL(*mockBroker, subscribe_(_, _))
+        .Times(Exactly(2))
+        .WillOnce(Return(new FakeISISEventSubscriber(1)))
+        .WillOnce(Return(new FakeRunInfoStreamSubscriber(1)));
+    // Events are only flushed from the intermediate buffer when capture stops
+    auto testWrapper = createTestInstance(mockBroker, 1000000);
+
+    testWrapper.runKafkaOneStep(); // Start up
+
+    Workspace_sptr workspace;
+    TS_ASSERT_THROWS_NOTHING(testWrapper.stopCapture());
+    TS_ASSERT(!testWrapper->isCapturing());
+
+    TS_ASSERT_THROWS_NOTHING(workspace = testWrapper->extractData());
+
+    auto eventWksp = std::dynamic_pointer_cast<EventWorkspace>(workspace);
+    TSM_ASSERT("Expected an EventWorkspace from extractData(). Found something else", eventWksp);
+    checkWorkspaceMetadata(*eventWksp);
+    checkWorkspaceEventData(*eventWksp);
+    checkWorkspaceEventsPerSpectrum(*eventWksp);
+
+    TS_ASSERT_EQUALS(6.0, eventWksp->getTofMin());
+    TS_ASSERT_EQUALS(11.0, eventWksp->getTofMax());
+  }
+
+  void test_Events_Added_Directly_From_Message_Go_To_Their_Spectra() {
+    using namespace ::testing;
+    using namespace KafkaTesting;
+    using Mantid::API::Workspace_sptr;
+    using Mantid::DataObjects::EventWorkspace;
+    using namespace Mantid::LiveData;
+
+    auto mockBroker = std::make_shared<MockKafkaBroker>();
+    EXPECT_CALL(*mockBroker, subscribe_(_, _))
+        .Times(Exactly(2))
+        .WillOnce(Return(new FakeISISEventSubscriber(1)))
+        .WillOnce(Return(new FakeRunInfoStreamSubscriber(1)));
+    auto testWrapper = createTestInstance(mockBroker);
+
+    testWrapper.runKafkaOneStep();
+    testWrapper.runKafkaOneStep();
+
+    Workspace_sptr workspace;
+    TS_ASSERT_THROWS_NOTHING(testWrapper.stopCapture());
+    TS_ASSERT_THROWS_NOTHING(workspace = testWrapper->extractData());
+
+    auto eventWksp = std::dynamic_pointer_cast<EventWorkspace>(workspace);
+    TS_ASSERT(eventWksp);
+    checkWorkspaceEventData(*eventWksp);
+    checkWorkspaceEventsPerSpectrum(*eventWksp);
+    // Each message has one event per spectrum apart from spectrum 2, and the
+    // time-of-flight of spectrum 1's event is 7 microseconds
+    for (const auto &event : eventWksp->getSpectrum(0).getEvents()) {
+      TS_ASSERT_EQUALS(7.0, event.tof());
+    }
+  }
+
+  void test_Events_Of_A_Large_Message_Keep_Their_Order_In_Each_Spectrum() {
+    using namespace ::testing;
+    using namespace KafkaTesting;
+    using Mantid::API::Workspace_sptr;
+    using Mantid::DataObjects::EventWorkspace;
+    using namespace Mantid::LiveData;
+
+    // enough events in one message for them to be added on several threads
+    constexpr size_t repeats = 10000;
+    auto mockBroker = std::make_shared<MockKafkaBroker>();
+    EXPECT_CALL(*mockBroker, subscribe_(_, _))
+        .Times(Exactly(2))
+        .WillOnce(Return(new FakeISISEventSubscriber(1, repeats)))
+        .WillOnce(Return(new FakeRunInfoStreamSubscriber(1)));
+    auto testWrapper = createTestInstance(mockBroker);
+
+    testWrapper.runKafkaOneStep();
+    testWrapper.runKafkaOneStep();
+
+    Workspace_sptr workspace;
+    TS_ASSERT_THROWS_NOTHING(testWrapper.stopCapture());
+    TS_ASSERT_THROWS_NOTHING(workspace = testWrapper->extractData());
+
+    auto eventWksp = std::dynamic_pointer_cast<EventWorkspace>(workspace);
+    TS_ASSERT(eventWksp);
+    checkWorkspaceEventsPerSpectrum(*eventWksp);
+    TS_ASSERT_EQUALS(0, eventWksp->getSpectrum(0).getNumberEvents() % repeats);
+    // Spectrum 2 gets 8 then 6 microsecond events from each repeat of the message
+    const auto &events = eventWksp->getSpectrum(1).getEvents();
+    for (size_t i = 0; i < events.size(); ++i) {
+      TS_ASSERT_EQUALS(i % 2 == 0 ? 8.0 : 6.0, events[i].tof());
+    }
+  }
+
   void test_Varying_Period_Event_Stream() {
     /**
      * Test that period number is correctly updated between runs
@@ -477,10 +576,11 @@ public:
 
 private:
   KafkaTesting::KafkaTestThreadHelper<Mantid::LiveData::KafkaEventStreamDecoder>
-  createTestInstance(const std::shared_ptr<Mantid::LiveData::IKafkaBroker> &broker) {
+  createTestInstance(const std::shared_ptr<Mantid::LiveData::IKafkaBroker> &broker,
+                     const std::size_t bufferThreshold = 0) {
     using namespace Mantid::LiveData;
 
-    KafkaEventStreamDecoder testInstance(broker, "", "", "", "", "", 0);
+    KafkaEventStreamDecoder testInstance(broker, "", "", "", "", "", bufferThreshold);
     return KafkaTesting::KafkaTestThreadHelper<KafkaEventStreamDecoder>(std::move(testInstance));
   }
 
@@ -506,6 +606,16 @@ private:
     TS_ASSERT(eventWksp.getNumberEvents() != 0);
   }
 
+  void checkWorkspaceEventsPerSpectrum(const Mantid::DataObjects::EventWorkspace &eventWksp) {
+    // Each message contains two events for spectrum 2 and one for the others
+    const auto eventsPerMessage = eventWksp.getSpectrum(0).getNumberEvents();
+    TS_ASSERT(eventsPerMessage != 0);
+    TS_ASSERT_EQUALS(2 * eventsPerMessage, eventWksp.getSpectrum(1).getNumberEvents());
+    for (size_t i = 2; i < eventWksp.getNumberHistograms(); ++i) {
+      TS_ASSERT_EQUALS(eventsPerMessage, eventWksp.getSpectrum(i).getNumberEvents());
+    }
+  }
+
   void checkWorkspaceLogData(Mantid::DataObjects::EventWorkspace &eventWksp) {
     Mantid::Kernel::TimeSeriesProperty<int32_t> *log = nullptr;
     auto run = eventWksp.mutableRun();
@@ -117,10 +117,15 @@ public:
 };
 
 namespace {
-void fakeReceiveAnISISEventMessage(std::string *buffer, int32_t nextPeriod) {
+void fakeReceiveAnISISEventMessage(std::string *buffer, int32_t nextPeriod, size_t repeats = 1) {
   flatbuffers::FlatBufferBuilder builder;
-  std::vector<uint32_t> spec = {5, 4, 3, 2, 1, 2};
-  std::vector<uint32_t> tof = {11000, 10000, 9000, 8000, 7000, 6000};
+  const std::vector<uint32_t> specPattern = {5, 4, 3, 2, 1, 2};
+  const std::vector<uint32_t> tofPattern = {11000, 10000, 9000, 8000, 7000, 6000};
+  std::vector<uint32_t> spec, tof;
+  for (size_t i = 0; i < repeats; ++i) {
+    spec.insert(spec.end(), specPattern.cbegin(), specPattern.cend());
+    tof.insert(tof.end(), tofPattern.cbegin(), tofPattern.cend());
+  }
 
   uint64_t frameTime = 1;
   float protonCharge(0.5f);
@@ -229,13 +234,15 @@ void fakeReceiveARunStopMessage(std::string *buffer, const std::string &stopTime
 // -----------------------------------------------------------------------------
 class FakeISISEventSubscriber : public Mantid::LiveData::IKafkaStreamSubscriber {
 public:
-  explicit FakeISISEventSubscriber(int32_t nperiods) : m_nperiods(nperiods), m_nextPeriod(0) {}
+  /// Each message repeats the events of fakeReceiveAnISISEventMessage eventRepeats times
+  explicit FakeISISEventSubscriber(int32_t nperiods, size_t eventRepeats = 1)
+      : m_nperiods(nperiods), m_nextPeriod(0), m_eventRepeats(eventRepeats) {}
   void subscribe() override {}
   void subscribe(int64_t offset) override { UNUSED_ARG(offset) }
   void consumeMessage(std::string *message, int64_t &offset, int32_t &partition, std::string &topic) override {
     assert(message);
 
-    fakeReceiveAnISISEventMessage(message, m_nextPeriod);
+    fakeReceiveAnISISEventMessage(message, m_nextPeriod, m_eventRepeats);
     m_nextPeriod = ((m_nextPeriod + 1) % m_nperiods);
 
     UNUSED_ARG(offset);
@@ -262,6 +269,7 @@ public:
 private:
   const int32_t m_nperiods;
   int32_t m_nextPeriod;
+  const size_t m_eventRepeats;
 };
 
 // ---------------------------------------------------------------------------------------
@@ -8,11 +8,13 @@
 
 #include "MantidAPI/AlgorithmFactory.h"
 #include "MantidAPI/FrameworkManager.h"
+#include "MantidAPI/IWorkspaceProperty.h"
 #include "MantidAPI/LiveListenerFactory.h"
 #include "MantidAPI/Run.h"
 #include "MantidDataObjects/EventWorkspace.h"
 #include "MantidDataObjects/Workspace2D.h"
 #include "MantidFrameworkTestHelpers/FacilityHelper.h"
+#include "MantidFrameworkTestHelpers/WorkspaceCreationHelper.h"
 #include "MantidGeometry/Instrument/ComponentInfo.h"
 #include "MantidKernel/ConfigService.h"
 #include "MantidLiveData/LoadLiveData.h"
@@ -232,6 +234,97 @@ public:
     TS_ASSERT_EQUALS(ws1->monitorWorkspace(), ws2->monitorWorkspace());
   }
 
+  //--------------------------------------------------------------------------------------------
+  void test_ReuseProcessingAlgorithms_runs_the_same_instance_on_each_chunk() {
+    FacilityHelper::ScopedFacilities loadTESTFacility("unit_testing/UnitTestFacilities.xml", "TEST");
+    auto processingAlgs = std::make_shared<LiveDataAlgorithm::ProcessingAlgorithms>();
+
+    IAlgorithm_sptr firstChunkAlg;
+    for (int chunk = 0; chunk < 2; ++chunk) {
+      LoadLiveData alg;
+      TS_ASSERT_THROWS_NOTHING(alg.initialize())
+      TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("Instrument", "TestDataListener"));
+      TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("AccumulationMethod", "Add"));
+      TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("ProcessingAlgorithm", "Rebin"));
+      TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("ProcessingProperties", "Params=40e3, 1e3, 60e3"));
+      TS_ASSERT_THROWS_NOTHING(alg.setProperty("PreserveEvents", false));
+      TS_ASSERT_THROWS_NOTHING(alg.setProperty("ReuseProcessingAlgorithms", true));
+      TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("OutputWorkspace", "fake"));
+      alg.setProcessingAlgorithms(processingAlgs);
+      TS_ASSERT_THROWS_NOTHING(alg.execute());
+      TS_ASSERT(alg.isExecuted());
+
+      TS_ASSERT(processingAlgs->chunk);
+      TS_ASSERT(!processingAlgs->post);
+      if (chunk == 0)
+        firstChunkAlg = processingAlgs->chunk;
+      else
+        TSM_ASSERT("The processing algorithm should be reused", processingAlgs->chunk == firstChunkAlg);
+      // The kept algorithm does not hold on to the chunk until the next one
+      for (const auto *name : {"InputWorkspace", "OutputWorkspace"}) {
+        const auto *wsProp = dynamic_cast<IWorkspaceProperty *>(processingAlgs->chunk->getPointerToProperty(name));
+        TSM_ASSERT("Chunk workspaces should be released after each chunk", !wsProp->getWorkspace());
+      }
+    }
+
+    // Both chunks are rebinned and added as without reusing the algorithm
+    auto ws = AnalysisDataService::Instance().retrieveWS<Workspace2D>("fake");
+    TS_ASSERT_EQUALS(ws->getNumberHistograms(), 2);
+    TS_ASSERT_EQUALS(ws->readY(0).size(), 20);
+    const auto &y = ws->readY(0);
+    TS_ASSERT_DELTA(std::accumulate(y.begin(), y.end(), 0.0), 200.0, 1e-4);
+  }
+
+  void test_ReuseProcessingAlgorithms_keeps_other_input_workspaces() {
+    FacilityHelper::ScopedFacilities loadTESTFacility("unit_testing/UnitTestFacilities.xml", "TEST");
+    auto processingAlgs = std::make_shared<LiveDataAlgorithm::ProcessingAlgorithms>();
+    auto factor = WorkspaceCreationHelper::createWorkspaceSingleValue(2.0);
+    AnalysisDataService::Instance().addOrReplace("factor", factor);
+
+    for (int chunk = 0; chunk < 3; ++chunk) {
+      LoadLiveData alg;
+      TS_ASSERT_THROWS_NOTHING(alg.initialize())
+      TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("Instrument", "TestDataListener"));
+      TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("AccumulationMethod", "Add"));
+      TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("ProcessingAlgorithm", "Multiply"));
+      TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("ProcessingProperties", "RHSWorkspace=factor"));
+      TS_ASSERT_THROWS_NOTHING(alg.setProperty("PreserveEvents", true));
+      TS_ASSERT_THROWS_NOTHING(alg.setProperty("ReuseProcessingAlgorithms", true));
+      TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("OutputWorkspace", "fake"));
+      alg.setProcessingAlgorithms(processingAlgs);
+      TS_ASSERT_THROWS_NOTHING(alg.execute());
+      TSM_ASSERT("Chunk " + std::to_string(chunk) + " should be processed", alg.isExecuted());
+
+      const auto *factorProp =
+          dynamic_cast<IWorkspaceProperty *>(processingAlgs->chunk->getPointerToProperty("RHSWorkspace"));
+      TSM_ASSERT("The extra input workspace should be kept for the next chunk", factorProp->getWorkspace() == factor);
+    }
+
+    // Every event of the three chunks was weighted by the factor
+    auto ws = AnalysisDataService::Instance().retrieveWS<EventWorkspace>("fake");
+    TS_ASSERT_EQUALS(ws->getNumberEvents(), 600);
+    double total = 0.;
+    for (size_t i = 0; i < ws->getNumberHistograms(); ++i)
+      total += ws->getSpectrum(i).integrate(0., 0., true);
+    TS_ASSERT_DELTA(total, 2. * static_cast<double>(ws->getNumberEvents()), 1e-6);
+  }
+
+  void test_processing_algorithms_are_not_kept_by_default() {
+    auto processingAlgs = std::make_shared<LiveDataAlgorithm::ProcessingAlgorithms>();
+    FacilityHelper::ScopedFacilities loadTESTFacility("unit_testing/UnitTestFacilities.xml", "TEST");
+    LoadLiveData alg;
+    TS_ASSERT_THROWS_NOTHING(alg.initialize())
+    TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("Instrument", "TestDataListener"));
+    TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("AccumulationMethod", "Replace"));
+    TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("ProcessingAlgorithm", "Rebin"));
+    TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("ProcessingProperties", "Params=40e3, 1e3, 60e3"));
+    TS_ASSERT_THROWS_NOTHING(alg.setPropertyValue("OutputWorkspace", "fake"));
+    alg.setProcessingAlgorithms(processingAlgs);
+    TS_ASSERT_THROWS_NOTHING(alg.execute());
+    TS_ASSERT(alg.isExecuted());
+    TS_ASSERT(!processingAlgs->chunk);
+  }
+
   //--------------------------------------------------------------------------------------------
   /** Simple processing of a chunk */
   void test_ProcessChunk_DoPreserveEvents() {
@@ -9,15 +9,103 @@
 /* This code is largely based on Russell Taylor's test for the
  * FakeEventDataLister class. */
 
+#include "MantidAPI/FrameworkManager.h"
 #include "MantidAPI/LiveListenerFactory.h"
 #include "MantidDataObjects/EventWorkspace.h"
 #include "MantidKernel/CPUTimer.h"
+#include "MantidLiveData/SNSLiveEventDataListener.h"
 #include <Poco/Thread.h>
 #include <cxxtest/TestSuite.h>
 
+#include <atomic>
+#include <cstring>
+#include <thread>
+#include <vector>
+
 using namespace Mantid::API;
 using Mantid::Kernel::CPUTimer;
 
+namespace {
+using Words = std::vector<uint32_t>;
+
+/// Timestamp of the packets, in seconds since the EPICS epoch
+constexpr uint32_t PACKET_SECONDS = 1000000000;
+
+/// Three pixels with detector IDs 1001 to 1003
+const std::string INSTRUMENT_XML = "<?xml version=\"1.0\" encoding=\"UTF-8\" ?>"
+                                   "<instrument name=\"SNSLiveTest\" valid-from=\"1900-01-31 23:59:59\" "
+                                   "valid-to=\"2100-01-31 23:59:59\" last-modified=\"2010-10-06T16:21:30\">"
+                                   "<defaults />"
+                                   "<component type=\"pixel\" idlist=\"pixels\">"
+                                   "<location x=\"1\" /><location x=\"2\" /><location x=\"3\" />"
+                                   "</component>"
+                                   "<type is=\"detector\" name=\"pixel\">"
+                                   "<cuboid id=\"pixel-shape\" />"
+                                   "<algebra val=\"pixel-shape\"/>"
+                                   "</type>"
+                                   "<idlist idname=\"pixels\">"
+                                   "<id start=\"1001\" end=\"1003\" />"
+                                   "</idlist>"
+                                   "</instrument>";
+
+/// Append a string to the payload of a packet, padded to a whole number of words
+void appendString(Words &payload, const std::string &str) {
+  const auto start = payload.size();
+  payload.resize(start + (str.size() + 3) / 4, 0);
+  std::memcpy(payload.data() + start, str.data(), str.size());
+}
+
+Words makePacket(const uint32_t baseType, const uint32_t version, const Words &payload) {
+  Words packet{static_cast<uint32_t>(payload.size() * sizeof(uint32_t)), ADARA_PKT_TYPE(baseType, version),
+               PACKET_SECONDS, 0};
+  packet.insert(packet.end(), payload.cbegin(), payload.cend());
+  return packet;
+}
+
+Words runStatusPacket() {
+  return makePacket(ADARA::PacketType::RUN_STATUS_TYPE, ADARA::PacketType::RUN_STATUS_VERSION,
+                    {1234, PACKET_SECONDS, (ADARA::RunStatus::NEW_RUN << 24) | 1});
+}
+
+Words beamlineInfoPacket() {
+  const std::string id("BL0"), shortName("TST"), longName("SNSLiveTest");
+  Words payload{static_cast<uint32_t>(longName.size() | (shortName.size() << 8) | (id.size() << 16))};
+  appendString(payload, id + shortName + longName);
+  return makePacket(ADARA::PacketType::BEAMLINE_INFO_TYPE, ADARA::PacketType::BEAMLINE_INFO_VERSION, payload);
+}
+
+Words geometryPacket() {
+  Words payload{static_cast<uint32_t>(INSTRUMENT_XML.size())};
+  appendString(payload, INSTRUMENT_XML);
+  return makePacket(ADARA::PacketType::GEOMETRY_TYPE, ADARA::PacketType::GEOMETRY_VERSION, payload);
+}
+
+/// A banked event packet with one source and one bank holding the events, given
+/// as pairs of time of flight, in units of 100ns, and pixel ID
+Words bankedEventPacket(const std::vector<std::pair<uint32_t, uint32_t>> &events) {
+  // pulse charge, energy, cycle and flags, then the source header with the
+  // corrected flag set and a single bank
+  Words payload{10, 0, 0, 0, 0, 0, 0x80000000, 1, 1, static_cast<uint32_t>(events.size())};
+  for (const auto &event : events) {
+    payload.emplace_back(event.first);
+    payload.emplace_back(event.second);
+  }
+  return makePacket(ADARA::PacketType::BANKED_EVENT_TYPE, ADARA::PacketType::BANKED_EVENT_VERSION, payload);
+}
+
+/// Listener parsing packets handed to it rather than read from the network
+class PacketFedListener : public Mantid::LiveData::SNSLiveEventDataListener {
+public:
+  void parse(const Words &packet) {
+    const auto bytes = static_cast<unsigned int>(packet.size() * sizeof(uint32_t));
+    std::memcpy(bufferFillAddress(), packet.data(), bytes);
+    bufferBytesAppended(bytes);
+    std::string log;
+    bufferParse(log);
+  }
+};
+} // namespace
+
 class SNSLiveEventDataListenerTest : public CxxTest::TestSuite {
 public:
   // This pair of boilerplate methods prevent the suite being created statically
@@ -25,13 +113,10 @@ public:
   static SNSLiveEventDataListenerTest *createSuite() { return new SNSLiveEventDataListenerTest(); }
   static void destroySuite(SNSLiveEventDataListenerTest *suite) { delete suite; }
 
-  SNSLiveEventDataListenerTest() {
-    // Create the listener. Remember: this will call connect()
-    sns_l = LiveListenerFactory::Instance().create("SNSLiveEventDataListener");
-    // sns_l = LiveListenerFactory::Instance().create("SEQUOIA");
-  }
+  // The xtests need an SMS server to connect to, so they do not run by default
 
-  void testProperties() {
+  void xtestProperties() {
+    const auto &sns_l = smsListener();
     TS_ASSERT(sns_l)
     TS_ASSERT_EQUALS(sns_l->name(), "SNSLiveEventDataListener")
     TS_ASSERT(!sns_l->supportsHistory())
@@ -39,13 +124,14 @@ public:
     TS_ASSERT(sns_l->isConnected())
   }
 
-  void testStart() {
+  void xtestStart() {
     // Nothing much to test just yet
-    TS_ASSERT_THROWS_NOTHING(sns_l->start(0))
+    TS_ASSERT_THROWS_NOTHING(smsListener()->start(0))
   }
 
-  void testExtractData() {
+  void xtestExtractData() {
     using namespace Mantid::DataObjects;
+    const auto &sns_l = smsListener();
     Workspace_const_sptr buffer;
     Poco::Thread::sleep(100);
     TS_ASSERT_THROWS_NOTHING(buffer = sns_l->extractData())
@@ -80,8 +166,9 @@ public:
   /** Call the extractData very quickly to try to trip up
    * the thread.
    */
-  void testThreadSafety() {
+  void xtestThreadSafety() {
     using namespace Mantid::DataObjects;
+    const auto &sns_l = smsListener();
     Workspace_const_sptr buffer;
     Poco::Thread::sleep(100);
 
@@ -95,6 +182,101 @@ public:
     std::cout << tim << " to call extactData() " << num << " times" << std::endl;
   }
 
+  /** Feed packets straight to the parser and check that each event reaches
+   * the spectrum of its pixel, before and after the buffer is swapped.
+   */
+  void testEventsReachTheirSpectraAcrossBufferSwap() {
+    using namespace Mantid::DataObjects;
+    FrameworkManager::Instance(); // LoadInstrument builds the buffer
+    PacketFedListener listener;
+    listener.parse(runStatusPacket());
+    listener.parse(beamlineInfoPacket());
+    listener.parse(geometryPacket());
+
+    // pixel 5000 is not in the instrument and is dropped
+    listener.parse(bankedEventPacket({{10000, 1001}, {20000, 1003}, {30000, 1001}, {40000, 5000}}));
+    auto first = std::dynamic_pointer_cast<const EventWorkspace>(listener.extractData());
+    TS_ASSERT(first)
+    TS_ASSERT_EQUALS(first->getNumberHistograms(), 3)
+    TS_ASSERT_EQUALS(first->getNumberEvents(), 3)
+    const auto firstIndices = first->getIndicesFromDetectorIDs({1001, 1002, 1003});
+    TS_ASSERT_EQUALS(first->getSpectrum(firstIndices[0]).getNumberEvents(), 2)
+    TS_ASSERT_EQUALS(first->getSpectrum(firstIndices[1]).getNumberEvents(), 0)
+    TS_ASSERT_EQUALS(first->getSpectrum(firstIndices[2]).getNumberEvents(), 1)
+    // times of flight come in units of 100ns
+    TS_ASSERT_DELTA(first->getSpectrum(firstIndices[2]).getEvents().front().tof(), 2000.0, 1e-9)
+
+    listener.parse(bankedEventPacket({{10000, 1002}, {20000, 1002}}));
+    auto second = std::dynamic_pointer_cast<const EventWorkspace>(listener.extractData());
+    TS_ASSERT(second)
+    TS_ASSERT_DIFFERS(second.get(), first.get())
+    TS_ASSERT_EQUALS(second->getNumberEvents(), 2)
+    const auto secondIndices = second->getIndicesFromDetectorIDs({1001, 1002, 1003});
+    TS_ASSERT_EQUALS(second->getSpectrum(secondIndices[0]).getNumberEvents(), 0)
+    TS_ASSERT_EQUALS(second->getSpectrum(secondIndices[1]).getNumberEvents(), 2)
+    TS_ASSERT_EQUALS(second->getSpectrum(secondIndices[2]).getNumberEvents(), 0)
+    // the first buffer is not touched by the later packet
+    TS_ASSERT_EQUALS(first->getNumberEvents(), 3)
+  }
+
+private:
+  /// The listener connected to an SMS server, created by the first test using it
+  const std::shared_ptr<ILiveListener> &smsListener() {
+    // Create the listener. Remember: this will call connect()
+    if (!m_smsListener)
+      m_smsListener = LiveListenerFactory::Instance().create("SNSLiveEventDataListener");
+    return m_smsListener;
+  }
+
+  std::shared_ptr<ILiveListener> m_smsListener;
+};
+
+/** Replays a stream of banked event packets through the parser while another
+ * thread extracts the buffer, as MonitorLiveData does during a run.
+ */
+class SNSLiveEventDataListenerTestPerformance : public CxxTest::TestSuite {
+public:
+  static SNSLiveEventDataListenerTestPerformance *createSuite() {
+    return new SNSLiveEventDataListenerTestPerformance();
+  }
+  static void destroySuite(SNSLiveEventDataListenerTestPerformance *suite) { delete suite; }
+
+  SNSLiveEventDataListenerTestPerformance() : m_eventPackets(NUM_PACKETS) {
+    FrameworkManager::Instance();
+    std::vector<std::pair<uint32_t, uint32_t>> events(EVENTS_PER_PACKET);
+    for (uint32_t packet = 0; packet < NUM_PACKETS; ++packet) {
+      // spread the events over the pixels and times of flight of a pulse
+      for (uint32_t i = 0; i < EVENTS_PER_PACKET; ++i)
+        events[i] = {(i * 7919 + packet * 104729) % 166667, 1001 + (i + packet) % 3};
+      m_eventPackets[packet] = bankedEventPacket(events);
+    }
+  }
+
+  void test_replay_banked_events_while_extracting() {
+    using namespace Mantid::DataObjects;
+    PacketFedListener listener;
+    listener.parse(runStatusPacket());
+    listener.parse(beamlineInfoPacket());
+    listener.parse(geometryPacket());
+
+    std::atomic<bool> parsed{false};
+    std::thread network([&] {
+      for (const auto &packet : m_eventPackets)
+        listener.parse(packet);
+      parsed = true;
+    });
+
+    size_t numEvents = 0;
+    while (!parsed)
+      numEvents += std::dynamic_pointer_cast<const EventWorkspace>(listener.extractData())->getNumberEvents();
+    network.join();
+    numEvents += std::dynamic_pointer_cast<const EventWorkspace>(listener.extractData())->getNumberEvents();
+
+    TS_ASSERT_EQUALS(numEvents, static_cast<size_t>(NUM_PACKETS) * EVENTS_PER_PACKET)
+  }
+
 private:
-  std::shared_ptr<ILiveListener> sns_l;
+  static constexpr uint32_t NUM_PACKETS = 2000;
+  static constexpr uint32_t EVENTS_PER_PACKET = 5000;
+  std::vector<Words> m_eventPackets;
 };
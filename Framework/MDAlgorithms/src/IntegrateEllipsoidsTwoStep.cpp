@@ -29,6 +29,7 @@
 #include <cmath>
 #include <string>
 #include <tuple>
+#include <utility>
 
 using namespace Mantid::API;
 using namespace Mantid::DataObjects;
@@ -369,7 +370,7 @@ void IntegrateEllipsoidsTwoStep::qListFromEventWS(Integrate3DEvents &integrator,
     // loop over the events
     double signal(1.);  // ignorable garbage
     double errorSq(1.); // ignorable garbage
-    const std::vector<WeightedEventNoTime> &raw_events = events.getWeightedEventsNoTime();
+    const std::vector<WeightedEventNoTime> &raw_events = std::as_const(events).getWeightedEventsNoTime();
     std::vector<std::pair<std::pair<double, double>, V3D>> qList;
     for (const auto &raw_event : raw_events) {
       double val = unitConverter.convertUnits(raw_event.tof());
@@ -31,6 +31,7 @@
 
 #include <boost/math/special_functions/round.hpp>
 #include <cmath>
+#include <utility>
 
 using namespace Mantid::API;
 using namespace Mantid::HistogramData;
@@ -96,7 +97,7 @@ void IntegrateEllipsoidsV1::qListFromEventWS(Integrate3DEvents &integrator, Prog
     // loop over the events
     double signal(1.);  // ignorable garbage
     double errorSq(1.); // ignorable garbage
-    const std::vector<WeightedEventNoTime> &raw_events = events.getWeightedEventsNoTime();
+    const std::vector<WeightedEventNoTime> &raw_events = std::as_const(events).getWeightedEventsNoTime();
     std::vector<std::pair<std::pair<double, double>, V3D>> qList;
     for (const auto &raw_event : raw_events) {
       double val = unitConverter.convertUnits(raw_event.tof());
@@ -96,6 +96,11 @@ public:
   /// Reset the pointer to the progress object.
   void resetProgress(Mantid::API::Progress *prog);
 
+  /// The name of the mantid_workspace_<n> entry being written
+  const std::string &entryName() const { return m_entryName; }
+  /// Whether the file is written with the HDF5 rather than the XML backend
+  bool isHDF5() const;
+
   /// Nexus file handle
   NXhandle fileID;
 
@@ -163,6 +168,8 @@ private:
 
   /// nexus file name
   std::string m_filename;
+  /// The name of the entry opened by openNexusWrite
+  std::string m_entryName;
 
   /** Writes a numeric log to the Nexus file
    *  @tparam T A numeric type (double, int, bool)
@@ -94,7 +94,7 @@ void NexusFileIO::openNexusWrite(const std::string &fileName, NexusFileIO::optio
     mode = NXACC_RDWR;
 
   else {
-    if (fileName.find(".xml") < fileName.size() || fileName.find(".XML") < fileName.size()) {
+    if (!isHDF5()) {
       mode = NXACC_CREATEXML;
       m_nexuscompression = NX_COMP_NONE;
     }
@@ -153,10 +153,15 @@ void NexusFileIO::openNexusWrite(const std::string &fileName, NexusFileIO::optio
 
   m_filehandle->makeGroup(mantidEntryName, className);
   m_filehandle->openGroup(mantidEntryName, className);
+  m_entryName = mantidEntryName;
 }
 
 void NexusFileIO::closeGroup() { m_filehandle->closeGroup(); }
 
+bool NexusFileIO::isHDF5() const {
+  return !(m_filename.find(".xml") < m_filename.size() || m_filename.find(".XML") < m_filename.size());
+}
+
 //-----------------------------------------------------------------------------------------------
 void NexusFileIO::closeNexusFile() {
   if (m_filehandle) {
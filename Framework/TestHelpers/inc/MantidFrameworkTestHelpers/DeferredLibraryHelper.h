@@ -0,0 +1,77 @@
+// Mantid Repository : https://github.com/mantidproject/mantid
+//
+// Copyright &copy; 2024 ISIS Rutherford Appleton Laboratory UKRI,
+//   NScD Oak Ridge National Laboratory, European Spallation Source,
+//   Institut Laue - Langevin & CSNS, Institute of High Energy Physics, CAS
+// SPDX - License - Identifier: GPL - 3.0 +
+/*********************************************************************************
+ *  PLEASE READ THIS!!!!!!!
+ *
+ *  This file MAY NOT be modified to use anything from a package other than
+ *Kernel.
+ *********************************************************************************/
+#pragma once
+
+#include "MantidKernel/LibraryManager.h"
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace DeferredLibraryHelper {
+
+/// The filename a library called name would have on this platform
+inline std::string libraryFilename(const std::string &name) {
+#ifdef _WIN32
+  return name + ".dll";
+#elif defined __APPLE__
+  return "lib" + name + ".dylib";
+#else
+  return "lib" + name + ".so";
+#endif
+}
+
+/**
+ * RAII struct writing a plugin manifest and empty placeholder libraries to a
+ * temporary directory. The placeholders cannot be opened so tests can check
+ * which libraries a call tried to open with LibraryManager::isDeferred. On
+ * destruction any libraries still deferred are dropped by trying to open them
+ * and the directory is removed.
+ */
+struct ScopedManifest {
+  /**
+   * @param directoryName Name of the temporary directory to create
+   * @param lines The lines of the manifest
+   * @param libraries The names, without prefix or suffix, of the placeholder
+   * libraries to create
+   */
+  ScopedManifest(const std::string &directoryName, const std::vector<std::string> &lines,
+                 const std::vector<std::string> &libraries)
+      : directory(std::filesystem::temp_directory_path() / directoryName) {
+    std::filesystem::create_directories(directory);
+    for (const auto &library : libraries)
+      std::ofstream(directory / libraryFilename(library));
+    std::ofstream manifest(path());
+    for (const auto &line : lines)
+      manifest << line << "\n";
+  }
+
+  ~ScopedManifest() {
+    Mantid::Kernel::LibraryManager::Instance().openDeferredLibraries();
+    std::error_code ignored;
+    std::filesystem::remove_all(directory, ignored);
+  }
+
+  /// Full path to the manifest
+  std::string path() const { return (directory / "plugins.manifest").string(); }
+
+  /// Register the libraries in the manifest with the LibraryManager
+  std::vector<std::string> defer(const std::vector<std::string> &excludes = {}) const {
+    return Mantid::Kernel::LibraryManager::Instance().deferLibraries(path(), excludes);
+  }
+
+private:
+  std::filesystem::path directory;
+};
+} // namespace DeferredLibraryHelper
@@ -105,6 +105,14 @@ private:
   bool shouldCompressUnfocused(const double compressTolerance, const double tofmin, const double tofmax,
                                const bool hasWallClockTolerance);
 
+  /// The time-of-flight range after cropping to TMin and TMax
+  void getTofCropRange(double &tofmin, double &tofmax, bool &cropMin, bool &cropMax) const;
+  /// Whether the per-event steps before focussing can run without child algorithms
+  bool canRunEventStepsInPlace(const double removePromptPulseWidth, const bool hasMaskBinTable,
+                               const bool applyLorentz);
+  /// Crop, compress and convert the events to d-spacing without child algorithms
+  void runEventStepsInPlace(const double compressEventsTolerance, const double wallClockTolerance);
+
   /// Low resolution TOF matrix workspace
   API::MatrixWorkspace_sptr m_lowResW;
   /// Low resolution TOF event workspace
@@ -15,19 +15,26 @@
 #include "MantidDataObjects/GroupingWorkspace.h"
 #include "MantidDataObjects/MaskWorkspace.h"
 #include "MantidDataObjects/OffsetsWorkspace.h"
+#include "MantidDataObjects/SpectrumUnitConverter.h"
 #include "MantidDataObjects/TableWorkspace.h"
 #include "MantidDataObjects/Workspace2D.h"
 #include "MantidKernel/ArrayProperty.h"
 #include "MantidKernel/BoundedValidator.h"
 #include "MantidKernel/ConfigService.h"
 #include "MantidKernel/DateTimeValidator.h"
+#include "MantidKernel/DeltaEMode.h"
 #include "MantidKernel/EnabledWhenProperty.h"
 #include "MantidKernel/EnumeratedString.h"
 #include "MantidKernel/InstrumentInfo.h"
 #include "MantidKernel/ListValidator.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/PropertyManager.h"
 #include "MantidKernel/PropertyManagerDataService.h"
 #include "MantidKernel/System.h"
+#include "MantidKernel/Unit.h"
+#include "MantidKernel/UnitFactory.h"
+
+#include <limits>
 
 using Mantid::Geometry::Instrument_const_sptr;
 using namespace Mantid::Kernel;
@@ -82,6 +89,7 @@ const std::string LORENTZ("LorentzCorrection");
 const std::string UNWRAP_REF("UnwrapRef");
 const std::string LOWRES_REF("LowResRef");
 const std::string LOWRES_SPEC_OFF("LowResSpectrumOffset");
+const std::string IN_PLACE_EVENT_STEPS("InPlaceEventSteps");
 } // namespace PropertyNames
 
 void getTofRange(const MatrixWorkspace_const_sptr &wksp, double &tmin, double &tmax) {
@@ -248,6 +256,13 @@ void AlignAndFocusPowder::init() {
                   "Otherwise, the low resolution spectra will have spectrum "
                   "IDs offset from normal ones. ");
   declareProperty(PropertyNames::PM_NAME, "__powdereduction", Direction::Input);
+  declareProperty(PropertyNames::IN_PLACE_EVENT_STEPS, false,
+                  "If true, crop in time-of-flight, compress and convert the events to d-spacing in place, with "
+                  "one parallel loop over the spectra for the crop and one for compressing and converting, "
+                  "rather than running CropWorkspace, CompressEvents and ConvertUnits as child algorithms. "
+                  "Focussing still runs DiffractionFocussing. Only used for event data binned in d-spacing with "
+                  "explicit Params and none of the prompt pulse, MaskBinTable, resonance, Lorentz, unwrap, "
+                  "wavelength or low resolution options. The output is the same either way.");
 }
 
 std::map<std::string, std::string> AlignAndFocusPowder::validateInputs() {
@@ -510,88 +525,85 @@ void AlignAndFocusPowder::exec() {
   }
   m_progress->report();
 
-  // hold onto over tof range for CropWorkspace(tof) and RemovePromptPulse
-  double tofmin = EMPTY_DBL();
-  double tofmax = EMPTY_DBL();
-
-  // crop the workspace in time-of-flight
-  if (((!isEmpty(xmin)) && (xmin >= 0.)) || ((!isEmpty(xmax)) && (xmax > 0.))) {
-    getTofRange(m_outputW, tofmin, tofmax);
-
-    API::IAlgorithm_sptr cropAlg = createChildAlgorithm("CropWorkspace");
-    cropAlg->setProperty("InputWorkspace", m_outputW);
-    cropAlg->setProperty("OutputWorkspace", m_outputW);
+  // the per-event steps up to d-spacing can be done without child algorithms
+  const double removePromptPulseWidth = getProperty(PropertyNames::REMOVE_PROMPT_PULSE);
+  const bool inPlaceEventSteps =
+      canRunEventStepsInPlace(removePromptPulseWidth, static_cast<bool>(maskBinTableWS), applyLorentz);
+  if (inPlaceEventSteps) {
+    m_progress->reportIncrement(4, "In place event steps");
+  } else {
+    // hold onto over tof range for CropWorkspace(tof) and RemovePromptPulse
+    double tofmin = EMPTY_DBL();
+    double tofmax = EMPTY_DBL();
     bool setxmin = false;
-    if ((xmin >= 0.) && (xmin > tofmin)) {
-      cropAlg->setProperty("Xmin", xmin);
-      tofmin = xmin; // increase value
-      setxmin = true;
-    }
     bool setxmax = false;
-    if ((xmax > 0.) && (xmax < tofmax)) {
-      cropAlg->setProperty("Xmax", xmax);
-      tofmax = xmax;
-      setxmax = true;
-    }
-    // only run if either xmin or xmax was set
+    getTofCropRange(tofmin, tofmax, setxmin, setxmax);
+
+    // crop the workspace in time-of-flight, only run if either xmin or xmax was set
     if (setxmin || setxmax) {
+      API::IAlgorithm_sptr cropAlg = createChildAlgorithm("CropWorkspace");
+      cropAlg->setProperty("InputWorkspace", m_outputW);
+      cropAlg->setProperty("OutputWorkspace", m_outputW);
+      if (setxmin)
+        cropAlg->setProperty("Xmin", tofmin);
+      if (setxmax)
+        cropAlg->setProperty("Xmax", tofmax);
       g_log.information() << "running CropWorkspace(TOFmin=" << xmin << ", TOFmax=" << xmax << ") started at "
                           << Types::Core::DateAndTime::getCurrentTime() << "\n";
       cropAlg->executeAsChildAlg();
       m_outputW = cropAlg->getProperty("OutputWorkspace");
     }
-  }
-  m_progress->report();
+    m_progress->report();
 
-  // filter the input events if appropriate
-  const double removePromptPulseWidth = getProperty(PropertyNames::REMOVE_PROMPT_PULSE);
-  if (removePromptPulseWidth > 0.) {
-    bool removePromptPulse(false);
-    if (auto outputEW = std::dynamic_pointer_cast<EventWorkspace>(m_outputW)) {
-      removePromptPulse = (outputEW->getNumberEvents() > 0);
+    // filter the input events if appropriate
+    if (removePromptPulseWidth > 0.) {
+      bool removePromptPulse(false);
+      if (auto outputEW = std::dynamic_pointer_cast<EventWorkspace>(m_outputW)) {
+        removePromptPulse = (outputEW->getNumberEvents() > 0);
+      }
+      if (removePromptPulse) {
+        g_log.information() << "running RemovePromptPulse(Width=" << removePromptPulseWidth << ") started at "
+                            << Types::Core::DateAndTime::getCurrentTime() << "\n";
+        API::IAlgorithm_sptr filterPAlg = createChildAlgorithm("RemovePromptPulse");
+        filterPAlg->setProperty("InputWorkspace", m_outputW);
+        filterPAlg->setProperty("OutputWorkspace", m_outputW);
+        filterPAlg->setProperty("Width", removePromptPulseWidth);
+
+        // if some of the range was known in CropWorkspace-TOF, use it again here
+        // they default to EMPTY_DBL which the alg interprets as unset
+        filterPAlg->setProperty("TMin", tofmin);
+        filterPAlg->setProperty("TMax", tofmax);
+
+        filterPAlg->executeAsChildAlg();
+        m_outputW = filterPAlg->getProperty("OutputWorkspace");
+      } else {
+        g_log.information("skipping RemovePromptPulse on empty EventWorkspace");
+      }
     }
-    if (removePromptPulse) {
-      g_log.information() << "running RemovePromptPulse(Width=" << removePromptPulseWidth << ") started at "
-                          << Types::Core::DateAndTime::getCurrentTime() << "\n";
-      API::IAlgorithm_sptr filterPAlg = createChildAlgorithm("RemovePromptPulse");
-      filterPAlg->setProperty("InputWorkspace", m_outputW);
-      filterPAlg->setProperty("OutputWorkspace", m_outputW);
-      filterPAlg->setProperty("Width", removePromptPulseWidth);
-
-      // if some of the range was known in CropWorkspace-TOF, use it again here
-      // they default to EMPTY_DBL which the alg interprets as unset
-      filterPAlg->setProperty("TMin", tofmin);
-      filterPAlg->setProperty("TMax", tofmax);
-
-      filterPAlg->executeAsChildAlg();
-      m_outputW = filterPAlg->getProperty("OutputWorkspace");
-    } else {
-      g_log.information("skipping RemovePromptPulse on empty EventWorkspace");
+    m_progress->report();
+
+    if (maskBinTableWS) {
+      g_log.information() << "running MaskBinsFromTable started at " << Types::Core::DateAndTime::getCurrentTime()
+                          << "\n";
+      API::IAlgorithm_sptr alg = createChildAlgorithm("MaskBinsFromTable");
+      alg->setProperty("InputWorkspace", m_outputW);
+      alg->setProperty("OutputWorkspace", m_outputW);
+      alg->setProperty("MaskingInformation", maskBinTableWS);
+      alg->executeAsChildAlg();
+      m_outputW = alg->getProperty("OutputWorkspace");
     }
-  }
-  m_progress->report();
+    m_progress->report();
 
-  if (maskBinTableWS) {
-    g_log.information() << "running MaskBinsFromTable started at " << Types::Core::DateAndTime::getCurrentTime()
-                        << "\n";
-    API::IAlgorithm_sptr alg = createChildAlgorithm("MaskBinsFromTable");
-    alg->setProperty("InputWorkspace", m_outputW);
-    alg->setProperty("OutputWorkspace", m_outputW);
-    alg->setProperty("MaskingInformation", maskBinTableWS);
-    alg->executeAsChildAlg();
-    m_outputW = alg->getProperty("OutputWorkspace");
-  }
-  m_progress->report();
+    // do a calculation to determine if compressing the un-focussed data will reduce data size
+    if (shouldCompressUnfocused(compressEventsTolerance, tofmin, tofmax, !isEmpty(wallClockTolerance))) {
+      compressEventsOutputWS(compressEventsTolerance, wallClockTolerance);
+    }
 
-  // do a calculation to determine if compressing the un-focussed data will reduce data size
-  if (shouldCompressUnfocused(compressEventsTolerance, tofmin, tofmax, !isEmpty(wallClockTolerance))) {
-    compressEventsOutputWS(compressEventsTolerance, wallClockTolerance);
+    if (!binInDspace)
+      m_outputW = rebin(m_outputW);
+    m_progress->report();
   }
 
-  if (!binInDspace)
-    m_outputW = rebin(m_outputW);
-  m_progress->report();
-
   if (m_calibrationWS) {
     // ApplyDiffCal and update m_outputW
     g_log.information() << "apply calibration workspace to input workspace at "
@@ -608,7 +620,10 @@ void AlignAndFocusPowder::exec() {
 
   m_progress->report();
 
-  m_outputW = convertUnits(m_outputW, "dSpacing");
+  if (inPlaceEventSteps)
+    runEventStepsInPlace(compressEventsTolerance, wallClockTolerance);
+  else
+    m_outputW = convertUnits(m_outputW, "dSpacing");
   m_progress->report();
 
   if (m_calibrationWS) {
@@ -1293,4 +1308,107 @@ bool AlignAndFocusPowder::shouldCompressUnfocused(const double compressTolerance
   }
 }
 
+/**
+ * Resolve the time-of-flight range of the data once it is cropped to TMin and TMax, as used for CropWorkspace. The
+ * range is left as EMPTY_DBL() if neither is set.
+ * @param tofmin :: the smallest time-of-flight
+ * @param tofmax :: the largest time-of-flight
+ * @param cropMin :: whether TMin crops the data
+ * @param cropMax :: whether TMax crops the data
+ */
+void AlignAndFocusPowder::getTofCropRange(double &tofmin, double &tofmax, bool &cropMin, bool &cropMax) const {
+  tofmin = EMPTY_DBL();
+  tofmax = EMPTY_DBL();
+  cropMin = false;
+  cropMax = false;
+  if (((!isEmpty(xmin)) && (xmin >= 0.)) || ((!isEmpty(xmax)) && (xmax > 0.))) {
+    getTofRange(m_outputW, tofmin, tofmax);
+    if ((xmin >= 0.) && (xmin > tofmin)) {
+      tofmin = xmin; // increase value
+      cropMin = true;
+    }
+    if ((xmax > 0.) && (xmax < tofmax)) {
+      tofmax = xmax;
+      cropMax = true;
+    }
+  }
+}
+
+/**
+ * The in place event steps only cover the simple chain of cropping in time-of-flight, compressing and converting to
+ * d-spacing. Any of the other options add steps in between that need the intermediate workspaces.
+ */
+bool AlignAndFocusPowder::canRunEventStepsInPlace(const double removePromptPulseWidth, const bool hasMaskBinTable,
+                                                  const bool applyLorentz) {
+  const bool inPlaceEventSteps = getProperty(PropertyNames::IN_PLACE_EVENT_STEPS);
+  if (!inPlaceEventSteps)
+    return false;
+
+  const auto eventWS = std::dynamic_pointer_cast<const EventWorkspace>(m_outputW);
+  const bool canRunInPlace = eventWS && eventWS->getAxis(0)->unit()->unitID() == "TOF" &&
+                             removePromptPulseWidth <= 0. && !hasMaskBinTable && binInDspace && m_resampleX == 0 &&
+                             m_params.size() >= 3 && m_delta_ragged.empty() && m_resonanceLower.empty() &&
+                             !applyLorentz && LRef <= 0. && DIFCref <= 0. && minwl <= 0. && isEmpty(maxwl) &&
+                             !m_processLowResTOF;
+  if (!canRunInPlace)
+    g_log.information() << PropertyNames::IN_PLACE_EVENT_STEPS
+                        << " is not supported with the requested options, running the child algorithms\n";
+  return canRunInPlace;
+}
+
+/**
+ * Crop in time-of-flight, compress and convert to d-spacing in place rather than running CropWorkspace,
+ * CompressEvents and ConvertUnits. The events and X values are the same as from the child algorithms. There are two
+ * parallel loops over the event lists: cropping is a pass of its own so that the decision to compress is made on the
+ * events that survive it, then each list is compressed and converted in one go.
+ */
+void AlignAndFocusPowder::runEventStepsInPlace(const double compressEventsTolerance,
+                                               const double wallClockTolerance) {
+  g_log.information() << "running in place event steps started at " << Types::Core::DateAndTime::getCurrentTime()
+                      << "\n";
+
+  auto eventWS = std::dynamic_pointer_cast<EventWorkspace>(m_outputW);
+  const auto numHist = static_cast<int64_t>(eventWS->getNumberHistograms());
+
+  double tofmin = EMPTY_DBL();
+  double tofmax = EMPTY_DBL();
+  bool cropMin = false;
+  bool cropMax = false;
+  getTofCropRange(tofmin, tofmax, cropMin, cropMax);
+  if (cropMin || cropMax) {
+    const double cropLower = cropMin ? tofmin : std::numeric_limits<double>::lowest();
+    const double cropUpper = cropMax ? tofmax : std::numeric_limits<double>::max();
+    PARALLEL_FOR_IF(Kernel::threadSafe(*eventWS))
+    for (int64_t i = 0; i < numHist; ++i)
+      eventWS->getSpectrum(i).cropTof(cropLower, cropUpper);
+  }
+
+  const bool compress =
+      shouldCompressUnfocused(compressEventsTolerance, tofmin, tofmax, !isEmpty(wallClockTolerance));
+
+  // convert with the default elastic mode of ConvertUnits
+  const auto emode = DeltaEMode::Elastic;
+  const Unit_sptr outputUnit = UnitFactory::Instance().create("dSpacing");
+  SpectrumUnitConverter converter(*eventWS, *eventWS->getAxis(0)->unit(), *outputUnit, emode);
+  PARALLEL_FOR_IF(Kernel::threadSafe(*eventWS))
+  for (int64_t i = 0; i < numHist; ++i) {
+    PARALLEL_START_INTERRUPT_REGION
+    auto &events = eventWS->getSpectrum(i);
+    if (compress)
+      events.compressEvents(compressEventsTolerance, &events);
+    converter.convert(static_cast<size_t>(i));
+    PARALLEL_END_INTERRUPT_REGION
+  }
+  PARALLEL_CHECK_INTERRUPT_REGION
+
+  if (converter.numberOfFailedSpectra() != 0) {
+    g_log.warning() << "Unable to calculate sample-detector distance for " << converter.numberOfFailedSpectra()
+                    << " spectra. Masking spectrum.\n";
+  }
+  eventWS->clearMRU();
+
+  eventWS->getAxis(0)->unit() = outputUnit;
+  SpectrumUnitConverter::storeEMode(*eventWS, emode);
+}
+
 } // namespace Mantid::WorkflowAlgorithms
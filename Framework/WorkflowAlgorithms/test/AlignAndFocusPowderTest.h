@@ -9,6 +9,7 @@
 #include "MantidFrameworkTestHelpers/WorkspaceCreationHelper.h"
 #include <cxxtest/TestSuite.h>
 
+#include "MantidAPI/AlgorithmManager.h"
 #include "MantidAPI/Axis.h"
 #include "MantidAPI/FrameworkManager.h"
 #include "MantidAPI/TableRow.h"
@@ -609,6 +610,10 @@ public:
     AnalysisDataService::Instance().remove(m_outputWS);
   }
 
+  void testEventWksp_inPlaceEventSteps_preserveEvents() { doTestInPlaceEventSteps(true, "5."); }
+
+  void testEventWksp_inPlaceEventSteps_doNotPreserveEvents() { doTestInPlaceEventSteps(false, "0."); }
+
   /** Setup for testing HRPD NeXus data */
   void setUp_HRP38692() {
 
@@ -846,6 +851,45 @@ public:
     TS_ASSERT_EQUALS(m_outWS->getNumberHistograms(), numGroups);
   }
 
+  /* Run with and without InPlaceEventSteps and check the results are the same */
+  void doTestInPlaceEventSteps(const bool preserveEvents, const std::string &compressTolerance) {
+    setUp_EventWorkspace("EventWksp_inPlaceEventSteps");
+    groupAllBanks(m_inputWS);
+
+    const std::string childAlgsWS{m_outputWS + "_childAlgs"};
+    const std::string inPlaceWS{m_outputWS + "_inPlace"};
+    for (const bool inPlace : {false, true}) {
+      AlignAndFocusPowder align_and_focus;
+      align_and_focus.initialize();
+      align_and_focus.setPropertyValue("InputWorkspace", m_inputWS);
+      align_and_focus.setPropertyValue("OutputWorkspace", inPlace ? inPlaceWS : childAlgsWS);
+      align_and_focus.setPropertyValue("GroupingWorkspace", m_groupWS);
+      align_and_focus.setPropertyValue("Params", "0.1,-0.001,3.");
+      align_and_focus.setPropertyValue("TMin", "2000.");
+      align_and_focus.setPropertyValue("TMax", "12000.");
+      align_and_focus.setPropertyValue("CompressTolerance", compressTolerance);
+      align_and_focus.setProperty("PreserveEvents", preserveEvents);
+      align_and_focus.setProperty("InPlaceEventSteps", inPlace);
+      TS_ASSERT_THROWS_NOTHING(align_and_focus.execute());
+      TS_ASSERT(align_and_focus.isExecuted());
+    }
+
+    const auto childAlgs = AnalysisDataService::Instance().retrieveWS<MatrixWorkspace>(childAlgsWS);
+    const auto inPlace = AnalysisDataService::Instance().retrieveWS<MatrixWorkspace>(inPlaceWS);
+    TS_ASSERT_EQUALS(inPlace->getAxis(0)->unit()->unitID(), "TOF");
+    TS_ASSERT_EQUALS(inPlace->id(), childAlgs->id());
+    auto checkAlg = AlgorithmManager::Instance().create("CompareWorkspaces");
+    checkAlg->setPropertyValue("Workspace1", childAlgsWS);
+    checkAlg->setPropertyValue("Workspace2", inPlaceWS);
+    checkAlg->execute();
+    TS_ASSERT(checkAlg->getProperty("Result"));
+
+    AnalysisDataService::Instance().remove(m_inputWS);
+    AnalysisDataService::Instance().remove(m_groupWS);
+    AnalysisDataService::Instance().remove(childAlgsWS);
+    AnalysisDataService::Instance().remove(inPlaceWS);
+  }
+
   /* Utility functions */
   void loadDiffCal(const std::string &instrfilename, const std::string &calfilename, bool group, bool cal, bool mask) {
     LoadDiffCal loadDiffAlg;
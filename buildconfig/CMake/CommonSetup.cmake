@@ -19,6 +19,15 @@ endif()
 option(ENABLE_OPENGL "Enable OpenGLbased rendering" ON)
 option(ENABLE_OPENCASCADE "Enable OpenCascade-based 3D visualisation" ON)
 option(USE_PYTHON_DYNAMIC_LIB "Dynamic link python libs" ON)
+# Reading the plugin manifest from the built plugins runs them during the build, which cross compiled plugins cannot do
+if(CMAKE_CROSSCOMPILING)
+  set(_plugin_manifest_from_libraries OFF)
+else()
+  set(_plugin_manifest_from_libraries ON)
+endif()
+option(PLUGIN_MANIFEST_FROM_LIBRARIES "Write the plugin manifest from the built plugins rather than their sources"
+       ${_plugin_manifest_from_libraries}
+)
 
 add_custom_target(check COMMAND ${CMAKE_CTEST_COMMAND})
 make_directory(${CMAKE_RUNTIME_OUTPUT_DIRECTORY}/Testing)
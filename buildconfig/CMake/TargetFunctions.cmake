@@ -30,6 +30,95 @@ function(mtd_install_targets)
   endforeach()
 endfunction()
 
+# Record the algorithms, loaders, functions and archive searches that a plugin library registers by scanning its
+# sources for the DECLARE_ macros. Used for the plugin manifest when PLUGIN_MANIFEST_FROM_LIBRARIES is off. The scan
+# finds class names, which differ from the registered names for some algorithms, e.g. LoadRaw3. Asking for a name
+# missing from the manifest opens every deferred library so those are still found, just not lazily.
+function(mtd_add_plugin_manifest_entries target)
+  get_target_property(_sources ${target} SOURCES)
+  get_target_property(_source_dir ${target} SOURCE_DIR)
+  set(_entries)
+  foreach(_src ${_sources})
+    if(NOT _src MATCHES "\\.cpp$")
+      continue()
+    endif()
+    if(NOT IS_ABSOLUTE ${_src})
+      set(_src ${_source_dir}/${_src})
+    endif()
+    file(STRINGS ${_src} _declarations REGEX "DECLARE_[A-Z0-9_]*(ALGORITHM|FUNCTION|ARCHIVESEARCH)\\(")
+    foreach(_decl ${_declarations})
+      if(_decl MATCHES "DECLARE_(NEXUS_|NEXUS_HDF5_)?FILELOADER_ALGORITHM\\( *([A-Za-z0-9_]+)")
+        list(APPEND _entries "$<TARGET_FILE_NAME:${target}> Algorithm ${CMAKE_MATCH_2}"
+             "$<TARGET_FILE_NAME:${target}> FileLoader ${CMAKE_MATCH_2}"
+        )
+      elseif(_decl MATCHES "DECLARE_ALGORITHM\\( *([A-Za-z0-9_]+)")
+        list(APPEND _entries "$<TARGET_FILE_NAME:${target}> Algorithm ${CMAKE_MATCH_1}")
+      elseif(_decl MATCHES "DECLARE_FUNCTION\\( *([A-Za-z0-9_]+)")
+        list(APPEND _entries "$<TARGET_FILE_NAME:${target}> Function ${CMAKE_MATCH_1}")
+      elseif(_decl MATCHES "DECLARE_ARCHIVESEARCH\\( *[A-Za-z0-9_]+ *, *([A-Za-z0-9_]+)")
+        list(APPEND _entries "$<TARGET_FILE_NAME:${target}> ArchiveSearch ${CMAKE_MATCH_1}")
+      endif()
+    endforeach()
+  endforeach()
+  set_property(GLOBAL APPEND PROPERTY MANTID_PLUGIN_MANIFEST_ENTRIES ${_entries})
+endfunction()
+
+# Write the manifest of the algorithms, loaders, functions and archive searches that each plugin library registers
+# next to the plugin libraries so that the framework can open a library on first use. With
+# PLUGIN_MANIFEST_FROM_LIBRARIES the entries are the names the objects register under, read by opening the built
+# libraries, together with what is needed to list the algorithms without opening them. The build then fails if anything
+# the plugins register is missing from the manifest. Otherwise, e.g. when cross compiling, the entries are those
+# recorded by mtd_add_plugin_manifest_entries.
+function(mtd_write_plugin_manifest)
+  set(_filename framework-plugin-manifest.txt)
+  get_property(_is_multi_config GLOBAL PROPERTY GENERATOR_IS_MULTI_CONFIG)
+  if(_is_multi_config)
+    set(_output ${CMAKE_LIBRARY_OUTPUT_DIRECTORY}/$<CONFIG>/${_filename})
+  else()
+    set(_output ${CMAKE_LIBRARY_OUTPUT_DIRECTORY}/${_filename})
+  endif()
+  if(PLUGIN_MANIFEST_FROM_LIBRARIES)
+    get_property(_plugins GLOBAL PROPERTY MANTID_PLUGIN_TARGETS)
+    set(_list_dir ${CMAKE_CURRENT_BINARY_DIR}/plugin-manifest)
+    file(MAKE_DIRECTORY ${_list_dir})
+    set(_list_commands)
+    set(_lists)
+    set(_libraries)
+    foreach(_plugin ${_plugins})
+      # each library is listed in its own process so that only its registrations are seen
+      list(APPEND _list_commands COMMAND FrameworkPluginManifest list $<TARGET_FILE:${_plugin}>
+           ${_list_dir}/${_plugin}.txt
+      )
+      list(APPEND _lists ${_list_dir}/${_plugin}.txt)
+      list(APPEND _libraries $<TARGET_FILE:${_plugin}>)
+    endforeach()
+    add_custom_command(
+      OUTPUT ${_output}
+      ${_list_commands}
+      COMMAND FrameworkPluginManifest merge ${_output} ${_lists}
+      COMMAND FrameworkPluginManifest check ${_output} ${_libraries}
+      DEPENDS FrameworkPluginManifest ${_plugins}
+      COMMENT "Generating ${_filename}"
+      VERBATIM
+    )
+    add_custom_target(GenerateFrameworkPluginManifest ALL DEPENDS ${_output})
+    add_dependencies(Framework GenerateFrameworkPluginManifest)
+  else()
+    get_property(_entries GLOBAL PROPERTY MANTID_PLUGIN_MANIFEST_ENTRIES)
+    list(JOIN _entries "\n" _content)
+    file(
+      GENERATE
+      OUTPUT ${_output}
+      CONTENT "${_content}\n"
+    )
+  endif()
+  install(
+    FILES ${_output}
+    DESTINATION ${WORKBENCH_PLUGINS_DIR}
+    COMPONENT Runtime
+  )
+endfunction()
+
 # Install a framework library (used primarily for a conda install)
 function(mtd_install_framework_lib)
   set(options INSTALL_EXPORT_FILE PLUGIN_LIB)
@@ -38,6 +127,10 @@ function(mtd_install_framework_lib)
   cmake_parse_arguments(PARSED "${options}" "${oneValueArgs}" "${multiValueArgs}" ${ARGN})
   # if its a plugin we don't need to headers or .lib file we also don't need to export the cmake targets
   if(PARSED_PLUGIN_LIB)
+    set_property(GLOBAL APPEND PROPERTY MANTID_PLUGIN_TARGETS ${PARSED_TARGETS})
+    if(NOT PLUGIN_MANIFEST_FROM_LIBRARIES)
+      mtd_add_plugin_manifest_entries(${PARSED_TARGETS})
+    endif()
     install(
       TARGETS ${PARSED_TARGETS}
       RUNTIME DESTINATION ${WORKBENCH_PLUGINS_DIR} COMPONENT Runtime